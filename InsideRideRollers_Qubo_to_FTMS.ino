@@ -19,16 +19,18 @@
 #include "web_server.h"
 #include "sensors.h"
 #include "calibration.h"
+#include "control.h"
+#include "log.h"
+#include "perf.h"
+#include "trainer_state.h"
+#include "recorder.h"
+#include "replay.h"
+#include "sweep.h"
+#include "power.h"
 
 #include <esp_ota_ops.h>
 
-// ==================== CONTROL STATE ====================
-volatile int16_t ergTargetWatts = 0;        // ERG mode target power
-volatile float simGradePercent = 0.0f;      // SIM mode grade
-static int32_t targetLogicalPosition = 0;   // Computed target position
-
-// ==================== TIMING ====================
-uint32_t lastPowerNotifyMs = 0;
+static void startTasks();                   // Control/comms tasks (defined below)
 
 // ==================== OTA APP VALIDITY ====================
 static void otaMarkAppValidAfterBoot() {
@@ -60,42 +62,36 @@ void setup() {
   Serial.println();
 
   // Initialize subsystems
+  perfInit();
   ledInit();
   calibrationInit();   // Load calibration from NVS
   stepperInit();
-  stepperHome();       // Home stepper on power-up
+  stepperBootHome();   // Warm boot: restore position; otherwise home in the step timer
   sensorsInit();       // Initialize Hall sensor
-  bleInit();
+  bleInit();           // Advertising from here on, while the rest comes up
   delay(200);          // Allow BLE stack to fully stabilize before starting WiFi
   webServerInit();
-
-  Serial.println("✓ System Ready");
+  recorderInit();      // Mount SPIFFS before the control task starts sampling
+  startTasks();        // Control task finishes a background homing
+  powerInit();         // Idle clock/modem sleep from loop()
+
+  BleAdvInfo adv;
+  bleGetAdvInfo(&adv);
+  Serial.printf("✓ System Ready (advertising %lu ms after boot, homing %s)\n",
+                (unsigned long)(adv.bootUs / 1000), gIsHoming ? "in progress" : "done");
   Serial.println("=====================================");
 }
 
-// ==================== MAIN LOOP ====================
-void loop() {
-  // PRIORITY 1: Handle web server requests first (critical for responsiveness)
-  webServerUpdate();
-  
-  // PRIORITY 2: Update LED (fast, non-blocking)
-  ledUpdate();
-  
-  // PRIORITY 3: Update stepper (can be CPU intensive)
-  static uint32_t lastStepperUpdate = 0;
-  if (millis() - lastStepperUpdate >= 5) {  // Only update every 5ms
-    lastStepperUpdate = millis();
-    stepperUpdate();
-  }
-  
-  // PRIORITY 4: Read sensors (less frequently)
-  static uint32_t lastSensorUpdate = 0;
-  if (millis() - lastSensorUpdate >= 100) {  // Only every 100ms
-    lastSensorUpdate = millis();
-    sensorsUpdate();
-  }
+// ==================== CONTROL TASK ====================
+// Fixed-period pipeline: limit/safety -> sensors -> target -> stepperSetTarget.
+// Runs above the web/BLE/LED work, so a slow HTTP request or WebSocket write
+// can no longer delay motion or sensor sampling.
+static constexpr uint32_t SENSOR_TICKS = 50 / CONTROL_PERIOD_MS;    // 20 Hz
+static constexpr uint32_t TARGET_TICKS = 50 / CONTROL_PERIOD_MS;    // 20 Hz
 
-  // ==================== SAFETY: LIMIT SWITCH MONITORING ====================
+static TaskHandle_t gCommsTaskHandle = NULL;  // Woken for each new sensor sample
+
+static void controlSafety() {
   stepperUpdateLimitDebounce();
 
   // Check if limit switch is pressed unexpectedly (not during homing)
@@ -103,161 +99,155 @@ void loop() {
     stepperRequestRehome("limitPressed in loop");
   }
 
-  // Handle pending rehome request
-  if (gRehomeRequested && !gIsHoming) {
-    gRehomeRequested = false;
-
-    ControlMode prevMode = gMode;
+  // Handle pending rehome request (homing runs in the step timer, control keeps going)
+  static bool rehomeActive = false;
+  static ControlMode rehomePrevMode = MODE_IDLE;
+  if (gRehomeRequested && !gIsHoming && !rehomeActive) {
+    rehomePrevMode = gMode;
     gMode = MODE_IDLE;
+    rehomeActive = true;
 
-    stepperHome();
+    stepperHomeStart();
+    gRehomeRequested = false;
+  }
 
-    // Restore previous mode after successful rehome
-    gMode = prevMode;
-    Serial.println("[SAFETY] Rehome complete, resuming previous mode.");
+  // Restore previous mode once the rehome finishes
+  if (rehomeActive && !gIsHoming) {
+    rehomeActive = false;
+    gMode = rehomePrevMode;
+    LOG_I("SAFETY", "Rehome complete, resuming previous mode.");
   }
 
   // ==================== SPEED-BASED STEPPER ENABLE ====================
   stepperUpdateSpeedBasedEnable(currentSpeedMph);
+}
 
-  // ==================== ERG/SIM MODE TARGET CALCULATION ====================
-  // Update target position based on current mode (20 Hz)
-  static uint32_t lastTargetUpdateMs = 0;
-  if (millis() - lastTargetUpdateMs >= 50) {
-    lastTargetUpdateMs = millis();
-    
-    switch (gMode) {
-      case MODE_ERG: {
-        // ERG mode: Calculate position from target watts and current speed
-        int32_t pos = (int32_t)lround(stepFromPowerSpeed(currentSpeedMph, ergTargetWatts));
-        targetLogicalPosition = constrain(pos, LOGICAL_MIN, LOGICAL_MAX);
-        break;
-      }
-      
-      case MODE_SIM: {
-        // SIM mode: Calculate position from grade and current speed
-        int32_t pos = (int32_t)lround(gradeToSteps(currentSpeedMph, simGradePercent));
-        targetLogicalPosition = constrain(pos, LOGICAL_MIN, LOGICAL_MAX);
-        break;
-      }
-      
-      case MODE_IDLE:
-      default:
-        // IDLE mode: Use speed-based resistance curve (calibratable)
-        targetLogicalPosition = idlePositionFromSpeed(currentSpeedMph);
-        break;
-    }
-    
-    // Apply manual override if active
-    if (gManualHoldActive) {
-      stepperSetTarget(gManualHoldTarget);
-    } else {
-      stepperSetTarget(targetLogicalPosition);
-    }
-  }
+static void controlTask(void* arg) {
+  TickType_t lastWake = xTaskGetTickCount();
+  uint32_t tick = 0;
 
-  // Notify BLE at regular intervals
-  if (deviceConnected && millis() - lastPowerNotifyMs >= POWER_NOTIFY_PERIOD_MS) {
-    lastPowerNotifyMs = millis();
-    bleNotifyPower(currentPowerWatts, currentSpeedMph, currentRPM);
+  for (;;) {
+    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(CONTROL_PERIOD_MS));
+    perfControlMark();
 
-    // Debug - show we're trying to notify
-    static uint32_t notifyAttempts = 0;
-    notifyAttempts++;
-    if (notifyAttempts % 50 == 0) {  // Every 50 notifications (5 seconds at 10Hz)
-      Serial.printf("[MAIN] BLE notify attempts: %lu (Power=%.0fW)\n", notifyAttempts, currentPowerWatts);
+    // Stepper housekeeping (step pulses come from the step timer ISR)
+    {
+      PERF_SCOPE(PERF_STEPPER);
+      stepperUpdate();
+      if (!replayActive()) controlSafety();
     }
-  }
 
-  // BLE keep-alive: periodically restart advertising to stay discoverable
-  bleKeepAlive();
+    // A replay in loop() owns sensors and target; an OTA upload parks the
+    // trainer (recorder paused). Either way the motor holds position.
+    if (replayActive() || gOtaInProgress) {
+      tick++;
+      continue;
+    }
 
-  // NO delay() - let loop run as fast as possible
-  yield();  // Just yield to WiFi stack
-}
+    // Read sensors
+    const bool newSample = (tick % SENSOR_TICKS == 0);
+    if (newSample) {
+      PERF_SCOPE(PERF_SENSORS);
+      sensorsUpdate();
+    }
 
-// ==================== BLE CONTROL POINT HANDLERS ====================
-// These are called from ble_trainer.cpp when Zwift sends commands
+    // Update target position based on current mode
+    if (tick % TARGET_TICKS == 0) {
+      PERF_SCOPE(PERF_TARGET);
+      stepperSetTarget(controlTargetUpdate(TARGET_TICKS * CONTROL_PERIOD_MS * 0.001f));
+    }
 
-void handleRequestControl() {
-  Serial.println("BLE: Request Control");
-  // Send success response
-  uint8_t response[3] = {0x80, 0x00, 0x01};  // Response, Request Control, Success
-  if (pControlPoint) {
-    pControlPoint->setValue(response, 3);
-    pControlPoint->indicate();
+    trainerStatePublish();
+    if (newSample) {
+      TrainerSnapshot snap;
+      trainerStateRead(&snap);
+      recorderSample(snap, hallLastIntervalUs());  // RAM only; loop() writes flash
+      if (gCommsTaskHandle != NULL) xTaskNotifyGive(gCommsTaskHandle);
+    }
+    tick++;
   }
 }
 
-void handleResetControl() {
-  Serial.println("BLE: Reset");
-  gMode = MODE_IDLE;
-  uint8_t response[3] = {0x80, 0x01, 0x01};  // Response, Reset, Success
-  if (pControlPoint) {
-    pControlPoint->setValue(response, 3);
-    pControlPoint->indicate();
-  }
-}
+// ==================== COMMS TASK ====================
+// BLE notifications, Control Point indications and the advertising manager
+// (may block in the stack).
+// Woken by the control task for each new sensor sample, so Indoor Bike Data
+// goes out as soon as there is something new to say.
+static void commsTask(void* arg) {
+  TrainerSnapshot snap;
+
+  for (;;) {
+    const bool newSample = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(BLE_COMMS_IDLE_WAIT_MS)) > 0;
+    trainerStateRead(&snap);
+
+    // Control Point responses queued by the control task (indications wait
+    // for the central's confirmation, so they go out from here)
+    bleSendResponses();
+
+    // Notify BLE with the fresh sample (rate limit and suppression in bleNotifyPower)
+    if (newSample && deviceConnected) {
+      PERF_SCOPE(PERF_BLE_NOTIFY);
+      bleNotifyPower(snap.powerWatts, snap.speedMph);
+    }
 
-void handleSetTargetPower(uint16_t watts) {
-  Serial.printf("BLE: Set Target Power = %d W\n", watts);
-  gMode = MODE_ERG;
-  ergTargetWatts = watts;
-  
-  uint8_t response[3] = {0x80, 0x05, 0x01};  // Response, Set Target Power, Success
-  if (pControlPoint) {
-    pControlPoint->setValue(response, 3);
-    pControlPoint->indicate();
+    // Advertising interval: fast after disconnect/activity, slow when idle
+    {
+      PERF_SCOPE(PERF_BLE_ADV);
+      bleAdvertisingUpdate(snap.rpm);
+    }
   }
 }
 
-void handleSetTargetResistance(uint8_t level) {
-  Serial.printf("BLE: Set Target Resistance = %d\n", level);
-  gMode = MODE_ERG;
-  
-  // Map resistance level to stepper position
-  int32_t target = map(level, 0, 100, LOGICAL_MIN, LOGICAL_MAX);
-  stepperSetTarget(target);
-  
-  uint8_t response[3] = {0x80, 0x04, 0x01};  // Response, Set Target Resistance, Success
-  if (pControlPoint) {
-    pControlPoint->setValue(response, 3);
-    pControlPoint->indicate();
+static void startTasks() {
+  trainerStatePublish();  // Valid snapshot before any reader runs
+
+  if (xTaskCreate(controlTask, "control", CONTROL_TASK_STACK, NULL, CONTROL_TASK_PRIORITY, NULL) != pdPASS) {
+    Serial.println("[TASK] ERROR: control task create failed");
   }
+  if (xTaskCreate(commsTask, "comms", COMMS_TASK_STACK, NULL, COMMS_TASK_PRIORITY, &gCommsTaskHandle) != pdPASS) {
+    Serial.println("[TASK] ERROR: comms task create failed");
+  }
+  Serial.printf("✓ Tasks started (control %lu ms @ prio %d, comms @ prio %d)\n",
+                (unsigned long)CONTROL_PERIOD_MS, CONTROL_TASK_PRIORITY, COMMS_TASK_PRIORITY);
 }
 
-void handleSetIndoorBikeSimulation(int16_t windSpeed, int16_t grade, uint8_t crr, uint8_t cw) {
-  float gradePercent = grade / 100.0f;
-  Serial.printf("BLE: Simulation Mode - Grade: %.1f%%\n", gradePercent);
-  
-  gMode = MODE_SIM;
-  simGradePercent = gradePercent;
+// ==================== MAIN LOOP ====================
+// Lowest priority: web server, LED, log output and recorder flash writes
+void loop() {
+  perfLoopMark();
+  perfService();
+  powerService();
+
+  // Handle web server requests
+  {
+    PERF_SCOPE(PERF_WEB);
+    webServerUpdate();
+  }
   
-  uint8_t response[3] = {0x80, 0x11, 0x01};  // Response, Set Indoor Bike Sim, Success
-  if (pControlPoint) {
-    pControlPoint->setValue(response, 3);
-    pControlPoint->indicate();
+  // Update LED (fast, non-blocking)
+  {
+    PERF_SCOPE(PERF_LED);
+    ledUpdate();
   }
-}
 
-void handleStartResume() {
-  Serial.println("BLE: Start/Resume");
-  // Could be used to enable stepper or other actions
-  
-  uint8_t response[3] = {0x80, 0x07, 0x01};  // Response, Start/Resume, Success
-  if (pControlPoint) {
-    pControlPoint->setValue(response, 3);
-    pControlPoint->indicate();
+  // Flush deferred log text only as far as the UART FIFO has room
+  {
+    PERF_SCOPE(PERF_LOG);
+    logDrain();
   }
-}
 
-void handleStopPause(uint8_t stopType) {
-  Serial.printf("BLE: Stop/Pause (type: %d)\n", stopType);
-  gMode = MODE_IDLE;
-  
-  uint8_t response[3] = {0x80, 0x08, 0x01};  // Response, Stop/Pause, Success
-  if (pControlPoint) {
-    pControlPoint->setValue(response, 3);
-    pControlPoint->indicate();
+  // Append handed-over recorder buffers to SPIFFS, run a replay slice,
+  // commit changed settings to NVS, advance the calibration sweep.
+  // Flash belongs to an OTA upload while one runs.
+  if (!gOtaInProgress) {
+    PERF_SCOPE(PERF_RECORDER);
+    recorderService();
+    replayService();
+    calibrationService();
+    sweepService();
   }
+
+  // Control runs in its own task; block briefly so the idle task gets time
+  // (while idle, until POWER_IDLE_LOOP_MS or a wake)
+  powerLoopWait();
 }
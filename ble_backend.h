@@ -0,0 +1,52 @@
+/*
+ * ble_backend.h - BLE Stack Backend Interface
+ *
+ * ble_trainer.cpp owns the FTMS protocol (frames, Control Point queue and
+ * dispatch, keep-alive policy, link bookkeeping). A backend owns the BLE
+ * stack: GATT database, Wahoo DIS spoofing, advertising and the raw
+ * notify/indicate calls, plus the central-role link to a Cycling Power
+ * meter used as the sweep reference (power_meter.cpp owns its protocol).
+ * Exactly one backend is compiled, chosen by
+ * BLE_USE_NIMBLE in config.h:
+ *   ble_backend_bluedroid.cpp - ESP32 Arduino BLE library (Bluedroid)
+ *   ble_backend_nimble.cpp    - NimBLE-Arduino 2.x
+ */
+
+#ifndef BLE_BACKEND_H
+#define BLE_BACKEND_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ==================== BACKEND (implemented per stack) ====================
+const char* bleBackendName();
+void bleBackendInit();                 // GATT services, DIS, advertising (fast interval)
+void bleBackendNotifyIndoorBike(const uint8_t* data, size_t len);
+void bleBackendNotifyStatus(const uint8_t* data, size_t len);
+void bleBackendIndicateControlPoint(const uint8_t* data, size_t len);
+// (Re)start advertising with a new interval (0.625 ms units); must not block
+void bleBackendStartAdvertising(uint16_t minUnits, uint16_t maxUnits);
+
+// Power meter (central role). Scans up to scanMs for a Cycling Power Service
+// (0x1818) advertiser - the given peer (MSB first) or, if NULL, the first one
+// found - connects and subscribes to Cycling Power Measurement (0x2A63).
+// Blocks for the scan and GATT discovery: call from a task of its own.
+bool bleBackendMeterConnect(const uint8_t* peer, uint32_t scanMs);
+void bleBackendMeterDisconnect();
+
+// ==================== STACK EVENTS (implemented in ble_trainer.cpp) ====================
+// Called by the backend from the BLE host task
+void bleOnConnect(const uint8_t* peer);
+void bleOnDisconnect();
+void bleOnControlPointWrite(const uint8_t* data, size_t len);
+void bleOnConnParams(uint16_t intervalUnits, uint16_t latency, uint16_t timeoutUnits);
+void bleOnMtu(uint16_t mtu);
+void bleOnDataLength(uint16_t txLen, uint16_t rxLen);
+void bleOnPhy(uint8_t txPhy, uint8_t rxPhy);
+
+// ==================== METER EVENTS (implemented in power_meter.cpp) ====================
+void bleOnMeterFound(const uint8_t* peer, const char* name);   // Chosen sensor, before connecting
+void bleOnMeterMeasurement(const uint8_t* data, size_t len);   // Raw 0x2A63 notification
+void bleOnMeterDisconnect();
+
+#endif // BLE_BACKEND_H
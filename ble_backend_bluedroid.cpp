@@ -0,0 +1,319 @@
+/*
+ * ble_backend_bluedroid.cpp - BLE Backend: ESP32 Arduino BLE (Bluedroid)
+ */
+
+#include "ble_backend.h"
+
+#if !BLE_USE_NIMBLE
+
+#include "log.h"
+#include <BLEDevice.h>
+#include <BLEServer.h>
+#include <BLEUtils.h>
+#include <BLE2902.h>
+#include <esp_gap_ble_api.h>
+
+// ==================== STACK OBJECTS ====================
+static BLEServer* pServer = NULL;
+static BLECharacteristic* pIndoorBike = NULL;
+static BLECharacteristic* pControlPoint = NULL;
+static BLECharacteristic* pFeature = NULL;
+static BLECharacteristic* pStatus = NULL;
+
+// Power meter link (central role)
+static BLEClient* pMeterClient = NULL;
+static uint8_t gMeterPeer[6];            // MSB first, the last meter we connected to
+static volatile bool gMeterPeerSet = false;
+
+// Bluedroid reports every LE link to the GATT server, including the one we
+// open to the meter; those events are not an FTMS central. The address is
+// kept after the meter drops: the server and client disconnect events come
+// in either order.
+static bool isMeterPeer(const uint8_t* bda) {
+  return gMeterPeerSet && memcmp(bda, gMeterPeer, sizeof(gMeterPeer)) == 0;
+}
+
+// ==================== LINK NEGOTIATION ====================
+
+// Ask the central for our preferred interval/latency, 2M PHY and long LL
+// packets. All of these are requests: the granted values arrive as GAP events.
+static void bleRequestLinkParams(esp_bd_addr_t bda) {
+  pServer->updateConnParams(bda, BLE_CONN_INTERVAL_MIN, BLE_CONN_INTERVAL_MAX,
+                            BLE_CONN_LATENCY, BLE_CONN_TIMEOUT);
+
+  esp_err_t err = esp_ble_gap_set_pkt_data_len(bda, BLE_DATA_LEN);
+  if (err != ESP_OK) LOG_W("BLE", "Data length request failed (%d)", (int)err);
+
+#if defined(CONFIG_BT_BLE_50_FEATURES_SUPPORTED)
+  if (BLE_PREFER_2M_PHY) {
+    const esp_ble_gap_phy_mask_t phys = ESP_BLE_GAP_PHY_1M_PREF_MASK | ESP_BLE_GAP_PHY_2M_PREF_MASK;
+    err = esp_ble_gap_set_preferred_phy(bda, 0, phys, phys, ESP_BLE_GAP_PHY_OPTIONS_NO_PREF);
+    if (err != ESP_OK) LOG_W("BLE", "PHY request failed (%d)", (int)err);
+  }
+#endif
+}
+
+static void bleGapHandler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param) {
+  switch (event) {
+    case ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT:
+      if (param->update_conn_params.status != ESP_BT_STATUS_SUCCESS) break;
+      bleOnConnParams(param->update_conn_params.conn_int,
+                      param->update_conn_params.latency,
+                      param->update_conn_params.timeout);
+      break;
+
+    case ESP_GAP_BLE_SET_PKT_LENGTH_COMPLETE_EVT:
+      if (param->pkt_data_length_cmpl.status != ESP_BT_STATUS_SUCCESS) break;
+      bleOnDataLength(param->pkt_data_length_cmpl.params.tx_len,
+                      param->pkt_data_length_cmpl.params.rx_len);
+      break;
+
+#if defined(CONFIG_BT_BLE_50_FEATURES_SUPPORTED)
+    case ESP_GAP_BLE_PHY_UPDATE_COMPLETE_EVT:
+      if (param->phy_update.status != ESP_BT_STATUS_SUCCESS) break;
+      bleOnPhy(param->phy_update.tx_phy, param->phy_update.rx_phy);
+      break;
+#endif
+
+    default:
+      break;
+  }
+}
+
+// ==================== BLE CALLBACKS ====================
+
+class MyServerCallbacks : public BLEServerCallbacks {
+  void onConnect(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) {
+    if (isMeterPeer(param->connect.remote_bda)) return;
+    bleOnConnect(param->connect.remote_bda);
+    bleRequestLinkParams(param->connect.remote_bda);
+  }
+
+  void onDisconnect(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) {
+    if (isMeterPeer(param->disconnect.remote_bda)) return;
+    bleOnDisconnect();  // The advertising manager restarts advertising
+  }
+
+  void onMtuChanged(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) {
+    bleOnMtu(param->mtu.mtu);
+  }
+};
+
+class ControlPointCallbacks : public BLECharacteristicCallbacks {
+  void onWrite(BLECharacteristic* pCharacteristic) override {
+    String value = pCharacteristic->getValue();  // NOT .c_str()!
+    
+    if (value.length() < 1) return;
+
+    bleOnControlPointWrite((const uint8_t*)value.c_str(), value.length());
+  }
+};
+
+class MeterClientCallbacks : public BLEClientCallbacks {
+  void onConnect(BLEClient* pClient) {}
+
+  void onDisconnect(BLEClient* pClient) {
+    bleOnMeterDisconnect();
+  }
+};
+
+static void meterNotify(BLERemoteCharacteristic* pChar, uint8_t* data, size_t len, bool isNotify) {
+  bleOnMeterMeasurement(data, len);
+}
+
+// ==================== BACKEND ====================
+
+const char* bleBackendName() {
+  return "ESP32 BLE";
+}
+
+void bleBackendInit() {
+  // Initialize BLE with Wahoo name
+  BLEDevice::init(BLE_DEVICE_NAME);
+  BLEDevice::setMTU(BLE_LOCAL_MTU);
+  BLEDevice::setCustomGapHandler(bleGapHandler);
+
+  // Create BLE Server
+  pServer = BLEDevice::createServer();
+  pServer->setCallbacks(new MyServerCallbacks());
+  Serial.println("  BLE Server created");
+
+  // ===== Create Services First (before adding characteristics) =====
+  // FTMS service needs more handles: 4 characteristics × 3 handles each + 1 service = 13
+  // Using 15 to be safe (default is often too small and causes crashes)
+  BLEService* pService = pServer->createService(BLEUUID((uint16_t)0x1826), 15);  // FTMS
+  BLEService* pDis = pServer->createService(BLEUUID((uint16_t)0x180A), 10);      // Device Info
+
+  // ===== Device Information Service Characteristics =====
+  BLECharacteristic* chMan = pDis->createCharacteristic(
+    BLEUUID((uint16_t)0x2A29), 
+    BLECharacteristic::PROPERTY_READ
+  );
+  chMan->setValue(BLE_MANUFACTURER);  // "Wahoo Fitness"
+  
+  BLECharacteristic* chModel = pDis->createCharacteristic(
+    BLEUUID((uint16_t)0x2A24), 
+    BLECharacteristic::PROPERTY_READ
+  );
+  chModel->setValue(BLE_MODEL);  // "KICKR"
+  
+  BLECharacteristic* chFw = pDis->createCharacteristic(
+    BLEUUID((uint16_t)0x2A26), 
+    BLECharacteristic::PROPERTY_READ
+  );
+  chFw->setValue(BLE_FIRMWARE_VERSION);  // "4.10.0"
+  
+  Serial.println("  Device Info Service configured (Wahoo spoofing)");
+
+  // ===== FTMS Service Characteristics =====
+  Serial.println("  Creating FTMS characteristics...");
+  
+  // Indoor Bike Data (0x2AD2)
+  pIndoorBike = pService->createCharacteristic(
+    BLEUUID((uint16_t)0x2AD2),
+    BLECharacteristic::PROPERTY_NOTIFY
+  );
+  pIndoorBike->addDescriptor(new BLE2902());
+
+  // Fitness Machine Control Point (0x2AD9)
+  pControlPoint = pService->createCharacteristic(
+    BLEUUID((uint16_t)0x2AD9),
+    BLECharacteristic::PROPERTY_INDICATE | BLECharacteristic::PROPERTY_WRITE
+  );
+  pControlPoint->addDescriptor(new BLE2902());
+
+  // Fitness Machine Feature (0x2ACC)
+  pFeature = pService->createCharacteristic(
+    BLEUUID((uint16_t)0x2ACC),
+    BLECharacteristic::PROPERTY_READ
+  );
+  // NOTE: Working code does NOT set value - leave default/empty
+  pFeature->addDescriptor(new BLE2902());
+
+  // Training Status (0x2ADA)
+  pStatus = pService->createCharacteristic(
+    BLEUUID((uint16_t)0x2ADA),
+    BLECharacteristic::PROPERTY_NOTIFY
+  );
+  pStatus->addDescriptor(new BLE2902());
+  
+  // Set callbacks AFTER all characteristics created (matches working code)
+  static ControlPointCallbacks cpCallbacks;
+  pControlPoint->setCallbacks(&cpCallbacks);
+
+  Serial.println("  FTMS Service configured");
+
+  // Start FTMS service first
+  Serial.println("  Starting FTMS service...");
+  pService->start();
+  delay(100);  // Allow BLE stack to stabilize
+  Serial.println("  FTMS service started");
+
+  // ===== Start Advertising =====
+  BLEAdvertising* pAdvertising = BLEDevice::getAdvertising();
+  pAdvertising->stop();
+  
+  // Set advertising data
+  BLEAdvertisementData advData;
+  advData.setFlags(0x06);
+  advData.addData(String("\x03\x03\x26\x18", 4));  // FTMS service UUID
+  
+  BLEAdvertisementData scanData;
+  scanData.setName(BLE_DEVICE_NAME);
+  
+  pAdvertising->setAdvertisementData(advData);
+  pAdvertising->setScanResponseData(scanData);
+  pAdvertising->setMinPreferred(0x06);
+  pAdvertising->setMaxPreferred(0x12);
+  pAdvertising->setMinInterval(BLE_ADV_FAST_MIN_UNITS);
+  pAdvertising->setMaxInterval(BLE_ADV_FAST_MAX_UNITS);
+  
+  pAdvertising->start();
+  delay(50);  // Allow advertising to stabilize
+
+  // Start Device Info Service AFTER advertising (matches working code)
+  Serial.println("  Starting Device Info service...");
+  pDis->start();
+  delay(50);  // Allow service to stabilize
+}
+
+void bleBackendNotifyIndoorBike(const uint8_t* data, size_t len) {
+  if (pIndoorBike == NULL) return;
+  pIndoorBike->setValue((uint8_t*)data, len);
+  pIndoorBike->notify();
+}
+
+void bleBackendNotifyStatus(const uint8_t* data, size_t len) {
+  if (pStatus == NULL) return;
+  pStatus->setValue((uint8_t*)data, len);
+  pStatus->notify();
+}
+
+void bleBackendIndicateControlPoint(const uint8_t* data, size_t len) {
+  if (pControlPoint == NULL) return;
+  pControlPoint->setValue((uint8_t*)data, len);
+  pControlPoint->indicate();
+}
+
+void bleBackendStartAdvertising(uint16_t minUnits, uint16_t maxUnits) {
+  // New timing only applies on (re)start; stop/start just queue HCI commands
+  BLEAdvertising* pAdvertising = BLEDevice::getAdvertising();
+  pAdvertising->stop();
+  pAdvertising->setMinInterval(minUnits);
+  pAdvertising->setMaxInterval(maxUnits);
+  pAdvertising->start();
+}
+
+bool bleBackendMeterConnect(const uint8_t* peer, uint32_t scanMs) {
+  const BLEUUID cpsUuid((uint16_t)0x1818);
+  BLEScan* pScan = BLEDevice::getScan();
+  pScan->setActiveScan(true);   // Names come in the scan response
+  pScan->setInterval(100);
+  pScan->setWindow(99);
+  BLEScanResults* results = pScan->start((scanMs + 999) / 1000, false);
+
+  bool found = false;
+  BLEAdvertisedDevice device;
+  for (int i = 0; results != NULL && i < results->getCount() && !found; i++) {
+    device = results->getDevice(i);
+    if (!device.isAdvertisingService(cpsUuid)) continue;
+    const uint8_t* bda = *device.getAddress().getNative();
+    found = (peer == NULL || memcmp(bda, peer, 6) == 0);
+  }
+  pScan->clearResults();
+  if (!found) {
+    LOG_W("METER", "No Cycling Power sensor found");
+    return false;
+  }
+
+  gMeterPeerSet = false;
+  memcpy(gMeterPeer, *device.getAddress().getNative(), sizeof(gMeterPeer));
+  gMeterPeerSet = true;   // Before connecting: the server sees the link first
+  bleOnMeterFound(gMeterPeer, device.haveName() ? device.getName().c_str() : "");
+
+  if (pMeterClient == NULL) {
+    pMeterClient = BLEDevice::createClient();
+    pMeterClient->setClientCallbacks(new MeterClientCallbacks());
+  }
+  if (!pMeterClient->connect(&device)) {
+    LOG_W("METER", "Connect failed");
+    return false;
+  }
+
+  BLERemoteService* pService = pMeterClient->getService(cpsUuid);
+  BLERemoteCharacteristic* pMeasurement =
+      pService ? pService->getCharacteristic(BLEUUID((uint16_t)0x2A63)) : NULL;
+  if (pMeasurement == NULL || !pMeasurement->canNotify()) {
+    LOG_W("METER", "No Cycling Power Measurement characteristic");
+    pMeterClient->disconnect();
+    return false;
+  }
+  pMeasurement->registerForNotify(meterNotify);
+  return true;
+}
+
+void bleBackendMeterDisconnect() {
+  if (pMeterClient != NULL && pMeterClient->isConnected()) pMeterClient->disconnect();
+}
+
+#endif // !BLE_USE_NIMBLE
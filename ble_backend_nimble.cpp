@@ -0,0 +1,252 @@
+/*
+ * ble_backend_nimble.cpp - BLE Backend: NimBLE-Arduino 2.x
+ *
+ * Same GATT database, DIS strings and advertising payload as the Bluedroid
+ * backend, so Zwift sees an identical trainer. Differences:
+ * - CCCDs (0x2902) are created by NimBLE for NOTIFY/INDICATE characteristics
+ *   only, so the read-only Feature characteristic has none.
+ * - NimBLE does not report the granted LL data length; ble_link tx_len/rx_len
+ *   stay 0.
+ * - Links we open as a central (the power meter) get their own client
+ *   callbacks, so the server callbacks only ever see FTMS centrals.
+ */
+
+#include "ble_backend.h"
+
+#if BLE_USE_NIMBLE
+
+#include "log.h"
+#include <NimBLEDevice.h>
+
+// ==================== STACK OBJECTS ====================
+static NimBLEServer* pServer = NULL;
+static NimBLECharacteristic* pIndoorBike = NULL;
+static NimBLECharacteristic* pControlPoint = NULL;
+static NimBLECharacteristic* pFeature = NULL;
+static NimBLECharacteristic* pStatus = NULL;
+static NimBLEClient* pMeterClient = NULL;
+
+// ==================== LINK NEGOTIATION ====================
+
+// Same requests as the Bluedroid backend; the granted values arrive in the
+// server callbacks below
+static void bleRequestLinkParams(uint16_t connHandle) {
+  pServer->updateConnParams(connHandle, BLE_CONN_INTERVAL_MIN, BLE_CONN_INTERVAL_MAX,
+                            BLE_CONN_LATENCY, BLE_CONN_TIMEOUT);
+
+  if (!pServer->setDataLen(connHandle, BLE_DATA_LEN)) {
+    LOG_W("BLE", "Data length request failed");
+  }
+
+  if (BLE_PREFER_2M_PHY) {
+    const uint8_t phys = BLE_GAP_LE_PHY_1M_MASK | BLE_GAP_LE_PHY_2M_MASK;
+    if (!pServer->updatePhy(connHandle, phys, phys, 0)) {
+      LOG_W("BLE", "PHY request failed");
+    }
+  }
+}
+
+// ==================== BLE CALLBACKS ====================
+
+class MyServerCallbacks : public NimBLEServerCallbacks {
+  void onConnect(NimBLEServer* pServer, NimBLEConnInfo& connInfo) override {
+    // NimBLE stores addresses LSB first; Bluedroid (and ble_link) MSB first
+    const uint8_t* lsbFirst = connInfo.getAddress().getVal();
+    uint8_t peer[6];
+    for (int i = 0; i < 6; i++) peer[i] = lsbFirst[5 - i];
+
+    bleOnConnect(peer);
+    bleOnConnParams(connInfo.getConnInterval(), connInfo.getConnLatency(),
+                    connInfo.getConnTimeout());
+    bleRequestLinkParams(connInfo.getConnHandle());
+  }
+
+  void onDisconnect(NimBLEServer* pServer, NimBLEConnInfo& connInfo, int reason) override {
+    bleOnDisconnect();  // The advertising manager restarts advertising
+  }
+
+  void onMTUChange(uint16_t mtu, NimBLEConnInfo& connInfo) override {
+    bleOnMtu(mtu);
+  }
+
+  void onConnParamsUpdate(NimBLEConnInfo& connInfo) override {
+    bleOnConnParams(connInfo.getConnInterval(), connInfo.getConnLatency(),
+                    connInfo.getConnTimeout());
+  }
+
+  void onPhyUpdate(NimBLEConnInfo& connInfo, uint8_t txPhy, uint8_t rxPhy) override {
+    bleOnPhy(txPhy, rxPhy);
+  }
+};
+
+class ControlPointCallbacks : public NimBLECharacteristicCallbacks {
+  void onWrite(NimBLECharacteristic* pCharacteristic, NimBLEConnInfo& connInfo) override {
+    NimBLEAttValue value = pCharacteristic->getValue();
+    if (value.length() < 1) return;
+
+    bleOnControlPointWrite(value.data(), value.length());
+  }
+};
+
+class MeterClientCallbacks : public NimBLEClientCallbacks {
+  void onDisconnect(NimBLEClient* pClient, int reason) override {
+    bleOnMeterDisconnect();
+  }
+};
+
+static void meterNotify(NimBLERemoteCharacteristic* pChar, uint8_t* data, size_t len, bool isNotify) {
+  bleOnMeterMeasurement(data, len);
+}
+
+// ==================== BACKEND ====================
+
+static void setString(NimBLECharacteristic* ch, const char* s) {
+  ch->setValue((const uint8_t*)s, strlen(s));
+}
+
+const char* bleBackendName() {
+  return "NimBLE";
+}
+
+void bleBackendInit() {
+  // Initialize BLE with Wahoo name
+  NimBLEDevice::init(BLE_DEVICE_NAME);
+  NimBLEDevice::setMTU(BLE_LOCAL_MTU);
+
+  // Create BLE Server
+  pServer = NimBLEDevice::createServer();
+  static MyServerCallbacks serverCallbacks;
+  pServer->setCallbacks(&serverCallbacks, false);
+  pServer->advertiseOnDisconnect(false);  // Owned by the advertising manager
+  Serial.println("  BLE Server created");
+
+  // ===== Services (same order as Bluedroid: FTMS, then Device Info) =====
+  NimBLEService* pService = pServer->createService(NimBLEUUID((uint16_t)0x1826));  // FTMS
+  NimBLEService* pDis = pServer->createService(NimBLEUUID((uint16_t)0x180A));      // Device Info
+
+  // ===== Device Information Service Characteristics =====
+  setString(pDis->createCharacteristic(NimBLEUUID((uint16_t)0x2A29), NIMBLE_PROPERTY::READ),
+            BLE_MANUFACTURER);  // "Wahoo Fitness"
+  setString(pDis->createCharacteristic(NimBLEUUID((uint16_t)0x2A24), NIMBLE_PROPERTY::READ),
+            BLE_MODEL);  // "KICKR"
+  setString(pDis->createCharacteristic(NimBLEUUID((uint16_t)0x2A26), NIMBLE_PROPERTY::READ),
+            BLE_FIRMWARE_VERSION);  // "4.10.0"
+  Serial.println("  Device Info Service configured (Wahoo spoofing)");
+
+  // ===== FTMS Service Characteristics =====
+  pIndoorBike = pService->createCharacteristic(
+    NimBLEUUID((uint16_t)0x2AD2), NIMBLE_PROPERTY::NOTIFY);
+  pControlPoint = pService->createCharacteristic(
+    NimBLEUUID((uint16_t)0x2AD9), NIMBLE_PROPERTY::INDICATE | NIMBLE_PROPERTY::WRITE);
+  pFeature = pService->createCharacteristic(
+    NimBLEUUID((uint16_t)0x2ACC), NIMBLE_PROPERTY::READ);  // Left empty, like Bluedroid
+  pStatus = pService->createCharacteristic(
+    NimBLEUUID((uint16_t)0x2ADA), NIMBLE_PROPERTY::NOTIFY);
+
+  static ControlPointCallbacks cpCallbacks;
+  pControlPoint->setCallbacks(&cpCallbacks);
+  Serial.println("  FTMS Service configured");
+
+  pService->start();
+  pDis->start();
+
+  // ===== Start Advertising (same payload as Bluedroid) =====
+  NimBLEAdvertising* pAdvertising = NimBLEDevice::getAdvertising();
+
+  NimBLEAdvertisementData advData;
+  advData.setFlags(0x06);
+  static const uint8_t ftmsUuid[] = {0x03, 0x03, 0x26, 0x18};  // FTMS service UUID
+  advData.addData(ftmsUuid, sizeof(ftmsUuid));
+
+  NimBLEAdvertisementData scanData;
+  scanData.setName(BLE_DEVICE_NAME);
+
+  pAdvertising->setAdvertisementData(advData);
+  pAdvertising->setScanResponseData(scanData);
+  pAdvertising->enableScanResponse(true);
+  pAdvertising->setPreferredParams(0x06, 0x12);
+  pAdvertising->setMinInterval(BLE_ADV_FAST_MIN_UNITS);
+  pAdvertising->setMaxInterval(BLE_ADV_FAST_MAX_UNITS);
+  pAdvertising->start();
+}
+
+void bleBackendNotifyIndoorBike(const uint8_t* data, size_t len) {
+  if (pIndoorBike == NULL) return;
+  pIndoorBike->setValue(data, len);
+  pIndoorBike->notify();
+}
+
+void bleBackendNotifyStatus(const uint8_t* data, size_t len) {
+  if (pStatus == NULL) return;
+  pStatus->setValue(data, len);
+  pStatus->notify();
+}
+
+void bleBackendIndicateControlPoint(const uint8_t* data, size_t len) {
+  if (pControlPoint == NULL) return;
+  pControlPoint->setValue(data, len);
+  pControlPoint->indicate();
+}
+
+void bleBackendStartAdvertising(uint16_t minUnits, uint16_t maxUnits) {
+  // New timing only applies on (re)start; stop/start just queue HCI commands
+  NimBLEAdvertising* pAdvertising = NimBLEDevice::getAdvertising();
+  pAdvertising->stop();
+  pAdvertising->setMinInterval(minUnits);
+  pAdvertising->setMaxInterval(maxUnits);
+  pAdvertising->start();
+}
+
+bool bleBackendMeterConnect(const uint8_t* peer, uint32_t scanMs) {
+  const NimBLEUUID cpsUuid((uint16_t)0x1818);
+  NimBLEScan* pScan = NimBLEDevice::getScan();
+  pScan->setActiveScan(true);   // Names come in the scan response
+  pScan->setInterval(100);
+  pScan->setWindow(99);
+  NimBLEScanResults results = pScan->getResults(scanMs, false);
+
+  const NimBLEAdvertisedDevice* device = NULL;
+  uint8_t bda[6];
+  for (int i = 0; i < results.getCount() && device == NULL; i++) {
+    const NimBLEAdvertisedDevice* d = results.getDevice(i);
+    if (!d->isAdvertisingService(cpsUuid)) continue;
+    const uint8_t* lsbFirst = d->getAddress().getVal();
+    for (int b = 0; b < 6; b++) bda[b] = lsbFirst[5 - b];
+    if (peer == NULL || memcmp(bda, peer, 6) == 0) device = d;
+  }
+  if (device == NULL) {
+    pScan->clearResults();
+    LOG_W("METER", "No Cycling Power sensor found");
+    return false;
+  }
+  bleOnMeterFound(bda, device->haveName() ? device->getName().c_str() : "");
+
+  if (pMeterClient == NULL) {
+    pMeterClient = NimBLEDevice::createClient();
+    static MeterClientCallbacks meterCallbacks;
+    pMeterClient->setClientCallbacks(&meterCallbacks, false);
+  }
+  const bool connected = pMeterClient->connect(device);
+  pScan->clearResults();   // Owns *device
+  if (!connected) {
+    LOG_W("METER", "Connect failed");
+    return false;
+  }
+
+  NimBLERemoteService* pService = pMeterClient->getService(cpsUuid);
+  NimBLERemoteCharacteristic* pMeasurement =
+      pService ? pService->getCharacteristic(NimBLEUUID((uint16_t)0x2A63)) : NULL;
+  if (pMeasurement == NULL || !pMeasurement->canNotify() ||
+      !pMeasurement->subscribe(true, meterNotify)) {
+    LOG_W("METER", "No Cycling Power Measurement characteristic");
+    pMeterClient->disconnect();
+    return false;
+  }
+  return true;
+}
+
+void bleBackendMeterDisconnect() {
+  if (pMeterClient != NULL && pMeterClient->isConnected()) pMeterClient->disconnect();
+}
+
+#endif // BLE_USE_NIMBLE
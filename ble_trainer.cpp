@@ -1,337 +1,531 @@
 /*
- * ble_trainer.cpp - BLE FTMS Trainer Implementation (ESP32 BLE - NOT NimBLE)
+ * ble_trainer.cpp - BLE FTMS Trainer Implementation
+ *
+ * Stack-independent FTMS protocol; the BLE stack itself lives behind
+ * ble_backend.h.
  */
 
 #include "ble_trainer.h"
-#include <BLEDevice.h>
-#include <BLEServer.h>
-#include <BLEUtils.h>
-#include <BLE2902.h>
+#include "ble_backend.h"
+#include "power.h"
+#include "replay.h"
+#include "log.h"
+#include <esp_timer.h>
 
 // ==================== BLE GLOBAL STATE ====================
 bool deviceConnected = false;
-BLEServer* pServer = NULL;
-BLECharacteristic* pIndoorBike = NULL;
-BLECharacteristic* pControlPoint = NULL;
-BLECharacteristic* pFeature = NULL;
-BLECharacteristic* pStatus = NULL;
 
-// Indoor Bike Data flags
+// Indoor Bike Data flags. Bit 0 is "More Data": when CLEAR, Instantaneous
+// Speed is present, so speed is always the first field after the flags.
+static constexpr uint16_t IB_FLAG_MORE_DATA = (1 << 0);
 static constexpr uint16_t IB_FLAG_INSTANT_CADENCE = (1 << 2);
 static constexpr uint16_t IB_FLAG_INSTANT_POWER = (1 << 6);
-static constexpr uint16_t FTMS_INDOOR_BIKE_FLAGS = (IB_FLAG_INSTANT_CADENCE | IB_FLAG_INSTANT_POWER);
-
-static uint8_t FTMS_INDOOR_BIKE_DATA[10] = {
-  (uint8_t)(FTMS_INDOOR_BIKE_FLAGS & 0xFF),
-  (uint8_t)(FTMS_INDOOR_BIKE_FLAGS >> 8),
-  0x00, 0x00,  // Speed (not used)
-  0x00, 0x00,  // Cadence
-  0x00, 0x00,  // Power
-  0x00, 0x00   // Padding
+
+// Largest frame we build: flags + speed + cadence + power
+static constexpr size_t IB_FRAME_MAX = 8;
+static constexpr float MPH_TO_KMH = 1.609344f;
+
+// Last frame sent (for unchanged-frame suppression)
+static uint8_t gIbLast[IB_FRAME_MAX];
+static size_t gIbLastLen = 0;
+static uint32_t gIbLastSentMs = 0;
+static uint32_t gIbSent = 0;
+static uint32_t gIbSuppressed = 0;
+
+// ==================== BLE LINK ====================
+// Written from the BLE host task (GATTS/GAP callbacks), read by the web server
+static BleLinkInfo gLink = {};
+static portMUX_TYPE gLinkMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Advertising manager state (see ADVERTISING MANAGER)
+static BleAdvState gAdvState = BLE_ADV_FAST;     // bleBackendInit() starts fast
+static uint32_t gAdvSinceMs = 0;
+static uint32_t gAdvLastActivityMs = 0;
+static uint32_t gAdvBootUs = 0;                  // Boot-to-advertising
+static uint32_t gAdvChanges = 0;
+static volatile bool gAdvFastRequest = false;    // Set from the BLE task on disconnect
+
+void bleGetLinkInfo(BleLinkInfo* out) {
+  portENTER_CRITICAL(&gLinkMux);
+  *out = gLink;
+  portEXIT_CRITICAL(&gLinkMux);
+}
+
+// ==================== STACK EVENTS ====================
+
+void bleOnConnect(const uint8_t* peer) {
+  deviceConnected = true;
+
+  portENTER_CRITICAL(&gLinkMux);
+  const uint32_t connects = gLink.connects + 1;
+  gLink = {};
+  gLink.connected = true;
+  memcpy(gLink.peer, peer, sizeof(gLink.peer));
+  gLink.txPhy = gLink.rxPhy = 1;  // Every connection starts on 1M
+  gLink.mtu = 23;                 // ATT default until the exchange completes
+  gLink.connectMs = millis();
+  gLink.connects = connects;
+  portEXIT_CRITICAL(&gLinkMux);
+
+  powerActivity(POWER_WAKE_BLE);
+  LOG_I("BLE", "Client connected");
+}
+
+void bleOnDisconnect() {
+  deviceConnected = false;
+  gAdvFastRequest = true;  // Comms task restarts advertising (fast)
+  portENTER_CRITICAL(&gLinkMux);
+  gLink.connected = false;
+  portEXIT_CRITICAL(&gLinkMux);
+  LOG_I("BLE", "Client disconnected");
+}
+
+void bleOnConnParams(uint16_t intervalUnits, uint16_t latency, uint16_t timeoutUnits) {
+  portENTER_CRITICAL(&gLinkMux);
+  gLink.intervalUnits = intervalUnits;
+  gLink.latency = latency;
+  gLink.timeoutUnits = timeoutUnits;
+  portEXIT_CRITICAL(&gLinkMux);
+  LOG_I("BLE", "Conn params: interval %.2f ms, latency %u, timeout %u ms",
+        intervalUnits * 1.25f, (unsigned)latency, (unsigned)timeoutUnits * 10);
+}
+
+void bleOnMtu(uint16_t mtu) {
+  portENTER_CRITICAL(&gLinkMux);
+  gLink.mtu = mtu;
+  portEXIT_CRITICAL(&gLinkMux);
+  LOG_I("BLE", "MTU: %u", (unsigned)mtu);
+}
+
+void bleOnDataLength(uint16_t txLen, uint16_t rxLen) {
+  portENTER_CRITICAL(&gLinkMux);
+  gLink.txLen = txLen;
+  gLink.rxLen = rxLen;
+  portEXIT_CRITICAL(&gLinkMux);
+  LOG_I("BLE", "Data length: tx %u, rx %u", (unsigned)txLen, (unsigned)rxLen);
+}
+
+void bleOnPhy(uint8_t txPhy, uint8_t rxPhy) {
+  portENTER_CRITICAL(&gLinkMux);
+  gLink.txPhy = txPhy;
+  gLink.rxPhy = rxPhy;
+  portEXIT_CRITICAL(&gLinkMux);
+  LOG_I("BLE", "PHY: tx %u, rx %u", (unsigned)txPhy, (unsigned)rxPhy);
+}
+
+// ==================== CONTROL POINT COMMAND QUEUE ====================
+// Single-producer (BLE task) / single-consumer (loop) ring. Each side owns
+// one index; the fence orders the slot write before the index publish.
+static constexpr uint8_t CMD_QUEUE_SIZE = 16;  // Power of two
+static FtmsCommand gCmdQueue[CMD_QUEUE_SIZE];
+static volatile uint8_t gCmdHead = 0;   // Written by producer only
+static volatile uint8_t gCmdTail = 0;   // Written by consumer only
+static volatile uint32_t gCmdDropped = 0;
+
+static bool cmdQueuePush(const FtmsCommand& cmd) {
+  uint8_t head = gCmdHead;
+  uint8_t next = (head + 1) & (CMD_QUEUE_SIZE - 1);
+  if (next == gCmdTail) {
+    gCmdDropped++;
+    return false;
+  }
+  gCmdQueue[head] = cmd;
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  gCmdHead = next;
+  return true;
+}
+
+static bool cmdQueuePop(FtmsCommand* cmd) {
+  uint8_t tail = gCmdTail;
+  if (tail == gCmdHead) return false;
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  *cmd = gCmdQueue[tail];
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  gCmdTail = (tail + 1) & (CMD_QUEUE_SIZE - 1);
+  return true;
+}
+
+// ==================== CONTROL POINT RESPONSE QUEUE ====================
+// Single-producer (control task, via the dispatcher) / single-consumer
+// (comms task) ring, same scheme as the command queue. An indication waits
+// for the central's confirmation (a connection interval or more), so it
+// never goes out from the control task.
+struct FtmsResponse {
+  uint8_t opcode;
+  uint8_t result;
 };
 
-// ==================== BLE CALLBACKS ====================
+static FtmsResponse gRspQueue[CMD_QUEUE_SIZE];
+static volatile uint8_t gRspHead = 0;   // Written by producer only
+static volatile uint8_t gRspTail = 0;   // Written by consumer only
+static volatile uint32_t gRspDropped = 0;
+
+static bool rspQueuePush(const FtmsResponse& rsp) {
+  uint8_t head = gRspHead;
+  uint8_t next = (head + 1) & (CMD_QUEUE_SIZE - 1);
+  if (next == gRspTail) {
+    gRspDropped++;
+    return false;
+  }
+  gRspQueue[head] = rsp;
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  gRspHead = next;
+  return true;
+}
+
+// A write refused while a replay runs, 0x100 | opcode (BLE task -> comms
+// task). One slot: a central waits for the response before its next write.
+static volatile uint16_t gCpRefused = 0;
+static volatile uint32_t gCpRefusedCount = 0;
+
+static bool rspQueuePop(FtmsResponse* rsp) {
+  uint8_t tail = gRspTail;
+  if (tail == gRspHead) return false;
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  *rsp = gRspQueue[tail];
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  gRspTail = (tail + 1) & (CMD_QUEUE_SIZE - 1);
+  return true;
+}
 
-class MyServerCallbacks : public BLEServerCallbacks {
-  void onConnect(BLEServer* pServer) {
-    deviceConnected = true;
-    Serial.println("BLE Client connected");
+// Parse only: no serial output, no state changes, no indications here
+static void parseControlPoint(const uint8_t* data, size_t len, FtmsCommand* cmd) {
+  memset(cmd, 0, sizeof(*cmd));
+  cmd->opcode = data[0];
+  cmd->length = (uint8_t)min(len, (size_t)255);
+  cmd->result = FTMS_RESULT_SUCCESS;
+
+  switch (cmd->opcode) {
+    case FTMS_OP_REQUEST_CONTROL:
+    case FTMS_OP_RESET:
+    case FTMS_OP_START_RESUME:
+      break;
+
+    case FTMS_OP_SET_TARGET_POWER:
+      if (len >= 3) {
+        cmd->value = (int16_t)(data[1] | (data[2] << 8));
+      } else {
+        cmd->result = FTMS_RESULT_INVALID_PARAM;
+      }
+      break;
+
+    case FTMS_OP_SET_RESISTANCE:
+    case FTMS_OP_STOP_PAUSE:
+      if (len >= 2) {
+        cmd->level = data[1];
+      } else {
+        cmd->result = FTMS_RESULT_INVALID_PARAM;
+      }
+      break;
+
+    case FTMS_OP_SET_SIMULATION:
+      if (len >= 7) {
+        cmd->windSpeed = (int16_t)(data[1] | (data[2] << 8));
+        cmd->value = (int16_t)(data[3] | (data[4] << 8));
+        cmd->crr = data[5];
+        cmd->cw = data[6];
+      } else {
+        cmd->result = FTMS_RESULT_INVALID_PARAM;
+      }
+      break;
+
+    default:
+      cmd->result = FTMS_RESULT_NOT_SUPPORTED;
+      break;
   }
+}
+
+void bleOnControlPointWrite(const uint8_t* data, size_t len) {
+  if (len < 1) return;
 
-  void onDisconnect(BLEServer* pServer) {
-    deviceConnected = false;
-    Serial.println("BLE Client disconnected");
-    // Restart advertising
-    BLEDevice::getAdvertising()->start();
+  // Replay owns the control state (and dispatches its own commands): a real
+  // write is answered "operation failed" and never reaches the queue
+  if (replayActive()) {
+    gCpRefused = 0x100 | data[0];
+    gCpRefusedCount++;
+    return;
   }
-};
 
-class ControlPointCallbacks : public BLECharacteristicCallbacks {
-  void onWrite(BLECharacteristic* pCharacteristic) override {
-    Serial.println("[BLE CP] *** onWrite() CALLED ***");
-    
-    String value = pCharacteristic->getValue();  // NOT .c_str()!
-    
-    if (value.length() < 1) return;
-    
-    uint8_t opcode = value[0];
-    
-    Serial.printf("[BLE CP] Opcode 0x%02X received, length=%d, bytes: ", opcode, value.length());
-    for (int i = 0; i < value.length() && i < 12; i++) {
-      Serial.printf("%02X ", (uint8_t)value[i]);
-    }
-    Serial.println();
-    
-    switch (opcode) {
-      case 0x00:  // Request Control
-        Serial.println("[BLE CP] -> Request Control");
-        handleRequestControl();
-        break;
-        
-      case 0x01:  // Reset
-        Serial.println("[BLE CP] -> Reset");
-        handleResetControl();
-        break;
-        
-      case 0x05:  // Set Target Power
-        if (value.length() >= 3) {
-          uint16_t watts = (uint8_t)value[1] | ((uint8_t)value[2] << 8);
-          Serial.printf("[BLE CP] -> Set Target Power: %d W\n", watts);
-          handleSetTargetPower(watts);
-        }
-        break;
-        
-      case 0x04:  // Set Target Resistance Level
-        if (value.length() >= 2) {
-          uint8_t level = value[1];
-          Serial.printf("[BLE CP] -> Set Target Resistance: %d\n", level);
-          handleSetTargetResistance(level);
-        }
-        break;
-        
-      case 0x11:  // Set Indoor Bike Simulation Parameters
-        if (value.length() >= 7) {
-          int16_t windSpeed = (uint8_t)value[1] | ((uint8_t)value[2] << 8);
-          int16_t grade = (uint8_t)value[3] | ((uint8_t)value[4] << 8);
-          uint8_t crr = value[5];
-          uint8_t cw = value[6];
-          float gradePercent = grade / 100.0f;
-          Serial.printf("[BLE CP] -> Simulation: Grade=%.2f%%, Wind=%d\n", gradePercent, windSpeed);
-          handleSetIndoorBikeSimulation(windSpeed, grade, crr, cw);
-        } else {
-          Serial.printf("[BLE CP] -> Simulation command too short! len=%d\n", value.length());
-        }
-        break;
-        
-      case 0x07:  // Start or Resume
-        Serial.println("[BLE CP] -> Start/Resume");
-        handleStartResume();
-        break;
-        
-      case 0x08:  // Stop or Pause
-        if (value.length() >= 2) {
-          uint8_t stopType = value[1];
-          Serial.printf("[BLE CP] -> Stop/Pause: type=%d\n", stopType);
-          handleStopPause(stopType);
-        }
-        break;
-        
-      default:
-        Serial.printf("[BLE CP] -> UNHANDLED opcode: 0x%02X\n", opcode);
-        break;
+  FtmsCommand cmd;
+  parseControlPoint(data, len, &cmd);
+  cmdQueuePush(cmd);
+}
+
+// ==================== CONTROL POINT DISPATCH ====================
+
+// Single place where Control Point responses are queued (bleSendResponses()
+// builds and indicates them)
+static void sendControlPointResponse(uint8_t opcode, uint8_t result) {
+  rspQueuePush({opcode, result});
+}
+
+// respond = false for replayed writes: no central is waiting for those
+static void dispatchCommand(const FtmsCommand& cmd, bool respond) {
+  if (cmd.result != FTMS_RESULT_SUCCESS) {
+    if (cmd.result == FTMS_RESULT_NOT_SUPPORTED) {
+      LOG_W("BLE CP", "UNHANDLED opcode: 0x%02X", cmd.opcode);
+    } else {
+      LOG_W("BLE CP", "Opcode 0x%02X too short! len=%d", cmd.opcode, cmd.length);
     }
+    if (respond) sendControlPointResponse(cmd.opcode, cmd.result);
+    return;
   }
-};
 
-// ==================== BLE INITIALIZATION ====================
+  switch (cmd.opcode) {
+    case FTMS_OP_REQUEST_CONTROL:
+      handleRequestControl();
+      break;
 
-void bleInit() {
-  Serial.println("===========================================");
-  Serial.println("Initializing BLE (ESP32 BLE)...");
+    case FTMS_OP_RESET:
+      handleResetControl();
+      break;
 
-  // Initialize BLE with Wahoo name
-  BLEDevice::init(BLE_DEVICE_NAME);
-  
-  // Create BLE Server
-  pServer = BLEDevice::createServer();
-  pServer->setCallbacks(new MyServerCallbacks());
-  Serial.println("  BLE Server created");
-
-  // ===== Create Services First (before adding characteristics) =====
-  // FTMS service needs more handles: 4 characteristics × 3 handles each + 1 service = 13
-  // Using 15 to be safe (default is often too small and causes crashes)
-  BLEService* pService = pServer->createService(BLEUUID((uint16_t)0x1826), 15);  // FTMS
-  BLEService* pDis = pServer->createService(BLEUUID((uint16_t)0x180A), 10);      // Device Info
-
-  // ===== Device Information Service Characteristics =====
-  BLECharacteristic* chMan = pDis->createCharacteristic(
-    BLEUUID((uint16_t)0x2A29), 
-    BLECharacteristic::PROPERTY_READ
-  );
-  chMan->setValue(BLE_MANUFACTURER);  // "Wahoo Fitness"
-  
-  BLECharacteristic* chModel = pDis->createCharacteristic(
-    BLEUUID((uint16_t)0x2A24), 
-    BLECharacteristic::PROPERTY_READ
-  );
-  chModel->setValue(BLE_MODEL);  // "KICKR"
-  
-  BLECharacteristic* chFw = pDis->createCharacteristic(
-    BLEUUID((uint16_t)0x2A26), 
-    BLECharacteristic::PROPERTY_READ
-  );
-  chFw->setValue(BLE_FIRMWARE_VERSION);  // "4.10.0"
-  
-  Serial.println("  Device Info Service configured (Wahoo spoofing)");
+    case FTMS_OP_SET_TARGET_POWER:
+      handleSetTargetPower((uint16_t)cmd.value);
+      break;
 
-  // ===== FTMS Service Characteristics =====
-  Serial.println("  Creating FTMS characteristics...");
-  
-  // Indoor Bike Data (0x2AD2)
-  pIndoorBike = pService->createCharacteristic(
-    BLEUUID((uint16_t)0x2AD2),
-    BLECharacteristic::PROPERTY_NOTIFY
-  );
-  pIndoorBike->addDescriptor(new BLE2902());
-
-  // Fitness Machine Control Point (0x2AD9)
-  pControlPoint = pService->createCharacteristic(
-    BLEUUID((uint16_t)0x2AD9),
-    BLECharacteristic::PROPERTY_INDICATE | BLECharacteristic::PROPERTY_WRITE
-  );
-  pControlPoint->addDescriptor(new BLE2902());
-
-  // Fitness Machine Feature (0x2ACC)
-  pFeature = pService->createCharacteristic(
-    BLEUUID((uint16_t)0x2ACC),
-    BLECharacteristic::PROPERTY_READ
-  );
-  // NOTE: Working code does NOT set value - leave default/empty
-  pFeature->addDescriptor(new BLE2902());
-
-  // Training Status (0x2ADA)
-  pStatus = pService->createCharacteristic(
-    BLEUUID((uint16_t)0x2ADA),
-    BLECharacteristic::PROPERTY_NOTIFY
-  );
-  pStatus->addDescriptor(new BLE2902());
-  
-  // Set callbacks AFTER all characteristics created (matches working code)
-  static ControlPointCallbacks cpCallbacks;
-  pControlPoint->setCallbacks(&cpCallbacks);
+    case FTMS_OP_SET_RESISTANCE:
+      handleSetTargetResistance(cmd.level);
+      break;
 
-  Serial.println("  FTMS Service configured");
+    case FTMS_OP_SET_SIMULATION:
+      handleSetIndoorBikeSimulation(cmd.windSpeed, cmd.value, cmd.crr, cmd.cw);
+      break;
 
-  // Start FTMS service first
-  Serial.println("  Starting FTMS service...");
-  pService->start();
-  delay(100);  // Allow BLE stack to stabilize
-  Serial.println("  FTMS service started");
+    case FTMS_OP_START_RESUME:
+      handleStartResume();
+      break;
 
-  // ===== Start Advertising =====
-  BLEAdvertising* pAdvertising = BLEDevice::getAdvertising();
-  pAdvertising->stop();
-  
-  // Set advertising data
-  BLEAdvertisementData advData;
-  advData.setFlags(0x06);
-  advData.addData(String("\x03\x03\x26\x18", 4));  // FTMS service UUID
-  
-  BLEAdvertisementData scanData;
-  scanData.setName(BLE_DEVICE_NAME);
-  
-  pAdvertising->setAdvertisementData(advData);
-  pAdvertising->setScanResponseData(scanData);
-  pAdvertising->setMinPreferred(0x06);
-  pAdvertising->setMaxPreferred(0x12);
-  
-  pAdvertising->start();
-  delay(50);  // Allow advertising to stabilize
+    case FTMS_OP_STOP_PAUSE:
+      handleStopPause(cmd.level);
+      break;
+  }
 
-  // Start Device Info Service AFTER advertising (matches working code)
-  Serial.println("  Starting Device Info service...");
-  pDis->start();
-  delay(50);  // Allow service to stabilize
+  if (respond) sendControlPointResponse(cmd.opcode, FTMS_RESULT_SUCCESS);
+}
+
+void bleProcessCommands() {
+  FtmsCommand cmd;
+  while (cmdQueuePop(&cmd)) {
+    dispatchCommand(cmd, true);
+  }
+
+  static uint32_t lastDropped = 0;
+  uint32_t dropped = gCmdDropped;
+  if (dropped != lastDropped) {
+    LOG_W("BLE CP", "%lu command(s) dropped (queue full)", (unsigned long)(dropped - lastDropped));
+    lastDropped = dropped;
+  }
+}
+
+void bleReplayControlPoint(const uint8_t* data, size_t len) {
+  if (len < 1) return;
+
+  FtmsCommand cmd;
+  parseControlPoint(data, len, &cmd);
+  dispatchCommand(cmd, false);
+}
+
+void bleSendResponses() {
+  FtmsResponse rsp;
+  while (rspQueuePop(&rsp)) {
+    if (!deviceConnected) continue;   // The central left
+    uint8_t response[3] = {FTMS_OP_RESPONSE_CODE, rsp.opcode, rsp.result};
+    bleBackendIndicateControlPoint(response, 3);
+  }
+
+  const uint16_t refused = __atomic_exchange_n(&gCpRefused, (uint16_t)0, __ATOMIC_ACQUIRE);
+  if (refused != 0 && deviceConnected) {
+    uint8_t response[3] = {FTMS_OP_RESPONSE_CODE, (uint8_t)refused, FTMS_RESULT_FAILED};
+    bleBackendIndicateControlPoint(response, 3);
+  }
+  static uint32_t lastRefused = 0;
+  const uint32_t refusedCount = gCpRefusedCount;
+  if (refusedCount != lastRefused) {
+    LOG_W("BLE CP", "%lu write(s) refused (replay running)", (unsigned long)(refusedCount - lastRefused));
+    lastRefused = refusedCount;
+  }
+
+  static uint32_t lastDropped = 0;
+  uint32_t dropped = gRspDropped;
+  if (dropped != lastDropped) {
+    LOG_W("BLE CP", "%lu response(s) dropped (queue full)", (unsigned long)(dropped - lastDropped));
+    lastDropped = dropped;
+  }
+}
+
+uint32_t bleCommandsDropped() {
+  return gCmdDropped;
+}
+
+// ==================== BLE INITIALIZATION ====================
+
+static uint32_t gBleHeapUsed = 0;
+
+void bleInit() {
+  Serial.println("===========================================");
+  Serial.printf("Initializing BLE (%s)...\n", bleBackendName());
+  const uint32_t heapBefore = ESP.getFreeHeap();
+
+  bleBackendInit();
+  gAdvBootUs = (uint32_t)esp_timer_get_time();
+  gAdvSinceMs = gAdvLastActivityMs = millis();
 
-  Serial.println("✓ BLE Started (ESP32 BLE)");
+  // Heap taken by the stack + GATT database; compare backends with this
+  const uint32_t heapAfter = ESP.getFreeHeap();
+  gBleHeapUsed = heapBefore - heapAfter;
+  Serial.printf("✓ BLE Started (%s)\n", bleBackendName());
   Serial.printf("  Device Name: %s\n", BLE_DEVICE_NAME);
   Serial.printf("  Manufacturer: %s (for Zwift whitelist)\n", BLE_MANUFACTURER);
   Serial.printf("  Model: %s\n", BLE_MODEL);
+  Serial.printf("  Heap used by BLE: %lu bytes (free %lu)\n",
+                (unsigned long)gBleHeapUsed, (unsigned long)heapAfter);
+  Serial.printf("  Advertising %lu ms after boot\n", (unsigned long)(gAdvBootUs / 1000));
   Serial.println("===========================================");
 }
 
+const char* bleStackName() {
+  return bleBackendName();
+}
+
+uint32_t bleHeapUsed() {
+  return gBleHeapUsed;
+}
+
 // ==================== BLE NOTIFICATION FUNCTIONS ====================
 
-void bleNotifyPower(float watts, float speedMph, float cadenceRpm) {
-  if (!deviceConnected || pIndoorBike == NULL) {
-    return;
+static inline size_t ibPut16(uint8_t* out, size_t n, uint16_t v) {
+  out[n] = (uint8_t)(v & 0xFF);
+  out[n + 1] = (uint8_t)(v >> 8);
+  return n + 2;
+}
+
+bool bleNotifyPower(float watts, float speedMph) {
+  if (!deviceConnected) {
+    return false;
   }
 
-  // Cadence: 0 below 2 mph, 90 rpm above 2 mph (like original)
-  uint16_t cadence_rpm = (speedMph < 2.0f) ? 0 : 90;
-  uint16_t cadence_ftms = cadence_rpm * 2;  // 0.5 rpm units
+  const uint32_t now = millis();
+  // The slack keeps a frame sent a little late from pushing the next one a
+  // whole sample back (100 ms would otherwise often become 150 ms)
+  if (gIbLastLen != 0 && now - gIbLastSentMs < BLE_NOTIFY_MIN_INTERVAL_MS - BLE_NOTIFY_SLACK_MS) {
+    return false;  // Rate limit: the next sample will carry the update
+  }
+
+  // Flags from the fields we actually have
+  uint16_t flags = IB_FLAG_INSTANT_POWER;   // Speed present: IB_FLAG_MORE_DATA stays clear
+  if (BLE_SYNTHETIC_CADENCE) flags |= IB_FLAG_INSTANT_CADENCE;
+
+  // Speed in 0.01 km/h
+  uint16_t speedField = (uint16_t)lroundf(constrain(speedMph, 0.0f, 100.0f) * MPH_TO_KMH * 100.0f);
+
+  // Synthetic cadence (nothing measures it on rollers): 0 below 2 mph,
+  // 90 rpm above (like original), 0.5 rpm units
+  const uint16_t cadence_rpm = BLE_SYNTHETIC_CADENCE ? ((speedMph < 2.0f) ? 0 : 90) : 0;
 
   // Power
   int16_t powerValue = (int16_t)constrain(watts, 0, 2000);
 
-  // Update the data array
-  FTMS_INDOOR_BIKE_DATA[4] = (uint8_t)(cadence_ftms & 0xFF);
-  FTMS_INDOOR_BIKE_DATA[5] = (uint8_t)(cadence_ftms >> 8);
-  FTMS_INDOOR_BIKE_DATA[6] = (uint8_t)(powerValue & 0xFF);
-  FTMS_INDOOR_BIKE_DATA[7] = (uint8_t)((uint16_t)powerValue >> 8);
+  uint8_t frame[IB_FRAME_MAX];
+  size_t n = ibPut16(frame, 0, flags);
+  if (!(flags & IB_FLAG_MORE_DATA)) n = ibPut16(frame, n, speedField);
+  if (flags & IB_FLAG_INSTANT_CADENCE) n = ibPut16(frame, n, (uint16_t)(cadence_rpm * 2));
+  if (flags & IB_FLAG_INSTANT_POWER) n = ibPut16(frame, n, (uint16_t)powerValue);
+
+  // Unchanged since the last frame: skip it, but keep a slow heartbeat
+  if (n == gIbLastLen && memcmp(frame, gIbLast, n) == 0 &&
+      now - gIbLastSentMs < BLE_NOTIFY_HEARTBEAT_MS) {
+    gIbSuppressed++;
+    return false;
+  }
 
   // Send notification
-  pIndoorBike->setValue(FTMS_INDOOR_BIKE_DATA, sizeof(FTMS_INDOOR_BIKE_DATA));
-  pIndoorBike->notify();
+  bleBackendNotifyIndoorBike(frame, n);
+  memcpy(gIbLast, frame, n);
+  gIbLastLen = n;
+  gIbLastSentMs = now;
+  gIbSent++;
   
   // Debug output
-  static uint32_t notifyCount = 0;
   static uint32_t lastDebug = 0;
-  notifyCount++;
-  
-  if (millis() - lastDebug > 2000) {
-    lastDebug = millis();
-    Serial.printf("[BLE] Notifications: %lu, Power=%dW, Cadence=%d RPM, Speed=%.1f mph\n", 
-                  notifyCount, powerValue, cadence_rpm, speedMph);
+  if (now - lastDebug > 2000) {
+    lastDebug = now;
+    LOG_D("BLE", "Notifications: %lu (suppressed %lu), Power=%dW, Cadence=%d RPM, Speed=%.1f mph",
+          (unsigned long)gIbSent, (unsigned long)gIbSuppressed, powerValue, cadence_rpm, speedMph);
   }
+  return true;
+}
+
+void bleNotifyStats(uint32_t* sent, uint32_t* suppressed) {
+  *sent = gIbSent;
+  *suppressed = gIbSuppressed;
 }
 
 void bleNotifyStatus(uint8_t status) {
-  if (!deviceConnected || pStatus == NULL) return;
+  if (!deviceConnected) return;
 
   uint8_t data[2] = {status, 0x00};
-  pStatus->setValue(data, 2);
-  pStatus->notify();
+  bleBackendNotifyStatus(data, 2);
 }
 
-// ==================== BLE KEEP-ALIVE ====================
-// Periodically restart advertising to prevent BLE from becoming dormant
-// Also detects RPM activity to wake from idle state
+// ==================== ADVERTISING MANAGER ====================
+// Advertising runs continuously while disconnected; only its interval
+// changes. FAST after boot, a disconnect or roller activity, SLOW once
+// BLE_ADV_FAST_WINDOW_MS pass without either. The stack stops advertising
+// by itself on connect. State (declared above) is owned by the comms task,
+// except the disconnect flag.
+
+static void advSetState(BleAdvState state, const char* why) {
+  if (state == BLE_ADV_FAST) {
+    bleBackendStartAdvertising(BLE_ADV_FAST_MIN_UNITS, BLE_ADV_FAST_MAX_UNITS);
+  } else if (state == BLE_ADV_SLOW) {
+    bleBackendStartAdvertising(BLE_ADV_SLOW_MIN_UNITS, BLE_ADV_SLOW_MAX_UNITS);
+  }
+  gAdvState = state;
+  gAdvSinceMs = millis();
+  gAdvChanges++;
+  LOG_I("BLE", "Advertising %s (%s)", bleAdvStateName(state), why);
+}
 
-static uint32_t lastAdvertisingRestartMs = 0;
-static constexpr uint32_t ADVERTISING_RESTART_INTERVAL_MS = 30000;  // Every 30 seconds
-static bool wasIdle = true;  // Track idle state for RPM wake detection
+void bleAdvertisingUpdate(float rpm) {
+  const uint32_t now = millis();
 
-void bleKeepAlive() {
-  // Only restart advertising when NOT connected
   if (deviceConnected) {
-    lastAdvertisingRestartMs = millis();  // Reset timer while connected
-    wasIdle = false;
+    if (gAdvState != BLE_ADV_OFF) advSetState(BLE_ADV_OFF, "connected");
+    gAdvFastRequest = false;
     return;
   }
 
-  // Get current RPM from sensors (declared in sensors.h)
-  extern float currentRPM;
-  bool hasActivity = (currentRPM > 5.0f);  // Consider >5 RPM as activity
-
-  // Wake on RPM: If we were idle and now detect pedaling, restart advertising immediately
-  if (wasIdle && hasActivity) {
-    wasIdle = false;
-    lastAdvertisingRestartMs = millis();
-
-    BLEAdvertising* pAdvertising = BLEDevice::getAdvertising();
-    pAdvertising->stop();
-    delay(10);
-    pAdvertising->start();
-
-    Serial.println("[BLE] Advertising restarted (RPM wake)");
-    return;
+  const bool active = (rpm > BLE_ADV_WAKE_RPM);
+  if (active) gAdvLastActivityMs = now;
+
+  if (gAdvFastRequest || gAdvState == BLE_ADV_OFF) {
+    gAdvFastRequest = false;
+    gAdvLastActivityMs = now;
+    advSetState(BLE_ADV_FAST, "disconnected");
+  } else if (gAdvState == BLE_ADV_SLOW && active) {
+    advSetState(BLE_ADV_FAST, "roller activity");
+  } else if (gAdvState == BLE_ADV_FAST && now - gAdvLastActivityMs >= BLE_ADV_FAST_WINDOW_MS) {
+    advSetState(BLE_ADV_SLOW, "idle");
   }
+}
 
-  // Track idle state
-  if (!hasActivity) {
-    wasIdle = true;
+const char* bleAdvStateName(BleAdvState state) {
+  switch (state) {
+    case BLE_ADV_OFF:  return "off";
+    case BLE_ADV_FAST: return "fast";
+    case BLE_ADV_SLOW: return "slow";
   }
+  return "?";
+}
 
-  // Periodically restart advertising to stay discoverable
-  if (millis() - lastAdvertisingRestartMs >= ADVERTISING_RESTART_INTERVAL_MS) {
-    lastAdvertisingRestartMs = millis();
-
-    BLEAdvertising* pAdvertising = BLEDevice::getAdvertising();
-    pAdvertising->stop();
-    delay(10);  // Brief pause
-    pAdvertising->start();
-
-    Serial.println("[BLE] Advertising restarted (keep-alive)");
-  }
+void bleGetAdvInfo(BleAdvInfo* out) {
+  out->state = gAdvState;
+  out->minUnits = (gAdvState == BLE_ADV_SLOW) ? BLE_ADV_SLOW_MIN_UNITS :
+                  (gAdvState == BLE_ADV_FAST) ? BLE_ADV_FAST_MIN_UNITS : 0;
+  out->maxUnits = (gAdvState == BLE_ADV_SLOW) ? BLE_ADV_SLOW_MAX_UNITS :
+                  (gAdvState == BLE_ADV_FAST) ? BLE_ADV_FAST_MAX_UNITS : 0;
+  out->sinceMs = gAdvSinceMs;
+  out->changes = gAdvChanges;
+  out->bootUs = gAdvBootUs;
 }
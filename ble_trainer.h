@@ -2,34 +2,109 @@
  * ble_trainer.h - BLE FTMS Trainer Interface
  * 
  * Handles all Bluetooth Low Energy communication for FTMS trainer
- * Uses ESP32 BLE library (NOT NimBLE)
+ * The BLE stack (Bluedroid or NimBLE) is chosen at build time, see ble_backend.h
  */
 
 #ifndef BLE_TRAINER_H
 #define BLE_TRAINER_H
 
 #include <Arduino.h>
-#include <BLEDevice.h>
-#include <BLEServer.h>
-#include <BLEUtils.h>
-#include <BLE2902.h>
 #include "config.h"
 
 // ==================== BLE STATE ====================
 extern bool deviceConnected;
-extern BLECharacteristic* pIndoorBike;
-extern BLECharacteristic* pControlPoint;
-extern BLECharacteristic* pFeature;
-extern BLECharacteristic* pStatus;
+
+// ==================== CONTROL POINT COMMANDS ====================
+// FTMS Control Point op codes handled by this trainer
+enum FtmsOpcode : uint8_t {
+  FTMS_OP_REQUEST_CONTROL   = 0x00,
+  FTMS_OP_RESET             = 0x01,
+  FTMS_OP_SET_RESISTANCE    = 0x04,
+  FTMS_OP_SET_TARGET_POWER  = 0x05,
+  FTMS_OP_START_RESUME      = 0x07,
+  FTMS_OP_STOP_PAUSE        = 0x08,
+  FTMS_OP_SET_SIMULATION    = 0x11,
+  FTMS_OP_RESPONSE_CODE     = 0x80
+};
+
+// FTMS Control Point result codes
+enum FtmsResult : uint8_t {
+  FTMS_RESULT_SUCCESS       = 0x01,
+  FTMS_RESULT_NOT_SUPPORTED = 0x02,
+  FTMS_RESULT_INVALID_PARAM = 0x03,
+  FTMS_RESULT_FAILED        = 0x04
+};
+
+// One parsed Control Point write (filled in the BLE callback, consumed in loop)
+struct FtmsCommand {
+  uint8_t opcode;
+  uint8_t result;       // FTMS_RESULT_SUCCESS unless the write was malformed/unknown
+  uint8_t level;        // Resistance level / stop type
+  uint8_t crr;
+  uint8_t cw;
+  int16_t value;        // Target watts / grade (0.01 %)
+  int16_t windSpeed;
+  uint8_t length;       // Raw write length (for logging)
+};
+
+// ==================== BLE LINK ====================
+// Link parameters of the current (or last) connection, as granted by the
+// central. 0 = not reported yet.
+struct BleLinkInfo {
+  bool connected;
+  uint8_t peer[6];
+  uint16_t intervalUnits;   // 1.25 ms units
+  uint16_t latency;
+  uint16_t timeoutUnits;    // 10 ms units
+  uint16_t mtu;
+  uint16_t txLen, rxLen;    // LL data length (bytes)
+  uint8_t txPhy, rxPhy;     // 1 = 1M, 2 = 2M, 3 = Coded
+  uint32_t connectMs;
+  uint32_t connects;        // Since boot
+};
+
+void bleGetLinkInfo(BleLinkInfo* out);
+
+// ==================== ADVERTISING ====================
+enum BleAdvState : uint8_t {
+  BLE_ADV_OFF,    // Connected (the stack stops advertising)
+  BLE_ADV_FAST,   // After boot, disconnect or roller activity
+  BLE_ADV_SLOW    // Idle
+};
+
+struct BleAdvInfo {
+  BleAdvState state;
+  uint16_t minUnits, maxUnits;  // Advertising interval, 0.625 ms units (0 when off)
+  uint32_t sinceMs;             // millis() of the last state change
+  uint32_t changes;             // State changes since boot
+  uint32_t bootUs;              // esp_timer time when advertising first came up
+};
+
+void bleAdvertisingUpdate(float rpm);  // Comms task; never blocks
+const char* bleAdvStateName(BleAdvState state);
+void bleGetAdvInfo(BleAdvInfo* out);
 
 // ==================== BLE FUNCTIONS ====================
 void bleInit();
-void bleNotifyPower(float watts, float speedMph, float cadenceRpm);
+const char* bleStackName();    // Compiled backend ("ESP32 BLE" / "NimBLE")
+uint32_t bleHeapUsed();        // Heap taken by bleInit() (stack + GATT database)
+// Indoor Bike Data; call once per new sensor sample. Returns true if a frame
+// went out (false when rate-limited, unchanged or not connected)
+bool bleNotifyPower(float watts, float speedMph);   // Cadence: BLE_SYNTHETIC_CADENCE
+void bleNotifyStats(uint32_t* sent, uint32_t* suppressed);
 void bleNotifyStatus(uint8_t status);
-void bleKeepAlive();  // Call periodically to prevent BLE from going dormant
+void bleProcessCommands();  // Apply queued Control Point commands (control task); queues the responses
+void bleSendResponses();    // Indicate queued Control Point responses (comms task; may block)
+// Replay (loop, in place of the control task's tick): parse and apply a
+// Control Point write at once, bypassing the queue; no response is sent.
+// Real writes are refused while replayActive().
+void bleReplayControlPoint(const uint8_t* data, size_t len);
+uint32_t bleCommandsDropped();  // Writes lost to a full queue since boot
 
 // ==================== CONTROL POINT HANDLERS ====================
-// These are called by BLE callbacks when Zwift sends commands
+// Called from bleProcessCommands() in the control task (or from
+// bleReplayControlPoint() during a replay); for real writes the dispatcher
+// queues the response and the comms task indicates it
 void handleRequestControl();
 void handleResetControl();
 void handleSetTargetPower(uint16_t watts);
@@ -4,9 +4,12 @@
 
 #include "calibration.h"
 #include "sensors.h"
+#include "stepper_control.h"
+#include "log.h"
 #include <Preferences.h>
 #include <nvs_flash.h>
 #include <WiFi.h>
+#include <stddef.h>
 
 // ==================== GLOBAL CALIBRATION DATA ====================
 float gIdleCurveA = IDLE_CURVE_DEFAULT_A;
@@ -14,6 +17,18 @@ float gIdleCurveB = IDLE_CURVE_DEFAULT_B;
 float gIdleCurveC = IDLE_CURVE_DEFAULT_C;
 float gIdleCurveD = IDLE_CURVE_DEFAULT_D;
 
+// ==================== ERG PI GAINS ====================
+bool  gErgPiEnabled = true;
+float gErgPiKp = ERG_PI_DEFAULT_KP;
+float gErgPiKi = ERG_PI_DEFAULT_KI;
+float gErgPiLimit = ERG_PI_DEFAULT_LIMIT;
+float gErgLookaheadMs = ERG_LOOKAHEAD_DEFAULT_MS;
+bool  gErgFromPower = false;
+
+// ==================== INERTIA COMPENSATION ====================
+bool  gPowerInertiaEnabled = false;
+float gPowerInertia = POWER_INERTIA_DEFAULT;
+
 // ==================== WIFI SETTINGS ====================
 char gWifiSsid[64] = "";
 char gWifiPass[64] = "";
@@ -24,6 +39,9 @@ char gDeviceId[8] = "";         // Last 4 hex digits of MAC
 char gDeviceName[32] = "";      // User-friendly name
 bool gDeviceNameSet = false;
 
+// Fleet telemetry
+uint8_t gFleetRateHz = FLEET_RATE_DEFAULT_HZ;
+
 // Buffers for generated names
 static char sEffectiveHostname[48] = "";
 static char sEffectiveApSsid[48] = "";
@@ -31,6 +49,189 @@ static char sEffectiveApSsid[48] = "";
 // ==================== NVS STORAGE ====================
 static Preferences prefs;
 static const char* NVS_NAMESPACE = "calibration";
+static const char* CAL_BLOB_KEY = "cal";
+static constexpr uint16_t CAL_BLOB_VERSION = 1;
+
+// Everything persisted, in one blob (tables stored as float: half of double)
+struct CalibrationBlob {
+  uint16_t version;
+  uint16_t size;                  // sizeof(CalibrationBlob)
+  float idle[4];                  // A, B, C, D
+  float ergKp, ergKi, ergLimit, ergLookaheadMs;
+  float inertia;
+  uint8_t ergPiEnabled;
+  uint8_t inertiaEnabled;
+  uint8_t ergFromPower;
+  uint8_t fleetRateHz;            // Was reserved (0 = off in older blobs)
+  char wifiSsid[64];
+  char wifiPass[64];
+  char deviceName[32];
+  float powerTable[POWER_TABLE_ROWS][POWER_TABLE_COLS];
+  float ergTable[ERG_TABLE_ROWS][ERG_TABLE_COLS];
+  float simTable[SIM_TABLE_ROWS][SIM_TABLE_COLS];
+  uint32_t crc;                   // CRC-32 of all bytes before it
+};
+
+// Keys written by firmware before the blob; migrated once, then removed
+static const char* const LEGACY_KEYS[] = {
+  "idleA", "idleB", "idleC", "idleD", "ergPiEn", "ergKp", "ergKi", "ergLim", "ergLaMs",
+  "inertiaEn", "inertia", "wifiSsid", "wifiPass", "devName", "powerTbl", "ergTbl", "simTbl"
+};
+
+static CalibrationBlob gBlob;        // Staging buffer (setup/loop only)
+static bool gNvsReady = false;
+static bool gDirty = false;
+static bool gLegacyPresent = false;
+static uint32_t gDirtySinceMs = 0;   // First edit not yet committed
+static uint32_t gLastEditMs = 0;
+static uint32_t gCommits = 0;
+static uint32_t gCommitUs = 0;       // Last commit duration
+
+static uint32_t crc32(const uint8_t* data, size_t len) {
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (int b = 0; b < 8; b++) crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+  }
+  return ~crc;
+}
+
+static void copyString(char* dst, size_t size, const char* src) {
+  snprintf(dst, size, "%s", src);
+}
+
+static void applyDefaults();
+
+template <int R, int C>
+static void tableToBlob(float (&dst)[R][C], const double (&src)[R][C]) {
+  for (int i = 0; i < R; i++)
+    for (int j = 0; j < C; j++) dst[i][j] = (float)src[i][j];
+}
+
+template <int R, int C>
+static void tableFromBlob(double (&dst)[R][C], const float (&src)[R][C]) {
+  for (int i = 0; i < R; i++)
+    for (int j = 0; j < C; j++) dst[i][j] = src[i][j];
+}
+
+static void blobFill(CalibrationBlob* b) {
+  memset(b, 0, sizeof(*b));
+  b->version = CAL_BLOB_VERSION;
+  b->size = sizeof(CalibrationBlob);
+  b->idle[0] = gIdleCurveA;
+  b->idle[1] = gIdleCurveB;
+  b->idle[2] = gIdleCurveC;
+  b->idle[3] = gIdleCurveD;
+  b->ergKp = gErgPiKp;
+  b->ergKi = gErgPiKi;
+  b->ergLimit = gErgPiLimit;
+  b->ergLookaheadMs = gErgLookaheadMs;
+  b->inertia = gPowerInertia;
+  b->ergPiEnabled = gErgPiEnabled;
+  b->inertiaEnabled = gPowerInertiaEnabled;
+  b->ergFromPower = gErgFromPower;
+  b->fleetRateHz = gFleetRateHz;
+  if (gWifiConfigured) {
+    copyString(b->wifiSsid, sizeof(b->wifiSsid), gWifiSsid);
+    copyString(b->wifiPass, sizeof(b->wifiPass), gWifiPass);
+  }
+  if (gDeviceNameSet) copyString(b->deviceName, sizeof(b->deviceName), gDeviceName);
+  tableToBlob(b->powerTable, gPowerTable);
+  tableToBlob(b->ergTable, gErgTable);
+  tableToBlob(b->simTable, gSimTable);
+  b->crc = crc32((const uint8_t*)b, offsetof(CalibrationBlob, crc));
+}
+
+static void blobApply(const CalibrationBlob& b) {
+  gIdleCurveA = b.idle[0];
+  gIdleCurveB = b.idle[1];
+  gIdleCurveC = b.idle[2];
+  gIdleCurveD = b.idle[3];
+  gErgPiEnabled = b.ergPiEnabled != 0;
+  gErgPiKp = b.ergKp;
+  gErgPiKi = b.ergKi;
+  gErgPiLimit = b.ergLimit;
+  gErgLookaheadMs = b.ergLookaheadMs;
+  gPowerInertiaEnabled = b.inertiaEnabled != 0;
+  gErgFromPower = b.ergFromPower != 0;
+  gFleetRateHz = min(b.fleetRateHz, FLEET_RATE_MAX_HZ);
+  gPowerInertia = b.inertia;
+  copyString(gWifiSsid, sizeof(gWifiSsid), b.wifiSsid);
+  copyString(gWifiPass, sizeof(gWifiPass), b.wifiPass);
+  gWifiConfigured = gWifiSsid[0] != '\0';
+  copyString(gDeviceName, sizeof(gDeviceName), b.deviceName);
+  gDeviceNameSet = gDeviceName[0] != '\0';
+  tableFromBlob(gPowerTable, b.powerTable);
+  tableFromBlob(gErgTable, b.ergTable);
+  tableFromBlob(gSimTable, b.simTable);
+}
+
+// Settings from the per-key layout (namespace already open)
+static void legacyLoad() {
+  gIdleCurveA = prefs.getFloat("idleA", IDLE_CURVE_DEFAULT_A);
+  gIdleCurveB = prefs.getFloat("idleB", IDLE_CURVE_DEFAULT_B);
+  gIdleCurveC = prefs.getFloat("idleC", IDLE_CURVE_DEFAULT_C);
+  gIdleCurveD = prefs.getFloat("idleD", IDLE_CURVE_DEFAULT_D);
+
+  gErgPiEnabled = prefs.getBool("ergPiEn", true);
+  gErgPiKp = prefs.getFloat("ergKp", ERG_PI_DEFAULT_KP);
+  gErgPiKi = prefs.getFloat("ergKi", ERG_PI_DEFAULT_KI);
+  gErgPiLimit = prefs.getFloat("ergLim", ERG_PI_DEFAULT_LIMIT);
+  gErgLookaheadMs = prefs.getFloat("ergLaMs", ERG_LOOKAHEAD_DEFAULT_MS);
+
+  gPowerInertiaEnabled = prefs.getBool("inertiaEn", false);
+  gPowerInertia = prefs.getFloat("inertia", POWER_INERTIA_DEFAULT);
+
+  copyString(gWifiSsid, sizeof(gWifiSsid), prefs.getString("wifiSsid", "").c_str());
+  copyString(gWifiPass, sizeof(gWifiPass), prefs.getString("wifiPass", "").c_str());
+  gWifiConfigured = gWifiSsid[0] != '\0';
+  copyString(gDeviceName, sizeof(gDeviceName), prefs.getString("devName", "").c_str());
+  gDeviceNameSet = gDeviceName[0] != '\0';
+
+  if (prefs.getBytesLength("powerTbl") == sizeof(gPowerTable)) prefs.getBytes("powerTbl", gPowerTable, sizeof(gPowerTable));
+  if (prefs.getBytesLength("ergTbl") == sizeof(gErgTable)) prefs.getBytes("ergTbl", gErgTable, sizeof(gErgTable));
+  if (prefs.getBytesLength("simTbl") == sizeof(gSimTable)) prefs.getBytes("simTbl", gSimTable, sizeof(gSimTable));
+}
+
+// Marks the settings changed; calibrationService() writes them later
+static void markDirty(const char* what) {
+  const uint32_t now = millis();
+  if (!gDirty) gDirtySinceMs = now;
+  gDirty = true;
+  gLastEditMs = now;
+  LOG_I("CAL", "%s changed, commit pending", what);
+}
+
+static void commit() {
+  if (!gNvsReady) {
+    gDirty = false;   // Defaults only (not persisted), see calibrationInit()
+    return;
+  }
+  const uint32_t start = micros();
+  CalibrationBlob& blob = gBlob;
+  blobFill(&blob);
+
+  bool ok = prefs.begin(NVS_NAMESPACE, false);
+  if (ok) {
+    ok = prefs.putBytes(CAL_BLOB_KEY, &blob, sizeof(blob)) == sizeof(blob);
+    // Only drop the old keys once the blob holds their values
+    if (ok && gLegacyPresent) {
+      for (const char* key : LEGACY_KEYS) prefs.remove(key);
+      gLegacyPresent = false;
+    }
+    prefs.end();
+  }
+
+  gCommitUs = micros() - start;
+  if (!ok) {
+    LOG_E("CAL", "NVS commit failed, will retry");
+    gLastEditMs = millis();   // Back off one debounce period
+    return;
+  }
+  gDirty = false;
+  gCommits++;
+  LOG_I("CAL", "Settings committed to NVS (%u bytes, %lu us)", (unsigned)sizeof(blob), (unsigned long)gCommitUs);
+}
 
 // ==================== PUBLIC FUNCTIONS ====================
 
@@ -93,39 +294,36 @@ void calibrationInit() {
   }
   Serial.println("[CAL] NVS namespace opened successfully");
 
-  // Load IDLE curve coefficients (use defaults if not found)
-  gIdleCurveA = prefs.getFloat("idleA", IDLE_CURVE_DEFAULT_A);
-  gIdleCurveB = prefs.getFloat("idleB", IDLE_CURVE_DEFAULT_B);
-  gIdleCurveC = prefs.getFloat("idleC", IDLE_CURVE_DEFAULT_C);
-  gIdleCurveD = prefs.getFloat("idleD", IDLE_CURVE_DEFAULT_D);
-
-  // Load WiFi settings
-  String ssid = prefs.getString("wifiSsid", "");
-  String pass = prefs.getString("wifiPass", "");
-
-  Serial.printf("[CAL] Raw NVS read: ssid='%s' (len=%d)\n", ssid.c_str(), ssid.length());
-
-  if (ssid.length() > 0) {
-    strncpy(gWifiSsid, ssid.c_str(), sizeof(gWifiSsid) - 1);
-    gWifiSsid[sizeof(gWifiSsid) - 1] = '\0';
-    strncpy(gWifiPass, pass.c_str(), sizeof(gWifiPass) - 1);
-    gWifiPass[sizeof(gWifiPass) - 1] = '\0';
-    gWifiConfigured = true;
-  } else {
-    gWifiSsid[0] = '\0';
-    gWifiPass[0] = '\0';
-    gWifiConfigured = false;
+  applyDefaults();   // For whatever the stored settings do not cover
+
+  // One read for everything; fall back to the per-key layout of older firmware
+  CalibrationBlob& blob = gBlob;
+  const size_t len = prefs.getBytesLength(CAL_BLOB_KEY);
+  bool loaded = false;
+  if (len == sizeof(blob) && prefs.getBytes(CAL_BLOB_KEY, &blob, sizeof(blob)) == sizeof(blob)) {
+    if (blob.version == CAL_BLOB_VERSION && blob.size == sizeof(blob) &&
+        blob.crc == crc32((const uint8_t*)&blob, offsetof(CalibrationBlob, crc))) {
+      blobApply(blob);
+      loaded = true;
+      Serial.printf("[CAL] Settings blob v%u loaded (%u bytes)\n", blob.version, (unsigned)len);
+    } else {
+      Serial.printf("[CAL] WARNING: settings blob rejected (v%u, CRC mismatch or other version), using defaults\n",
+                    blob.version);
+    }
+  } else if (len != 0) {
+    Serial.printf("[CAL] WARNING: settings blob has wrong size (%u bytes), using defaults\n", (unsigned)len);
   }
 
-  // Load device name
-  String devName = prefs.getString("devName", "");
-  if (devName.length() > 0) {
-    strncpy(gDeviceName, devName.c_str(), sizeof(gDeviceName) - 1);
-    gDeviceName[sizeof(gDeviceName) - 1] = '\0';
-    gDeviceNameSet = true;
-  } else {
-    gDeviceName[0] = '\0';
-    gDeviceNameSet = false;
+  gNvsReady = true;
+  if (!loaded) {
+    gLegacyPresent = false;
+    for (const char* key : LEGACY_KEYS) gLegacyPresent |= prefs.isKey(key);
+    if (gLegacyPresent) {
+      legacyLoad();
+      Serial.println("[CAL] Migrating per-key settings to the settings blob");
+      gDirty = true;
+      gDirtySinceMs = gLastEditMs = millis() - CAL_COMMIT_DEBOUNCE_MS;   // First idle slot
+    }
   }
 
   prefs.end();
@@ -133,6 +331,10 @@ void calibrationInit() {
   Serial.println("[CAL] Settings loaded from NVS:");
   Serial.printf("  IDLE curve: %.3f + %.3f*v + %.4f*v^2 + %.5f*v^3\n",
                 gIdleCurveA, gIdleCurveB, gIdleCurveC, gIdleCurveD);
+  Serial.printf("  ERG PI: %s Kp=%.3f Ki=%.3f limit=%.0f lookahead=%.0f ms\n",
+                gErgPiEnabled ? "on" : "off", gErgPiKp, gErgPiKi, gErgPiLimit, gErgLookaheadMs);
+  Serial.printf("  Inertia: %s I=%.4f kg*m^2\n",
+                gPowerInertiaEnabled ? "on" : "off", gPowerInertia);
   if (gWifiConfigured) {
     Serial.printf("  WiFi SSID: '%s' (configured)\n", gWifiSsid);
   } else {
@@ -144,21 +346,35 @@ void calibrationInit() {
     Serial.printf("  Device name: (default, using ID: %s)\n", gDeviceId);
   }
 
-  // Load calibration tables (Power, ERG, SIM)
-  calibrationTablesLoad();
+  lutRebuild(CAL_TABLE_POWER);
+  lutRebuild(CAL_TABLE_ERG);
+  lutRebuild(CAL_TABLE_SIM);
 }
 
-void calibrationSave() {
-  prefs.begin(NVS_NAMESPACE, false);  // Read-write mode
+void calibrationService() {
+  if (!gDirty) return;
+  const uint32_t now = millis();
+  if (now - gLastEditMs < CAL_COMMIT_DEBOUNCE_MS) return;
 
-  prefs.putFloat("idleA", gIdleCurveA);
-  prefs.putFloat("idleB", gIdleCurveB);
-  prefs.putFloat("idleC", gIdleCurveC);
-  prefs.putFloat("idleD", gIdleCurveD);
+  // Rollers stopped, or a ride has kept it pending too long: take a gap between moves
+  const bool idle = currentSpeedMph <= 0.0f && !gIsHoming;
+  const bool overdue = now - gDirtySinceMs >= CAL_COMMIT_MAX_DEFER_MS && logStepPos == logStepTarget && !gIsHoming;
+  if (idle || overdue) commit();
+}
 
-  prefs.end();
+void calibrationFlush() {
+  if (gDirty) commit();
+}
+
+void calibrationGetStats(CalibrationStats* out) {
+  out->pending = gDirty;
+  out->commits = gCommits;
+  out->lastCommitUs = gCommitUs;
+  out->blobBytes = sizeof(CalibrationBlob);
+}
 
-  Serial.println("[CAL] Calibration saved to NVS");
+void calibrationSave() {
+  markDirty("IDLE curve");
 }
 
 void calibrationReset() {
@@ -172,43 +388,53 @@ void calibrationReset() {
   Serial.println("[CAL] Calibration reset to defaults");
 }
 
-void wifiSettingsSave(const char* ssid, const char* pass) {
-  Serial.printf("[CAL] wifiSettingsSave called with SSID='%s'\n", ssid);
+void ergPiSave() {
+  markDirty("ERG PI gains");
+}
 
-  if (!prefs.begin(NVS_NAMESPACE, false)) {
-    Serial.println("[CAL] ERROR: Failed to open NVS for writing!");
-    return;
-  }
+void ergPiReset() {
+  gErgPiEnabled = true;
+  gErgPiKp = ERG_PI_DEFAULT_KP;
+  gErgPiKi = ERG_PI_DEFAULT_KI;
+  gErgPiLimit = ERG_PI_DEFAULT_LIMIT;
+  gErgLookaheadMs = ERG_LOOKAHEAD_DEFAULT_MS;
 
-  size_t written1 = prefs.putString("wifiSsid", ssid);
-  size_t written2 = prefs.putString("wifiPass", pass);
+  ergPiSave();
 
-  Serial.printf("[CAL] NVS write results: ssid=%d bytes, pass=%d bytes\n", written1, written2);
+  Serial.println("[CAL] ERG PI gains reset to defaults");
+}
 
-  prefs.end();
+void inertiaSave() {
+  markDirty("Inertia");
+}
+
+void inertiaReset() {
+  gPowerInertiaEnabled = false;
+  gPowerInertia = POWER_INERTIA_DEFAULT;
+
+  inertiaSave();
+
+  Serial.println("[CAL] Inertia reset to defaults");
+}
+
+void wifiSettingsSave(const char* ssid, const char* pass) {
+  Serial.printf("[CAL] wifiSettingsSave called with SSID='%s'\n", ssid);
 
   // Update runtime variables
-  strncpy(gWifiSsid, ssid, sizeof(gWifiSsid) - 1);
-  gWifiSsid[sizeof(gWifiSsid) - 1] = '\0';  // Ensure null termination
-  strncpy(gWifiPass, pass, sizeof(gWifiPass) - 1);
-  gWifiPass[sizeof(gWifiPass) - 1] = '\0';  // Ensure null termination
+  copyString(gWifiSsid, sizeof(gWifiSsid), ssid);
+  copyString(gWifiPass, sizeof(gWifiPass), pass);
   gWifiConfigured = (strlen(ssid) > 0);
+  markDirty("WiFi settings");
 
   Serial.printf("[CAL] WiFi settings saved: SSID='%s', configured=%s\n",
                 gWifiSsid, gWifiConfigured ? "true" : "false");
 }
 
 void wifiSettingsClear() {
-  prefs.begin(NVS_NAMESPACE, false);
-
-  prefs.remove("wifiSsid");
-  prefs.remove("wifiPass");
-
-  prefs.end();
-
   gWifiSsid[0] = '\0';
   gWifiPass[0] = '\0';
   gWifiConfigured = false;
+  markDirty("WiFi settings");
 
   Serial.println("[CAL] WiFi settings cleared");
 }
@@ -216,33 +442,26 @@ void wifiSettingsClear() {
 void deviceNameSave(const char* name) {
   Serial.printf("[CAL] deviceNameSave called with name='%s'\n", name);
 
-  if (!prefs.begin(NVS_NAMESPACE, false)) {
-    Serial.println("[CAL] ERROR: Failed to open NVS for writing!");
-    return;
-  }
-
-  prefs.putString("devName", name);
-  prefs.end();
-
   // Update runtime variable
-  strncpy(gDeviceName, name, sizeof(gDeviceName) - 1);
-  gDeviceName[sizeof(gDeviceName) - 1] = '\0';
+  copyString(gDeviceName, sizeof(gDeviceName), name);
   gDeviceNameSet = (strlen(name) > 0);
+  markDirty("Device name");
 
   Serial.printf("[CAL] Device name saved: '%s'\n", gDeviceName);
 }
 
 void deviceNameClear() {
-  prefs.begin(NVS_NAMESPACE, false);
-  prefs.remove("devName");
-  prefs.end();
-
   gDeviceName[0] = '\0';
   gDeviceNameSet = false;
+  markDirty("Device name");
 
   Serial.println("[CAL] Device name cleared (using default)");
 }
 
+void fleetSettingsSave() {
+  markDirty("Fleet telemetry");
+}
+
 const char* getEffectiveHostname() {
   if (gDeviceNameSet && strlen(gDeviceName) > 0) {
     // Use custom name, convert to lowercase and replace spaces with dashes
@@ -324,19 +543,38 @@ static const double DEFAULT_SIM_TABLE[8][7] = {
   { 500,  500,  677,  834, 1000, 1000, 1000 }
 };
 
-// ==================== POWER TABLE ====================
+template <int R, int C>
+static void tableCopy(double (&dst)[R][C], const double (&src)[R][C]) {
+  memcpy(dst, src, sizeof(dst));
+}
 
-void powerTableSave() {
-  if (!prefs.begin(NVS_NAMESPACE, false)) {
-    Serial.println("[CAL] ERROR: Failed to open NVS for power table save");
-    return;
-  }
+static void applyDefaults() {
+  gIdleCurveA = IDLE_CURVE_DEFAULT_A;
+  gIdleCurveB = IDLE_CURVE_DEFAULT_B;
+  gIdleCurveC = IDLE_CURVE_DEFAULT_C;
+  gIdleCurveD = IDLE_CURVE_DEFAULT_D;
+  gErgPiEnabled = true;
+  gErgPiKp = ERG_PI_DEFAULT_KP;
+  gErgPiKi = ERG_PI_DEFAULT_KI;
+  gErgPiLimit = ERG_PI_DEFAULT_LIMIT;
+  gErgLookaheadMs = ERG_LOOKAHEAD_DEFAULT_MS;
+  gErgFromPower = false;
+  gPowerInertiaEnabled = false;
+  gPowerInertia = POWER_INERTIA_DEFAULT;
+  gWifiSsid[0] = gWifiPass[0] = '\0';
+  gWifiConfigured = false;
+  gDeviceName[0] = '\0';
+  gDeviceNameSet = false;
+  gFleetRateHz = FLEET_RATE_DEFAULT_HZ;
+  tableCopy(gPowerTable, DEFAULT_POWER_TABLE);
+  tableCopy(gErgTable, DEFAULT_ERG_TABLE);
+  tableCopy(gSimTable, DEFAULT_SIM_TABLE);
+}
 
-  // Store as blob
-  prefs.putBytes("powerTbl", gPowerTable, sizeof(gPowerTable));
-  prefs.end();
+// ==================== POWER TABLE ====================
 
-  Serial.println("[CAL] Power table saved to NVS");
+void powerTableSave() {
+  markDirty("Power table");
 }
 
 void powerTableReset() {
@@ -345,6 +583,7 @@ void powerTableReset() {
       gPowerTable[i][j] = DEFAULT_POWER_TABLE[i][j];
     }
   }
+  lutRebuild(CAL_TABLE_POWER);
   powerTableSave();
   Serial.println("[CAL] Power table reset to defaults");
 }
@@ -352,6 +591,7 @@ void powerTableReset() {
 void powerTableSet(int row, int col, double value) {
   if (row >= 0 && row < POWER_TABLE_ROWS && col >= 0 && col < POWER_TABLE_COLS) {
     gPowerTable[row][col] = value;
+    lutUpdatePoint(CAL_TABLE_POWER, row, col);
   }
 }
 
@@ -365,15 +605,7 @@ double powerTableGet(int row, int col) {
 // ==================== ERG TABLE ====================
 
 void ergTableSave() {
-  if (!prefs.begin(NVS_NAMESPACE, false)) {
-    Serial.println("[CAL] ERROR: Failed to open NVS for ERG table save");
-    return;
-  }
-
-  prefs.putBytes("ergTbl", gErgTable, sizeof(gErgTable));
-  prefs.end();
-
-  Serial.println("[CAL] ERG table saved to NVS");
+  markDirty("ERG table");
 }
 
 void ergTableReset() {
@@ -382,6 +614,7 @@ void ergTableReset() {
       gErgTable[i][j] = DEFAULT_ERG_TABLE[i][j];
     }
   }
+  lutRebuild(CAL_TABLE_ERG);
   ergTableSave();
   Serial.println("[CAL] ERG table reset to defaults");
 }
@@ -389,6 +622,7 @@ void ergTableReset() {
 void ergTableSet(int row, int col, double value) {
   if (row >= 0 && row < ERG_TABLE_ROWS && col >= 0 && col < ERG_TABLE_COLS) {
     gErgTable[row][col] = value;
+    lutUpdatePoint(CAL_TABLE_ERG, row, col);
   }
 }
 
@@ -399,18 +633,18 @@ double ergTableGet(int row, int col) {
   return 0;
 }
 
-// ==================== SIM TABLE ====================
-
-void simTableSave() {
-  if (!prefs.begin(NVS_NAMESPACE, false)) {
-    Serial.println("[CAL] ERROR: Failed to open NVS for SIM table save");
-    return;
+double ergEffectiveGet(int row, int col) {
+  if (!gErgFromPower) return ergTableGet(row, col);
+  if (row >= 0 && row < ERG_TABLE_ROWS && col >= 0 && col < ERG_TABLE_COLS) {
+    return stepFromPowerSpeed(gErgSpeedAxis[row], gErgPowerAxis[col]);
   }
+  return 0;
+}
 
-  prefs.putBytes("simTbl", gSimTable, sizeof(gSimTable));
-  prefs.end();
+// ==================== SIM TABLE ====================
 
-  Serial.println("[CAL] SIM table saved to NVS");
+void simTableSave() {
+  markDirty("SIM table");
 }
 
 void simTableReset() {
@@ -419,6 +653,7 @@ void simTableReset() {
       gSimTable[i][j] = DEFAULT_SIM_TABLE[i][j];
     }
   }
+  lutRebuild(CAL_TABLE_SIM);
   simTableSave();
   Serial.println("[CAL] SIM table reset to defaults");
 }
@@ -426,6 +661,7 @@ void simTableReset() {
 void simTableSet(int row, int col, double value) {
   if (row >= 0 && row < SIM_TABLE_ROWS && col >= 0 && col < SIM_TABLE_COLS) {
     gSimTable[row][col] = value;
+    lutUpdatePoint(CAL_TABLE_SIM, row, col);
   }
 }
 
@@ -467,35 +703,3 @@ double simGradeAxis(int idx) {
   if (idx >= 0 && idx < SIM_TABLE_COLS) return gSimGradeAxis[idx];
   return 0;
 }
-
-// ==================== LOAD TABLES FROM NVS ====================
-
-void calibrationTablesLoad() {
-  if (!prefs.begin(NVS_NAMESPACE, true)) {  // Read-only
-    Serial.println("[CAL] No saved calibration tables found, using defaults");
-    return;
-  }
-
-  // Load power table if it exists
-  size_t len = prefs.getBytesLength("powerTbl");
-  if (len == sizeof(gPowerTable)) {
-    prefs.getBytes("powerTbl", gPowerTable, sizeof(gPowerTable));
-    Serial.println("[CAL] Power table loaded from NVS");
-  }
-
-  // Load ERG table if it exists
-  len = prefs.getBytesLength("ergTbl");
-  if (len == sizeof(gErgTable)) {
-    prefs.getBytes("ergTbl", gErgTable, sizeof(gErgTable));
-    Serial.println("[CAL] ERG table loaded from NVS");
-  }
-
-  // Load SIM table if it exists
-  len = prefs.getBytesLength("simTbl");
-  if (len == sizeof(gSimTable)) {
-    prefs.getBytes("simTbl", gSimTable, sizeof(gSimTable));
-    Serial.println("[CAL] SIM table loaded from NVS");
-  }
-
-  prefs.end();
-}
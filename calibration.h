@@ -1,7 +1,11 @@
 /*
  * calibration.h - Calibration and Settings Storage
  *
- * Stores user-adjustable calibration values and WiFi settings in non-volatile storage
+ * Stores user-adjustable calibration values and WiFi settings in non-volatile storage.
+ * Everything is kept in one versioned, CRC-checked NVS blob that is read once
+ * at boot. The *Save() functions only mark it changed; calibrationService()
+ * commits from loop() after a debounce, so edits never write flash inside an
+ * HTTP handler and a burst of edits costs one write.
  */
 
 #ifndef CALIBRATION_H
@@ -17,6 +21,18 @@ extern float gIdleCurveB;
 extern float gIdleCurveC;
 extern float gIdleCurveD;
 
+// ==================== ERG PI GAINS ====================
+extern bool  gErgPiEnabled;     // false = open-loop (table only)
+extern float gErgPiKp;          // steps/W at ERG_PI_REF_SPEED_MPH
+extern float gErgPiKi;          // steps/(W*s) at ERG_PI_REF_SPEED_MPH
+extern float gErgPiLimit;       // Max |correction| in steps
+extern float gErgLookaheadMs;   // Feed-forward speed projection (0 = off)
+extern bool  gErgFromPower;     // Feed-forward from the inverted power table, not the ERG table
+
+// ==================== INERTIA COMPENSATION ====================
+extern bool  gPowerInertiaEnabled;  // false = steady-state table power only
+extern float gPowerInertia;         // kg*m^2 at the roller
+
 // ==================== WIFI SETTINGS ====================
 extern char gWifiSsid[64];
 extern char gWifiPass[64];
@@ -27,6 +43,9 @@ extern char gDeviceId[8];       // Last 4 hex digits of MAC (e.g., "A1B2")
 extern char gDeviceName[32];    // User-friendly name (e.g., "Trainer1")
 extern bool gDeviceNameSet;     // true if user has set a custom name
 
+// ==================== FLEET TELEMETRY ====================
+extern uint8_t gFleetRateHz;    // Multicast telemetry datagrams per second (0 = off)
+
 // ==================== CALIBRATION TABLE DIMENSIONS ====================
 // Power table: speed (7) x position (5) -> watts
 static const int POWER_TABLE_ROWS = 7;   // Speed breakpoints
@@ -41,10 +60,28 @@ static const int SIM_TABLE_ROWS = 8;     // Speed breakpoints
 static const int SIM_TABLE_COLS = 7;     // Grade breakpoints
 
 // ==================== FUNCTIONS ====================
-void calibrationInit();         // Load from NVS (call in setup)
+void calibrationInit();         // Load everything from NVS (call in setup)
 void calibrationSave();         // Save IDLE curve calibration to NVS
 void calibrationReset();        // Reset IDLE curve to defaults
-void calibrationTablesLoad();   // Load calibration tables from NVS
+
+// Deferred commit
+struct CalibrationStats {
+  bool pending;                 // Changes not yet in flash
+  uint32_t commits;             // Blob writes since boot
+  uint32_t lastCommitUs;
+  uint32_t blobBytes;
+};
+void calibrationService();      // loop(): commits pending changes in an idle slot
+void calibrationFlush();        // Commit now (before a restart)
+void calibrationGetStats(CalibrationStats* out);
+
+// ERG PI gains
+void ergPiSave();               // Save ERG PI gains to NVS
+void ergPiReset();              // Reset ERG PI gains to defaults
+
+// Inertia compensation
+void inertiaSave();             // Save inertia constant to NVS
+void inertiaReset();            // Reset inertia constant to defaults
 
 // WiFi settings
 void wifiSettingsSave(const char* ssid, const char* pass);
@@ -56,6 +93,9 @@ void deviceNameClear();                 // Clear custom name (use default based
 const char* getEffectiveHostname();     // Get hostname for mDNS (custom name or "insideride-XXXX")
 const char* getEffectiveApSsid();       // Get AP SSID (custom name or "InsideRide-XXXX")
 
+// Fleet telemetry
+void fleetSettingsSave();               // Save gFleetRateHz to NVS
+
 // Calculate IDLE position from speed using current coefficients
 int32_t idlePositionFromSpeed(float speedMph);
 
@@ -71,6 +111,7 @@ void ergTableSave();
 void ergTableReset();
 void ergTableSet(int row, int col, double value);
 double ergTableGet(int row, int col);
+double ergEffectiveGet(int row, int col);   // Position ERG uses at the grid point (table or derived)
 
 // SIM table (speed x grade -> position)
 void simTableSave();
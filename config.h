@@ -10,49 +10,50 @@
 #include <Arduino.h>
 
 // ==================== VERSION ====================
-static const char* FW_VERSION = "2026-02_04_01";
+static const char* const FW_VERSION = "2026-02_04_01";
 
 // ==================== ZWIFT SPOOFING ====================
 // CRITICAL: Zwift checks BOTH advertising name AND manufacturer
 // If you change these, Zwift may not accept the trainer when power meter is connected
 
 // Advertising name (what users see in BLE scans)
-static const char* BLE_DEVICE_NAME = "KICKR CORE A1B2";  // Matches working code
+static const char* const BLE_DEVICE_NAME = "KICKR CORE A1B2";  // Matches working code
 
 // Device Information Service (what Zwift checks for whitelist)
-static const char* BLE_MANUFACTURER = "Wahoo Fitness";
-static const char* BLE_MODEL = "KICKR";
-static const char* BLE_FIRMWARE_VERSION = "4.10.0";
+static const char* const BLE_MANUFACTURER = "Wahoo Fitness";
+static const char* const BLE_MODEL = "KICKR";
+static const char* const BLE_FIRMWARE_VERSION = "4.10.0";
 
 // LEGAL NOTE: Spoofing Wahoo identity may have legal implications.
 // For commercial use, contact Zwift to whitelist your own manufacturer.
 // For personal use, understand the risks involved.
 
 // To use your own branding (may not work with power meter connected):
-// static const char* BLE_DEVICE_NAME = "InsideRideFTMS";
-// static const char* BLE_MANUFACTURER = "InsideRide";
-// static const char* BLE_MODEL = "Smart Trainer";
+// static const char* const BLE_DEVICE_NAME = "InsideRideFTMS";
+// static const char* const BLE_MANUFACTURER = "InsideRide";
+// static const char* const BLE_MODEL = "Smart Trainer";
 
 // ==================== WIFI & WEB SERVER ====================
 // AP Mode (fallback / default)
-static const char* AP_SSID = "InsideRideCal";
-static const char* AP_PASS = "insideride"; // >= 8 chars
+static const char* const AP_SSID = "InsideRideCal";
+static const char* const AP_PASS = "insideride"; // >= 8 chars
 
 // Client Mode (connect to home WiFi) - leave empty to disable
 // Set these to your home WiFi credentials for remote access
-static const char* WIFI_STA_SSID = "";  // e.g., "MyHomeWiFi"
-static const char* WIFI_STA_PASS = "";  // e.g., "mypassword"
+static const char* const WIFI_STA_SSID = "";  // e.g., "MyHomeWiFi"
+static const char* const WIFI_STA_PASS = "";  // e.g., "mypassword"
 static const uint32_t WIFI_STA_TIMEOUT_MS = 10000; // Connection timeout before AP fallback
 
 // OTA Authentication
-static const char* OTA_USER = "admin";
-static const char* OTA_PASS = "insiderideota";
+static const char* const OTA_USER = "admin";
+static const char* const OTA_PASS = "insiderideota";
 
 // OTA Settings
 static constexpr uint32_t OTA_UNLOCK_WINDOW_MS = 60 * 1000; // 60 seconds
 static constexpr bool OTA_DENY_WHEN_BLE_CONNECTED = true;
 static constexpr bool OTA_REQUIRE_LOW_SPEED = true;
 static constexpr float OTA_MAX_SPEED_MPH = 1.0f;
+static constexpr uint32_t OTA_STALL_TIMEOUT_MS = 15000;  // No upload data: abort and unpark
 
 // ==================== HARDWARE PINS ====================
 static const int STEP_PIN = D3;
@@ -65,6 +66,8 @@ static const int LED_PIN = D9;
 
 // LED Configuration
 static const bool LED_ACTIVE_HIGH = true;  // false if LED sinks to GND
+static constexpr uint8_t LED_LEDC_BITS = 18;       // Enough divider range for 1 Hz blinks
+static constexpr uint32_t LED_SELECT_MS = 50;      // Pattern re-evaluated at most this often
 
 // ==================== STEPPER MOTOR ====================
 // Logical travel (engineering units)
@@ -79,6 +82,10 @@ static const int32_t PHYS_MAX_STEPS = 6960;   // 870 * 8
 static const float DEFAULT_STEP_SPEED_SPS = 2500.0f;
 static const float HOMING_SPEED_SPS = 800.0f;
 
+// Warm boot: after a crash/brownout restart the restored position is checked
+// against the switch once the carriage is parked this close to it
+static const int32_t WARM_VERIFY_MAX_STEPS = 400;   // ~0.5 s of seek at HOMING_SPEED_SPS
+
 // ==================== SIMULATION ====================
 static const int UPPER_INCLINE_CLAMP = 10;
 static const int LOWER_INCLINE_CLAMP = -5;
@@ -87,13 +94,77 @@ static const int LOWER_INCLINE_CLAMP = -5;
 static constexpr int MPH_GRID_SIZE = 6;
 static constexpr int POS_GRID_SIZE = 5;
 
+// ==================== TASKS ====================
+// Control task: sensors -> target -> stepper at a fixed period.
+// Comms task: BLE notify, Control Point indications, advertising.
+// loop() (prio 1): web, LED, log.
+static constexpr uint32_t CONTROL_PERIOD_MS = 5;
+static constexpr uint32_t CONTROL_TASK_STACK = 6144;
+static constexpr int CONTROL_TASK_PRIORITY = 5;
+static constexpr uint32_t COMMS_TASK_STACK = 4096;
+static constexpr int COMMS_TASK_PRIORITY = 2;
+
 // ==================== BLE TIMING ====================
-static constexpr uint32_t POWER_NOTIFY_PERIOD_MS = 100;  // 10 Hz (matches original)
+// Indoor Bike Data is sent when the sensor pipeline has a new sample, at most
+// once per BLE_NOTIFY_MIN_INTERVAL_MS. Frames identical to the last one sent
+// are suppressed, except for a heartbeat every BLE_NOTIFY_HEARTBEAT_MS.
+static constexpr uint32_t BLE_NOTIFY_MIN_INTERVAL_MS = 100;  // 10 Hz max (matches original rate)
+static constexpr uint32_t BLE_NOTIFY_SLACK_MS = 25;         // Half a 20 Hz sample of scheduling jitter
+static constexpr uint32_t BLE_NOTIFY_HEARTBEAT_MS = 1000;
+static constexpr uint32_t BLE_COMMS_IDLE_WAIT_MS = 100;      // Comms task wake-up without samples
+
+// Cadence is not measured on rollers. When enabled, a synthetic 0/90 rpm
+// cadence is sent so app auto-pause works; otherwise the field is omitted.
+static constexpr bool BLE_SYNTHETIC_CADENCE = true;
+
+// ==================== BLE STACK ====================
+// 0 = ESP32 Arduino BLE (Bluedroid), 1 = NimBLE-Arduino 2.x (install the
+// "NimBLE-Arduino" library). Both expose the same GATT database, Wahoo DIS
+// and advertising layout; NimBLE needs less RAM and flash. Can also be set
+// from the build flags (-DBLE_USE_NIMBLE=1).
+#ifndef BLE_USE_NIMBLE
+#define BLE_USE_NIMBLE 0
+#endif
+
+// ==================== BLE ADVERTISING ====================
+// Interval in 0.625 ms units. FAST for BLE_ADV_FAST_WINDOW_MS after boot, a
+// disconnect or roller activity, then SLOW.
+static constexpr uint16_t BLE_ADV_FAST_MIN_UNITS = 32;    // 20 ms
+static constexpr uint16_t BLE_ADV_FAST_MAX_UNITS = 48;    // 30 ms
+static constexpr uint16_t BLE_ADV_SLOW_MIN_UNITS = 668;   // 417.5 ms
+static constexpr uint16_t BLE_ADV_SLOW_MAX_UNITS = 800;   // 500 ms
+static constexpr uint32_t BLE_ADV_FAST_WINDOW_MS = 30000;
+static constexpr float BLE_ADV_WAKE_RPM = 5.0f;           // Roller rpm that counts as activity
+
+// ==================== BLE LINK ====================
+// Requested after every connect; the central has the final say and the
+// values it grants are reported in /diag.json ("ble_link").
+static constexpr uint16_t BLE_CONN_INTERVAL_MIN = 12;     // 1.25 ms units (15 ms)
+static constexpr uint16_t BLE_CONN_INTERVAL_MAX = 24;     // 1.25 ms units (30 ms)
+static constexpr uint16_t BLE_CONN_LATENCY = 0;           // Connection events the peripheral may skip
+static constexpr uint16_t BLE_CONN_TIMEOUT = 400;         // 10 ms units (4 s supervision timeout)
+static constexpr uint16_t BLE_LOCAL_MTU = 247;            // Largest ATT MTU we accept
+static constexpr uint16_t BLE_DATA_LEN = 251;             // LL payload (data length extension)
+static constexpr bool BLE_PREFER_2M_PHY = true;           // Ask for 2M PHY (1M stays allowed)
 
 // ==================== HALL SENSOR / RPM ====================
 static const uint8_t HALL_PULSES_PER_REV = 6;      // Number of magnets
 static constexpr float ROLLER_DIAMETER_IN = 3.25f;  // Roller diameter in inches
 
+// Speed is measured over whole revolutions of edge timestamps, so uneven
+// magnet spacing cancels out. The window grows to the most revolutions that
+// fit in HALL_SPEED_WINDOW_US (always at least one).
+static constexpr uint32_t HALL_RING_SIZE = 64;          // Edge timestamps kept (power of 2)
+static constexpr uint32_t HALL_SPEED_WINDOW_US = 100000; // Averaging window target
+static_assert((HALL_RING_SIZE & (HALL_RING_SIZE - 1)) == 0, "HALL_RING_SIZE must be a power of 2");
+static_assert(HALL_RING_SIZE > HALL_PULSES_PER_REV, "HALL_RING_SIZE must hold a full revolution");
+
+// Speed/acceleration Kalman filter (state: rpm, rpm/s).
+// Raise JERK_NOISE for faster tracking, raise MEAS_NOISE for smoother output.
+static constexpr float SPEED_KF_MEAS_NOISE_RPM = 8.0f;      // 1-sigma measurement noise (~0.08 mph)
+static constexpr float SPEED_KF_JERK_NOISE = 4000.0f;       // White jerk density, rpm/s^2/sqrt(s)
+static constexpr float SPEED_KF_INIT_ACCEL_RPM_S = 500.0f;  // Initial accel uncertainty after start
+
 // ==================== IDLE MODE SPEED CURVE ====================
 // Cubic polynomial: pos = a + b*speed + c*speed^2 + d*speed^3
 // Default coefficients for IDLE mode resistance curve
@@ -102,4 +173,131 @@ static constexpr float IDLE_CURVE_DEFAULT_B = 20.3f;
 static constexpr float IDLE_CURVE_DEFAULT_C = -0.597f;
 static constexpr float IDLE_CURVE_DEFAULT_D = 0.0101f;
 
+// ==================== ERG CLOSED LOOP ====================
+// PI trim on top of the ERG table feed-forward: error = target - currentPowerWatts.
+// Gains are in steps per watt at ERG_PI_REF_SPEED_MPH and are scaled by
+// (ref speed / speed) because watts-per-step grows with roller speed.
+static constexpr float ERG_PI_DEFAULT_KP = 0.5f;       // steps / W
+static constexpr float ERG_PI_DEFAULT_KI = 1.0f;       // steps / (W*s)
+static constexpr float ERG_PI_DEFAULT_LIMIT = 200.0f;  // Max |correction| in steps
+static constexpr float ERG_PI_REF_SPEED_MPH = 15.0f;
+static constexpr float ERG_PI_MIN_SPEED_MPH = 3.0f;    // Below this: feed-forward only
+static constexpr float ERG_PI_SCALE_MIN = 0.4f;        // Gain schedule clamp
+static constexpr float ERG_PI_SCALE_MAX = 2.5f;
+static constexpr float ERG_PI_DEADBAND_W = 2.0f;       // No integration inside this band
+
+// Lookahead: the feed-forward uses speed projected forward (speed + accel *
+// lookahead) so resistance moves with the rider's cadence change instead of
+// after it. A manual setting (/erg_pi?la=), not measured from the actuator:
+// compare values on a ride with `host/tools/replay --lookahead`. 0 = off.
+static constexpr float ERG_LOOKAHEAD_DEFAULT_MS = 0.0f;
+static constexpr float ERG_LOOKAHEAD_MAX_MS = 1000.0f;
+static constexpr float ERG_LOOKAHEAD_MAX_DELTA_MPH = 3.0f;  // Clamp on the projection
+
+// ERG from the power table (option): the feed-forward is the inverse of the
+// power table instead of the ERG table, so ERG targets and reported power
+// always agree. The inverse is kept on a dense speed x watts grid spanning
+// the power table's speed axis and 0..(POINTS-1)*STEP watts.
+static constexpr int ERG_INV_SPEED_POINTS = 51;    // 1 mph over 0..50 mph
+static constexpr int ERG_INV_WATT_POINTS = 129;    // 0..2048 W
+static constexpr float ERG_INV_WATT_STEP = 16.0f;
+
+// ==================== INERTIA COMPENSATION ====================
+// Reported power = table power + I * w * dw/dt (w = roller angular speed).
+// I is the effective roller + flywheel inertia seen at the roller (kg*m^2),
+// measured by the coast-down routine and stored in NVS.
+static constexpr float POWER_INERTIA_DEFAULT = 0.04f;      // kg*m^2
+static constexpr float POWER_INERTIA_MAX = 1.0f;
+static constexpr float POWER_INERTIA_ACCEL_TAU_S = 0.25f;  // Smoothing of accel for this term only
+
+// Coast-down: spin up past START, stop pedaling, fit I until speed drops below END
+static constexpr float COAST_START_MPH = 18.0f;
+static constexpr float COAST_END_MPH = 8.0f;
+static constexpr float COAST_MIN_DECEL_MPH_S = 0.3f;       // Decel that marks "stopped pedaling"
+static constexpr float COAST_ABORT_ACCEL_MPH_S = 0.5f;     // Accel that means pedaling again
+static constexpr uint32_t COAST_ARM_TIMEOUT_MS = 60000;
+static constexpr uint16_t COAST_MIN_SAMPLES = 20;
+
+// ==================== CALIBRATION SWEEP ====================
+// Guided power-table fit against a BLE Cycling Power meter. For each speed
+// band (power-table rows between 0 and SWEEP_MAX_MPH) the stepper is held at
+// each position-axis point; steady windows (speed in band, no acceleration,
+// stepper at target) pair mean speed with mean meter power, and the cell is
+// the windows' linear fit evaluated at the band speed.
+static constexpr uint32_t METER_SCAN_MS = 5000;
+static constexpr uint32_t METER_STALE_MS = 3000;           // Older reading = no meter
+static constexpr uint32_t METER_TASK_STACK = 4096;
+static constexpr float SWEEP_MAX_MPH = 30.0f;              // Faster rows are left alone
+static constexpr uint32_t SWEEP_METER_WAIT_MS = 30000;     // For the first reading after start
+static constexpr uint32_t SWEEP_SETTLE_MS = 4000;          // After the stepper arrives (meter averaging lag)
+static constexpr uint32_t SWEEP_WINDOW_MS = 3000;
+static constexpr uint8_t SWEEP_WINDOWS_PER_CELL = 3;
+static constexpr uint8_t SWEEP_MIN_METER_SAMPLES = 2;      // Meter readings per window
+static constexpr float SWEEP_SPEED_TOL_MPH = 1.0f;         // Window speed vs. band
+static constexpr float SWEEP_ACCEL_MAX_MPH_S = 0.3f;
+static constexpr float SWEEP_FIT_MIN_SPREAD_MPH = 0.3f;    // Narrower: scale the mean instead of fitting
+static constexpr uint32_t SWEEP_CELL_TIMEOUT_MS = 120000;  // Cell skipped if it never settles
+
+// ==================== CALIBRATION STORAGE ====================
+// All settings live in one CRC-checked NVS blob. Edits mark it dirty; loop()
+// commits once no edit has arrived for the debounce time and the rollers are
+// stopped (a flash write stalls the control task), or during a ride after
+// the maximum deferral, at a moment the stepper is at its target.
+static constexpr uint32_t CAL_COMMIT_DEBOUNCE_MS = 2000;
+static constexpr uint32_t CAL_COMMIT_MAX_DEFER_MS = 60000;
+
+// ==================== RIDE RECORDER ====================
+// One record per sensor sample into a RAM double buffer; loop() appends full
+// buffers to SPIFFS. Two files (current + previous) share RECORDER_FLASH_SHARE
+// of the partition, so the oldest data is dropped once flash is full.
+static constexpr bool RECORDER_ENABLED_DEFAULT = true;
+static constexpr uint16_t RECORDER_BUFFER_RECORDS = 200;   // Per buffer (10 s at 20 Hz)
+static constexpr uint32_t RECORDER_TAIL_MS = 5000;         // Keep recording after the rollers stop
+static constexpr float RECORDER_FLASH_SHARE = 0.75f;       // SPIFFS needs free blocks for GC
+
+// ==================== RIDE REPLAY ====================
+// Runs the recordings back through the sensor/control pipeline on a virtual
+// clock (loop context, a slice of records per pass) into /replay.bin.
+static constexpr uint16_t REPLAY_SLICE_RECORDS = 100;      // Per loop() pass (5 s of ride)
+static constexpr uint32_t REPLAY_GAP_MAX_MS = 2000;        // Longer recording pauses are cut to this
+static constexpr uint32_t REPLAY_FREE_MARGIN_BYTES = 16384; // Stop writing output below this much free flash
+
+// ==================== FLEET TELEMETRY ====================
+// WiFi client mode only: one binary datagram per interval to a multicast
+// group (layout in fleet.h), announced over mDNS as _irfleet._udp. The rate
+// is a saved setting; 0 = off.
+static constexpr uint8_t FLEET_GROUP[4] = {239, 255, 73, 82};
+static constexpr uint16_t FLEET_PORT = 4782;
+static constexpr uint8_t FLEET_RATE_DEFAULT_HZ = 0;        // Off until enabled
+static constexpr uint8_t FLEET_RATE_MAX_HZ = 20;           // Sensor sample rate
+
+// ==================== POWER MANAGEMENT ====================
+// With the rollers stopped, the motor disabled and no BLE, web or OTA client
+// for POWER_IDLE_AFTER_MS, loop() drops the CPU clock, WiFi moves to deeper
+// modem sleep (client mode) and loop() sleeps between passes. A Hall edge,
+// BLE connect or web request wakes it at once. There is no current sensor:
+// the draw in /diag.json is modelled from these per-state figures (rough
+// ESP32-C6 datasheet values at 3.3 V; replace them with bench readings).
+static constexpr uint32_t POWER_IDLE_AFTER_MS = 60000;
+static constexpr uint32_t POWER_IDLE_CPU_MHZ = 80;         // Lowest clock that keeps WiFi/BLE up
+static constexpr uint32_t POWER_IDLE_LOOP_MS = 20;         // loop() sleep while idle (web poll)
+static constexpr float POWER_EST_ACTIVE_MA = 82.0f;        // 160 MHz, WiFi min modem sleep, BLE
+static constexpr float POWER_EST_IDLE_STA_MA = 38.0f;      // 80 MHz, WiFi max modem sleep, BLE
+static constexpr float POWER_EST_IDLE_AP_MA = 71.0f;       // AP mode: the radio cannot sleep
+
+// ==================== LOGGING ====================
+// Compile-time filter: 0=none 1=error 2=warn 3=info 4=debug (see log.h)
+#define LOG_LEVEL 3
+#define LOG_TO_SERIAL 1                              // 0 = ring buffer / web view only
+static constexpr size_t LOG_RING_SIZE = 4096;       // Bytes of RAM for log history
+
+// ==================== PROFILING ====================
+// 1 = time loop sections/loop period (cheap enough for production, see perf.h)
+#define ENABLE_PERF 1
+
+// ==================== DEBUG / BENCHMARKS ====================
+// 1 = compile the original double-precision table lookups and print a
+// cycle-count comparison against the fixed-point engine at boot
+#define ENABLE_LUT_BENCHMARK 0
+
 #endif // CONFIG_H
@@ -0,0 +1,101 @@
+/*
+ * control.cpp - ERG/SIM/IDLE Target Calculation Implementation
+ */
+
+#include "control.h"
+#include "ble_trainer.h"
+#include "stepper_control.h"
+#include "sensors.h"
+#include "calibration.h"
+#include "erg_control.h"
+#include "log.h"
+
+// ==================== CONTROL STATE ====================
+volatile int16_t ergTargetWatts = 0;        // ERG mode target power
+volatile float simGradePercent = 0.0f;      // SIM mode grade
+static int32_t targetLogicalPosition = 0;   // Computed target position
+
+// ==================== ERG/SIM MODE TARGET CALCULATION ====================
+int32_t controlTargetUpdate(float dtS) {
+  static ControlMode lastTargetMode = MODE_IDLE;
+
+  // Apply queued FTMS Control Point commands at the start of the tick
+  bleProcessCommands();
+
+  // Start every ERG session (and every manual hold) with a clean integrator
+  if (gMode != lastTargetMode || gManualHoldActive || gIsHoming) {
+    ergControlReset();
+  }
+  lastTargetMode = gMode;
+  
+  switch (gMode) {
+    case MODE_ERG: {
+      // ERG mode: table feed-forward (at the projected speed) plus PI trim on measured power
+      targetLogicalPosition = ergControlUpdate(currentSpeedMph, currentAccelMphS, ergTargetWatts, currentPowerWatts, dtS);
+      break;
+    }
+    
+    case MODE_SIM: {
+      // SIM mode: Calculate position from grade and current speed
+      int32_t pos = (int32_t)lroundf(gradeToSteps(currentSpeedMph, simGradePercent));
+      targetLogicalPosition = constrain(pos, LOGICAL_MIN, LOGICAL_MAX);
+      break;
+    }
+    
+    case MODE_IDLE:
+    default:
+      // IDLE mode: Use speed-based resistance curve (calibratable)
+      targetLogicalPosition = idlePositionFromSpeed(currentSpeedMph);
+      break;
+  }
+  
+  // Apply manual override if active
+  return gManualHoldActive ? gManualHoldTarget : targetLogicalPosition;
+}
+
+// ==================== BLE CONTROL POINT HANDLERS ====================
+// These are called from bleProcessCommands() (start of the target tick) when
+// Zwift sends commands; ble_trainer.cpp queues the Control Point response for
+// the comms task
+
+void handleRequestControl() {
+  LOG_I("BLE", "Request Control");
+}
+
+void handleResetControl() {
+  LOG_I("BLE", "Reset");
+  gMode = MODE_IDLE;
+}
+
+void handleSetTargetPower(uint16_t watts) {
+  LOG_I("BLE", "Set Target Power = %d W", watts);
+  gMode = MODE_ERG;
+  ergTargetWatts = watts;
+}
+
+void handleSetTargetResistance(uint8_t level) {
+  LOG_I("BLE", "Set Target Resistance = %d", level);
+  gMode = MODE_ERG;
+  
+  // Map resistance level to stepper position
+  int32_t target = map(level, 0, 100, LOGICAL_MIN, LOGICAL_MAX);
+  stepperSetTarget(target);
+}
+
+void handleSetIndoorBikeSimulation(int16_t windSpeed, int16_t grade, uint8_t crr, uint8_t cw) {
+  float gradePercent = grade / 100.0f;
+  LOG_I("BLE", "Simulation Mode - Grade: %.1f%%", gradePercent);
+  
+  gMode = MODE_SIM;
+  simGradePercent = gradePercent;
+}
+
+void handleStartResume() {
+  LOG_I("BLE", "Start/Resume");
+  // Could be used to enable stepper or other actions
+}
+
+void handleStopPause(uint8_t stopType) {
+  LOG_I("BLE", "Stop/Pause (type: %d)", stopType);
+  gMode = MODE_IDLE;
+}
@@ -0,0 +1,25 @@
+/*
+ * control.h - ERG/SIM/IDLE Target Calculation
+ *
+ * The mode logic between the sensors and the stepper: applies queued FTMS
+ * Control Point commands, then turns speed and power into a target
+ * position. The caller applies the result, so replay can run the same code
+ * without moving the motor.
+ */
+
+#ifndef CONTROL_H
+#define CONTROL_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ==================== CONTROL STATE ====================
+extern volatile int16_t ergTargetWatts;     // ERG mode target power
+extern volatile float simGradePercent;      // SIM mode grade
+
+// ==================== FUNCTIONS ====================
+// Control task, once per target tick; returns the logical target for
+// stepperSetTarget() (the manual hold target while a hold is active)
+int32_t controlTargetUpdate(float dtS);
+
+#endif // CONTROL_H
@@ -0,0 +1,71 @@
+/*
+ * erg_control.cpp - Closed-Loop ERG Controller Implementation
+ */
+
+#include "erg_control.h"
+#include "calibration.h"
+#include "sensors.h"
+
+// ==================== STATE ====================
+float gErgFeedForward = 0;
+float gErgCorrection = 0;
+float gErgProjectedMph = 0;
+
+static float gErgIntegral = 0;   // Integrator state, in steps
+
+// ==================== HELPERS ====================
+
+// Watts-per-step rises with speed, so the same watt error needs fewer steps
+static float ergGainScale(float speedMph) {
+  float scale = ERG_PI_REF_SPEED_MPH / speedMph;
+  return constrain(scale, ERG_PI_SCALE_MIN, ERG_PI_SCALE_MAX);
+}
+
+// ==================== PUBLIC FUNCTIONS ====================
+
+// Where the rider's speed will be once the stepper has moved
+float ergProjectSpeed(float speedMph, float accelMphS) {
+  if (gErgLookaheadMs <= 0.0f) return speedMph;
+  float delta = accelMphS * gErgLookaheadMs * 0.001f;
+  delta = constrain(delta, -ERG_LOOKAHEAD_MAX_DELTA_MPH, ERG_LOOKAHEAD_MAX_DELTA_MPH);
+  float projected = speedMph + delta;
+  return (projected > 0.0f) ? projected : 0.0f;
+}
+
+void ergControlReset() {
+  gErgIntegral = 0;
+  gErgCorrection = 0;
+}
+
+int32_t ergControlUpdate(float speedMph, float accelMphS, float targetWatts, float measuredWatts, float dtS) {
+  gErgProjectedMph = ergProjectSpeed(speedMph, accelMphS);
+  gErgFeedForward = stepFromPowerSpeed(gErgProjectedMph, targetWatts);
+
+  // Open loop when disabled or too slow for the power estimate to mean anything
+  if (!gErgPiEnabled || speedMph < ERG_PI_MIN_SPEED_MPH || targetWatts <= 0) {
+    ergControlReset();
+    return constrain((int32_t)lroundf(gErgFeedForward), LOGICAL_MIN, LOGICAL_MAX);
+  }
+
+  const float scale = ergGainScale(speedMph);
+  const float kp = gErgPiKp * scale;
+  const float ki = gErgPiKi * scale;
+  const float limit = gErgPiLimit;
+  const float error = targetWatts - measuredWatts;
+
+  const float p = constrain(kp * error, -limit, limit);
+  const float unsat = gErgFeedForward + p + gErgIntegral;
+
+  // Anti-windup: integrate only outside the deadband, and only if the
+  // output is not already pinned in the direction the error is pushing
+  bool pinnedHigh = (unsat >= LOGICAL_MAX || p + gErgIntegral >= limit);
+  bool pinnedLow = (unsat <= LOGICAL_MIN || p + gErgIntegral <= -limit);
+  if (fabsf(error) > ERG_PI_DEADBAND_W &&
+      !(error > 0 && pinnedHigh) && !(error < 0 && pinnedLow)) {
+    gErgIntegral += ki * error * dtS;
+    gErgIntegral = constrain(gErgIntegral, -limit, limit);
+  }
+
+  gErgCorrection = constrain(p + gErgIntegral, -limit, limit);
+  return constrain((int32_t)lroundf(gErgFeedForward + gErgCorrection), LOGICAL_MIN, LOGICAL_MAX);
+}
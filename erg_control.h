@@ -0,0 +1,31 @@
+/*
+ * erg_control.h - Closed-Loop ERG Controller
+ *
+ * The ERG table gives the feed-forward position for (speed, target watts);
+ * a bounded PI term trims it on (target - currentPowerWatts) so table error
+ * and roller drift do not become a steady-state watt offset. With a
+ * lookahead set (gErgLookaheadMs, a manual setting), the feed-forward is
+ * evaluated at the speed projected that far ahead.
+ */
+
+#ifndef ERG_CONTROL_H
+#define ERG_CONTROL_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ==================== DIAGNOSTICS ====================
+extern float gErgFeedForward;   // Last table position (logical steps)
+extern float gErgCorrection;    // Last PI correction (logical steps)
+extern float gErgProjectedMph;  // Speed the feed-forward was evaluated at
+
+// ==================== FUNCTIONS ====================
+void ergControlReset();         // Clear integrator (mode entry, manual hold, rehome)
+
+// speed + accel * gErgLookaheadMs, change clamped to +/-ERG_LOOKAHEAD_MAX_DELTA_MPH, >= 0
+float ergProjectSpeed(float speedMph, float accelMphS);
+
+// Returns the commanded logical position; call at a fixed rate in ERG mode
+int32_t ergControlUpdate(float speedMph, float accelMphS, float targetWatts, float measuredWatts, float dtS);
+
+#endif // ERG_CONTROL_H
@@ -0,0 +1,92 @@
+/*
+ * fleet.cpp - Fleet Telemetry Implementation
+ */
+
+#include "fleet.h"
+#include "calibration.h"
+#include "web_server.h"
+#include "log.h"
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#include <ESPmDNS.h>
+
+// ==================== STREAM STATE ====================
+static WiFiUDP gUdp;
+static bool gAvailable = false;
+static uint32_t gIntervalMs = 0;     // 0 = off
+static uint32_t gLastSendMs = 0;
+static uint16_t gSeq = 0;
+static FleetStats gStats = {};
+static uint8_t gDatagram[FLEET_DATAGRAM_MAX];
+
+static void applyRate() {
+  gIntervalMs = gFleetRateHz ? 1000 / gFleetRateHz : 0;
+  if (!gAvailable) return;
+  char rate[4];
+  snprintf(rate, sizeof(rate), "%u", (unsigned)gFleetRateHz);
+  MDNS.addServiceTxt("irfleet", "udp", "rate", rate);
+}
+
+// ==================== PUBLIC FUNCTIONS ====================
+
+void fleetInit() {
+  gAvailable = gWifiClientMode;
+  if (!gAvailable) {
+    Serial.println("  Fleet telemetry: off (AP mode)");
+    return;
+  }
+
+  char group[16], port[6];
+  snprintf(group, sizeof(group), "%u.%u.%u.%u", FLEET_GROUP[0], FLEET_GROUP[1], FLEET_GROUP[2], FLEET_GROUP[3]);
+  snprintf(port, sizeof(port), "%u", (unsigned)FLEET_PORT);
+  MDNS.addService("irfleet", "udp", FLEET_PORT);
+  MDNS.addServiceTxt("irfleet", "udp", "ver", String(FLEET_VERSION));
+  MDNS.addServiceTxt("irfleet", "udp", "group", group);
+  MDNS.addServiceTxt("irfleet", "udp", "port", port);
+  MDNS.addServiceTxt("irfleet", "udp", "id", gDeviceId);
+  MDNS.addServiceTxt("irfleet", "udp", "name", gDeviceNameSet ? gDeviceName : getEffectiveHostname());
+  applyRate();
+
+  Serial.printf("  Fleet telemetry: %s:%u, %u Hz\n", group, (unsigned)FLEET_PORT, (unsigned)gFleetRateHz);
+}
+
+void fleetService() {
+  if (!gAvailable || gIntervalMs == 0 || WiFi.status() != WL_CONNECTED) return;
+  const uint32_t now = millis();
+  if (now - gLastSendMs < gIntervalMs) return;
+  // Keep the cadence; after a stall, start over rather than send a burst
+  gLastSendMs = (now - gLastSendMs < 2 * gIntervalMs) ? gLastSendMs + gIntervalMs : now;
+
+  TelemetryFrame frame;
+  telemetryCapture(&frame);
+  const size_t len = fleetEncode(frame, gSeq++, gDatagram, sizeof(gDatagram));
+
+  const IPAddress group(FLEET_GROUP[0], FLEET_GROUP[1], FLEET_GROUP[2], FLEET_GROUP[3]);
+  if (len == 0 || !gUdp.beginPacket(group, FLEET_PORT)) {
+    gStats.errors++;
+    return;
+  }
+  gUdp.write(gDatagram, len);
+  if (!gUdp.endPacket()) {
+    gStats.errors++;
+    return;
+  }
+  gStats.sent++;
+  gStats.bytes += len;
+  gStats.lastLen = (uint16_t)len;
+}
+
+void fleetSetRate(uint8_t hz) {
+  hz = min(hz, FLEET_RATE_MAX_HZ);
+  if (hz == gFleetRateHz) return;
+  gFleetRateHz = hz;
+  applyRate();
+  fleetSettingsSave();
+  LOG_I("FLEET", "Rate %u Hz%s", (unsigned)hz, gAvailable ? "" : " (sent in WiFi client mode only)");
+}
+
+void fleetGetStats(FleetStats* out) {
+  *out = gStats;
+  out->available = gAvailable;
+  out->rateHz = gFleetRateHz;
+}
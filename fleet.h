@@ -0,0 +1,52 @@
+/*
+ * fleet.h - Fleet Telemetry over UDP Multicast
+ *
+ * In WiFi client mode each trainer sends its telemetry to a multicast group
+ * at gFleetRateHz, one datagram per interval, so a single collector can
+ * watch a room of trainers without polling any of them. The stream is
+ * announced over mDNS as _irfleet._udp, with TXT items
+ *   ver, group, port, rate, id, name
+ * (rate=0 while it is off).
+ *
+ * Datagram (little-endian):
+ *   [0..1]  'I' 'R'
+ *   [2]     FLEET_VERSION
+ *   [3]     name length N (0..31)
+ *   [4..5]  sequence number
+ *   [6..9]  millis() on the trainer
+ *   [10..13] gDeviceId (4 ASCII hex digits)
+ *   [14..]  gDeviceName (N bytes, not terminated), then a full binary
+ *           telemetry frame as in telemetry.h (0xA5, seq, mask, values)
+ *
+ * Every datagram carries every field: a lost one costs nothing but its
+ * own sample.
+ */
+
+#ifndef FLEET_H
+#define FLEET_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "telemetry.h"
+
+static constexpr uint8_t FLEET_VERSION = 1;
+static constexpr size_t FLEET_HEADER = 14;
+static constexpr size_t FLEET_NAME_MAX = 31;
+static constexpr size_t FLEET_DATAGRAM_MAX = FLEET_HEADER + FLEET_NAME_MAX + TELEMETRY_BIN_MAX;
+
+struct FleetStats {
+  bool available;       // WiFi client mode (the stream never runs in AP mode)
+  uint8_t rateHz;       // 0 = off
+  uint32_t sent;
+  uint32_t errors;      // Datagrams the stack refused
+  uint32_t bytes;
+  uint16_t lastLen;     // Size of the last datagram
+};
+
+void fleetInit();                 // After WiFi and mDNS are up
+void fleetService();              // loop(): sends when due
+void fleetSetRate(uint8_t hz);    // 0 = off; clamped to FLEET_RATE_MAX_HZ, saved
+void fleetGetStats(FleetStats* out);
+size_t fleetEncode(const TelemetryFrame& frame, uint16_t seq, uint8_t* out, size_t outSize);
+
+#endif // FLEET_H
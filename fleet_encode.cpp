@@ -0,0 +1,31 @@
+/*
+ * fleet_encode.cpp - Fleet Datagram Encoder
+ *
+ * Kept apart from fleet.cpp (UDP, mDNS) so the wire format builds and is
+ * tested on the host.
+ */
+
+#include "fleet.h"
+#include "calibration.h"
+
+// ==================== PUBLIC FUNCTIONS ====================
+
+size_t fleetEncode(const TelemetryFrame& frame, uint16_t seq, uint8_t* out, size_t outSize) {
+  const char* name = gDeviceNameSet ? gDeviceName : getEffectiveHostname();
+  const size_t nameLen = min(strlen(name), FLEET_NAME_MAX);
+  if (outSize < FLEET_HEADER + nameLen + TELEMETRY_BIN_MAX) return 0;
+
+  const uint32_t ms = millis();
+  out[0] = 'I';
+  out[1] = 'R';
+  out[2] = FLEET_VERSION;
+  out[3] = (uint8_t)nameLen;
+  out[4] = (uint8_t)(seq & 0xFF);
+  out[5] = (uint8_t)(seq >> 8);
+  for (uint8_t b = 0; b < 4; b++) out[6 + b] = (uint8_t)(ms >> (8 * b));
+  for (uint8_t b = 0; b < 4; b++) out[10 + b] = gDeviceId[b] ? (uint8_t)gDeviceId[b] : '0';
+  memcpy(out + FLEET_HEADER, name, nameLen);
+
+  const size_t n = FLEET_HEADER + nameLen;
+  return n + telemetryEncodeBinary(frame, NULL, (uint8_t)seq, out + n, outSize - n);
+}
@@ -0,0 +1,313 @@
+/*
+ * bench.cpp - Host Benchmarks for the Control Hot Paths
+ *
+ *   bench            Full run
+ *   bench --quick    Short run (ctest); fails if step timing is off-profile
+ *
+ * The ERG lookahead section records a ride of cadence surges through the
+ * firmware's recorder and replays it (real planner on the simulated timer)
+ * at several lookaheads. The rider's speed is the recording's either way,
+ * so only the feed-forward timing changes between runs.
+ *
+ * Host timings are for comparing changes on one machine, not ESP32 cycles
+ * (ENABLE_LUT_BENCHMARK prints those on the device).
+ */
+
+#include "host_sim.h"
+#include "sensors.h"
+#include "calibration.h"
+#include "stepper_control.h"
+#include "control.h"
+#include "ble_trainer.h"
+#include "ble_backend.h"
+#include "trainer_state.h"
+#include "recorder.h"
+#include "replay.h"
+#include "../tools/replay_clock.h"
+#include <chrono>
+#include <vector>
+#include <string.h>
+
+// Ramp limits of the profile in stepper_control.cpp (runSpeedSps, rampStartSps, rampAccelSps2)
+static const float PROFILE_RUN_SPS = DEFAULT_STEP_SPEED_SPS;
+static const float PROFILE_START_SPS = 900.0f;
+static const float PROFILE_ACCEL_SPS2 = 6000.0f;
+
+static volatile float gSink;
+static int gFailures = 0;
+
+static double nowNs() {
+  using namespace std::chrono;
+  return (double)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+// ==================== LOOKUPS ====================
+
+// Inputs spread over the whole table (and a little outside it)
+struct LookupInputs {
+  std::vector<float> speed, y;
+};
+
+static LookupInputs makeInputs(size_t n, float yMin, float yMax) {
+  LookupInputs in;
+  uint32_t s = 12345;
+  for (size_t i = 0; i < n; i++) {
+    s = s * 1664525u + 1013904223u;
+    in.speed.push_back((s >> 8) % 5200 * 0.01f);
+    s = s * 1664525u + 1013904223u;
+    in.y.push_back(yMin + ((s >> 8) % 10000) * 1e-4f * (yMax - yMin));
+  }
+  return in;
+}
+
+static void benchLookup(const char* name, float (*fn)(float, float), float yMin, float yMax, int rounds) {
+  const LookupInputs in = makeInputs(4096, yMin, yMax);
+  double best = 1e18;
+  for (int r = 0; r < rounds; r++) {
+    const double t0 = nowNs();
+    for (size_t i = 0; i < in.speed.size(); i++) gSink = fn(in.speed[i], in.y[i]);
+    const double ns = (nowNs() - t0) / in.speed.size();
+    if (ns < best) best = ns;
+  }
+  printf("  %-20s %7.1f ns/call  %7.2f M calls/s\n", name, best, 1e3 / best);
+}
+
+// Cost of one power table edit: LUT cells plus the affected ERG inverse rows
+static void benchPowerCellEdit(int edits) {
+  const double old = powerTableGet(3, 2);
+  const double t0 = nowNs();
+  for (int i = 0; i < edits; i++) powerTableSet(3, 2, old + (i & 1));
+  const double us = (nowNs() - t0) / edits * 1e-3;
+  powerTableSet(3, 2, old);
+  printf("  %-20s %7.1f us/edit\n", "powerTableSet", us);
+}
+
+// ==================== STEPPER ====================
+
+static std::vector<uint64_t> gEdges;
+
+static void pinHook(int pin, int level, uint64_t timeUs) {
+  if (pin == STEP_PIN && level) gEdges.push_back(timeUs);
+}
+
+// One move, timed from the pulses on the STEP pin
+static void benchMove(int32_t fromLog, int32_t toLog) {
+  stepperSetTarget(fromLog);
+  for (int i = 0; i < 1000 && logStepPos != fromLog; i++) {
+    hostAdvanceUs(5000);
+    stepperUpdate();
+  }
+
+  gEdges.clear();
+  stepperResetPulseStats();
+  const int32_t goal = logicalToSteps(toLog);
+  const uint64_t startUs = hostTimeUs();
+  stepperSetTarget(toLog);
+
+  const double t0 = nowNs();
+  while (physStepPos != goal && hostTimeUs() - startUs < 20000000) {
+    hostAdvanceUs(5000);
+    stepperUpdate();
+  }
+  const double hostNs = nowNs() - t0;
+  const size_t steps = gEdges.size();
+  if (steps < 2) {
+    printf("  move %d -> %d: no steps\n", (int)fromLog, (int)toLog);
+    gFailures++;
+    return;
+  }
+
+  // Speed from each pulse gap; acceleration over 64-step windows so the
+  // 1 us interval quantization does not dominate
+  const size_t W = 64;
+  double peakSps = 0, peakAccel = 0;
+  for (size_t i = 1; i < steps; i++) {
+    const double sps = 1e6 / (double)(gEdges[i] - gEdges[i - 1]);
+    if (sps > peakSps) peakSps = sps;
+  }
+  for (size_t i = W + 1; i < steps; i++) {
+    const double v1 = 1e6 / (double)(gEdges[i] - gEdges[i - 1]);
+    const double v0 = 1e6 / (double)(gEdges[i - W] - gEdges[i - W - 1]);
+    const double accel = fabs(v1 - v0) / ((gEdges[i] - gEdges[i - W]) * 1e-6);
+    if (accel > peakAccel) peakAccel = accel;
+  }
+
+  // Trapezoid from the start speed at the configured limits (no jerk): the
+  // time an ideal planner would need
+  const double d = (double)steps;
+  const double vs = PROFILE_START_SPS, vr = PROFILE_RUN_SPS, a = PROFILE_ACCEL_SPS2;
+  const double rampSteps = (vr * vr - vs * vs) / a;   // Up and down
+  double idealS;
+  if (d >= rampSteps) {
+    idealS = 2.0 * (vr - vs) / a + (d - rampSteps) / vr;
+  } else {
+    idealS = 2.0 * (sqrt(vs * vs + a * d) - vs) / a;
+  }
+  const double moveS = (gEdges.back() - gEdges.front()) * 1e-6;
+
+  printf("  move %4d -> %4d: %5u steps  %6.3f s (trapezoid %.3f s)  peak %6.0f sps  "
+         "peak accel %5.0f sps^2  late max %u us  host %.0f ns/step\n",
+         (int)fromLog, (int)toLog, (unsigned)steps, moveS, idealS, peakSps, peakAccel,
+         (unsigned)gStepLateMaxUs, hostNs / d);
+
+  if (physStepPos != goal) { printf("    FAIL: did not arrive\n"); gFailures++; }
+  if (peakSps > PROFILE_RUN_SPS * 1.01) { printf("    FAIL: above run speed\n"); gFailures++; }
+  if (peakAccel > PROFILE_ACCEL_SPS2 * 1.10) { printf("    FAIL: above max accel\n"); gFailures++; }
+  if (gStepLateMaxUs > 3) { printf("    FAIL: pulses late\n"); gFailures++; }
+}
+
+static void benchStepperUpdate(int calls) {
+  const double t0 = nowNs();
+  for (int i = 0; i < calls; i++) stepperUpdate();
+  const double ns = (nowNs() - t0) / calls;
+  printf("  %-20s %7.1f ns/call\n", "stepperUpdate", ns);
+}
+
+// ==================== ERG LOOKAHEAD ====================
+
+// Ride time (s) of the surges: 15 mph at 350 W until then, 15 <-> 19 mph
+// (4 mph/s each way) every 8 s, then stop
+static const float SURGE_START_S = 12.0f;
+static const float SURGE_END_S = 44.0f;
+
+static float surgeRideMph(float tS) {
+  if (tS < 4.0f) return 3.75f * tS;
+  if (tS < SURGE_START_S) return 15.0f;
+  if (tS >= SURGE_END_S) return 0.0f;
+  const float c = fmodf(tS - SURGE_START_S, 8.0f);
+  if (c < 3.0f) return 15.0f;
+  if (c < 4.0f) return 15.0f + 4.0f * (c - 3.0f);
+  if (c < 7.0f) return 19.0f;
+  return 19.0f - 4.0f * (c - 7.0f);
+}
+
+// The control task's schedule (5 ms housekeeping, 20 Hz target and sample)
+// with a central setting ERG 350 W; returns the records written
+static size_t recordSurgeRide() {
+  const uint64_t start = hostTimeUs();
+  uint64_t nextEdgeUs = start;
+  bool sentErg = false;
+  for (uint32_t tick = 0;; tick++) {
+    const uint64_t tickUs = start + (uint64_t)tick * CONTROL_PERIOD_MS * 1000;
+    const float tS = (tickUs - start) * 1e-6f;
+    if (tS > SURGE_END_S + 8.0f) break;
+
+    while (nextEdgeUs <= tickUs) {
+      hostAdvanceUs(nextEdgeUs - hostTimeUs());
+      const float mph = surgeRideMph((nextEdgeUs - start) * 1e-6f);
+      if (mph > 0.5f) {
+        hallISR();
+        nextEdgeUs += (uint64_t)(60e6f / (mphToRpm(mph) * HALL_PULSES_PER_REV));
+      } else {
+        nextEdgeUs += 1000;
+      }
+    }
+    hostAdvanceUs(tickUs - hostTimeUs());
+
+    if (!sentErg && tS >= 2.0f) {
+      const uint8_t cp[] = {FTMS_OP_SET_TARGET_POWER, 350 & 0xFF, 350 >> 8};
+      bleOnControlPointWrite(cp, sizeof(cp));
+      sentErg = true;
+    }
+
+    stepperUpdate();
+    stepperUpdateSpeedBasedEnable(currentSpeedMph);
+    if (tick % 10 == 0) {
+      sensorsUpdate();
+      stepperSetTarget(controlTargetUpdate(0.05f));
+      trainerStatePublish();
+      TrainerSnapshot snap;
+      trainerStateRead(&snap);
+      recorderSample(snap, hallLastIntervalUs());
+      recorderService();
+    }
+  }
+  return hostSpiffsGet(RECORDER_FILE, NULL, 0) / sizeof(RecorderRecord);
+}
+
+// Replayed power minus setpoint over the surges (the spin-up is the same
+// at every lookahead and would swamp the difference)
+static void surgeError(uint32_t startMs, float* rmsW, float* maxW) {
+  std::vector<RecorderRecord> out(hostSpiffsGet(REPLAY_FILE, NULL, 0) / sizeof(RecorderRecord));
+  hostSpiffsGet(REPLAY_FILE, out.data(), out.size() * sizeof(RecorderRecord));
+  double sum2 = 0.0;
+  size_t n = 0;
+  *maxW = 0.0f;
+  for (const RecorderRecord& r : out) {
+    const float tS = (r.ms - startMs) * 1e-3f;
+    if (tS < SURGE_START_S || tS >= SURGE_END_S || r.mode != MODE_ERG) continue;
+    const float err = (float)(r.powerW - r.setpoint);
+    sum2 += err * err;
+    *maxW = max(*maxW, fabsf(err));
+    n++;
+  }
+  *rmsW = n ? sqrtf(sum2 / n) : 0.0f;
+}
+
+static void benchErgLookahead() {
+  recorderInit();
+  const size_t records = recordSurgeRide();
+  RecorderRecord first;
+  hostSpiffsGet(RECORDER_FILE, &first, sizeof(first));
+  printf("ERG lookahead (recorded ride, 15 <-> 19 mph surges at 350 W, %u records, replayed):\n",
+         (unsigned)records);
+
+  const float savedMs = gErgLookaheadMs;
+  static const float LOOKAHEADS_MS[] = {0.0f, 100.0f, 200.0f, 300.0f, 400.0f};
+  for (float ms : LOOKAHEADS_MS) {
+    gErgLookaheadMs = ms;
+    hostStepperPark(first.pos);
+    hostReplayClockReset();
+    if (!replayStart(hostReplayClock)) {
+      printf("  FAIL: replay did not start\n");
+      gFailures++;
+      break;
+    }
+    while (replayActive()) replayService();
+    ReplayStats st;
+    replayGetStats(&st);
+    float rmsW, maxW;
+    surgeError(first.ms, &rmsW, &maxW);
+    printf("  lookahead %3.0f ms: surges rms %5.1f / max %3.0f W   whole ride rms %5.1f / max %3.0f W\n",
+           ms, rmsW, maxW, st.ergRmsW, st.ergMaxW);
+    if (st.ergRecords == 0) { printf("    FAIL: no ERG records\n"); gFailures++; }
+  }
+  gErgLookaheadMs = savedMs;
+}
+
+int main(int argc, char** argv) {
+  const bool quick = (argc > 1 && strcmp(argv[1], "--quick") == 0);
+  const int rounds = quick ? 5 : 200;
+
+  sensorsInit();
+  printf("Lookups (best of %d x 4096 calls):\n", rounds);
+  benchLookup("powerFromSpeedPos", powerFromSpeedPos, -10.0f, 1010.0f, rounds);
+  benchLookup("stepFromPowerSpeed", stepFromPowerSpeed, -10.0f, 1010.0f, rounds);
+  benchLookup("gradeToSteps", gradeToSteps, -5.0f, 11.0f, rounds);
+  gErgFromPower = true;
+  benchLookup("stepFromPowerSpeed*", stepFromPowerSpeed, -10.0f, 1010.0f, rounds);
+  gErgFromPower = false;
+  benchPowerCellEdit(quick ? 100 : 10000);
+  printf("  (* ERG from the inverted power table)\n");
+
+  hostSetPinHook(pinHook);
+  stepperInit();
+  stepperEnable(true);
+
+  printf("Stepper (profile %.0f sps, %.0f sps^2):\n", PROFILE_RUN_SPS, PROFILE_ACCEL_SPS2);
+  benchStepperUpdate(quick ? 10000 : 1000000);
+  benchMove(0, 1000);
+  benchMove(1000, 0);
+  benchMove(0, 150);
+  if (!quick) {
+    benchMove(150, 165);
+    benchMove(165, 600);
+    benchMove(600, 400);
+  }
+
+  hostSetPinHook(NULL);
+  benchErgLookahead();
+
+  if (gFailures) printf("%d check(s) failed\n", gFailures);
+  return gFailures ? 1 : 0;
+}
@@ -0,0 +1,32 @@
+/*
+ * host_stubs.cpp - BLE Backend Stand-In for the Host Build
+ *
+ * ble_trainer.cpp (queue, dispatch, notifications) builds as is; the stack
+ * behind it is replaced by these no-ops. Nothing connects, so
+ * deviceConnected stays false and no power meter is ever found (tests feed
+ * bleOnConnect() and bleOnMeterMeasurement() directly). Control Point
+ * indications go to the hook from hostSetIndicateHook().
+ *
+ * web_server.cpp is not built either; telemetry.cpp only needs its WiFi
+ * state, which stays in AP mode here.
+ */
+
+#include "ble_backend.h"
+#include "host_sim.h"
+
+bool gWifiClientMode = false;
+
+static HostIndicateHook gIndicateHook = NULL;
+
+void hostSetIndicateHook(HostIndicateHook hook) { gIndicateHook = hook; }
+
+const char* bleBackendName() { return "host"; }
+void bleBackendInit() {}
+void bleBackendNotifyIndoorBike(const uint8_t*, size_t) {}
+void bleBackendNotifyStatus(const uint8_t*, size_t) {}
+void bleBackendIndicateControlPoint(const uint8_t* data, size_t len) {
+  if (gIndicateHook) gIndicateHook(data, len);
+}
+void bleBackendStartAdvertising(uint16_t, uint16_t) {}
+bool bleBackendMeterConnect(const uint8_t*, uint32_t) { return false; }
+void bleBackendMeterDisconnect() {}
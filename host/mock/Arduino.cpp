@@ -0,0 +1,273 @@
+/*
+ * Arduino.cpp - Host Mock Implementation (simulated clock, pins, timer, NVS)
+ */
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <WiFi.h>
+#include <nvs_flash.h>
+#include <esp_timer.h>
+#include <esp_rom_sys.h>
+#include <esp_system.h>
+#include <driver/gpio.h>
+#include "host_sim.h"
+#include <stdarg.h>
+#include <map>
+#include <vector>
+
+HardwareSerial Serial;
+EspClass ESP;
+WiFiClass WiFi;
+
+// ==================== CLOCK ====================
+static uint64_t gNowUs = 0;
+static bool gInIsr = false;
+
+struct hw_timer_s {
+  void (*isr)(void) = NULL;
+  uint64_t alarmUs = 0;      // Ticks are 1 us (all callers use 1 MHz)
+  uint64_t periodStartUs = 0;
+  bool running = false;
+  bool autoreload = false;
+};
+
+static hw_timer_s gTimer;    // The firmware uses a single timer
+
+uint64_t hostTimeUs() {
+  return gNowUs;
+}
+
+// Fires the timer ISR at each alarm up to `until`. The counter restarts at
+// the alarm (auto-reload), so ISR run time does not shift the schedule; an
+// ISR that re-arms changes the alarm of the period that just started.
+void hostAdvanceUs(uint64_t us) {
+  const uint64_t until = gNowUs + us;
+  while (!gInIsr && gTimer.running && gTimer.isr && gTimer.alarmUs > 0 &&
+         gTimer.periodStartUs + gTimer.alarmUs <= until) {
+    const uint64_t fireUs = gTimer.periodStartUs + gTimer.alarmUs;
+    if (fireUs > gNowUs) gNowUs = fireUs;
+    gTimer.periodStartUs = fireUs;
+    if (!gTimer.autoreload) gTimer.running = false;
+    gInIsr = true;
+    gTimer.isr();
+    gInIsr = false;
+  }
+  if (until > gNowUs) gNowUs = until;
+}
+
+uint32_t millis() { return (uint32_t)(gNowUs / 1000); }
+uint32_t micros() { return (uint32_t)gNowUs; }
+int64_t esp_timer_get_time() { return (int64_t)gNowUs; }
+uint32_t EspClass::getCycleCount() { return (uint32_t)(gNowUs * 160); }
+void EspClass::restart() { exit(0); }
+
+static esp_reset_reason_t gResetReason = ESP_RST_POWERON;
+void hostSetResetReason(int reason) { gResetReason = (esp_reset_reason_t)reason; }
+esp_reset_reason_t esp_reset_reason() { return gResetReason; }
+
+void delay(uint32_t ms) { hostAdvanceUs((uint64_t)ms * 1000); }
+void delayMicroseconds(uint32_t us) { hostAdvanceUs(us); }
+void yield() {}
+
+// Busy-wait inside an ISR: time passes, but no nested timer interrupt
+void esp_rom_delay_us(uint32_t us) {
+  if (gInIsr) gNowUs += us;
+  else hostAdvanceUs(us);
+}
+
+// ==================== HARDWARE TIMER ====================
+
+hw_timer_t* timerBegin(uint32_t frequency) {
+  if (frequency != 1000000) {
+    fprintf(stderr, "host: timerBegin(%u) - only 1 MHz is simulated\n", (unsigned)frequency);
+    return NULL;
+  }
+  gTimer = hw_timer_s();
+  gTimer.periodStartUs = gNowUs;
+  gTimer.running = true;
+  return &gTimer;
+}
+
+void timerEnd(hw_timer_t* t) { if (t) t->running = false; }
+void timerAttachInterrupt(hw_timer_t* t, void (*isr)(void)) { if (t) t->isr = isr; }
+void timerDetachInterrupt(hw_timer_t* t) { if (t) t->isr = NULL; }
+void timerStart(hw_timer_t* t) { if (t) { t->running = true; t->periodStartUs = gNowUs; } }
+void timerStop(hw_timer_t* t) { if (t) t->running = false; }
+
+void timerAlarm(hw_timer_t* t, uint64_t alarmValue, bool autoreload, uint64_t reloadCount) {
+  if (!t) return;
+  (void)reloadCount;
+  t->alarmUs = alarmValue;
+  t->autoreload = autoreload;
+  if (!gInIsr) t->periodStartUs = gNowUs;   // From task context the counter restarts
+}
+
+// ==================== GPIO ====================
+static int gPinIn[64];
+static bool gPinInInit = false;
+static HostPinHook gPinHook = NULL;
+
+static int& pinIn(int pin) {
+  if (!gPinInInit) {
+    for (int i = 0; i < 64; i++) gPinIn[i] = HIGH;
+    gPinInInit = true;
+  }
+  return gPinIn[pin & 63];
+}
+
+void hostSetPin(int pin, int level) { pinIn(pin) = level ? HIGH : LOW; }
+void hostSetPinHook(HostPinHook hook) { gPinHook = hook; }
+
+void pinMode(int, int) {}
+void digitalWrite(int pin, int level) { if (gPinHook) gPinHook(pin, level, gNowUs); }
+int digitalRead(int pin) { return pinIn(pin); }
+int digitalPinToInterrupt(int pin) { return pin; }
+void attachInterrupt(int, void (*)(), int) {}
+void detachInterrupt(int) {}
+void noInterrupts() {}
+void interrupts() {}
+
+esp_err_t gpio_set_level(gpio_num_t pin, uint32_t level) {
+  if (gPinHook) gPinHook(pin, level ? HIGH : LOW, gNowUs);
+  return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t pin) { return pinIn(pin); }
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// ==================== SERIAL ====================
+static bool gSerialEcho = false;
+
+void hostSerialEcho(bool on) { gSerialEcho = on; }
+
+size_t Print::write(const uint8_t* data, size_t len) {
+  if (gSerialEcho) fwrite(data, 1, len, stdout);
+  return len;
+}
+
+size_t Print::print(long v) {
+  char b[24];
+  snprintf(b, sizeof(b), "%ld", v);
+  return write(b);
+}
+
+size_t Print::println(const char* s) { return write(s) + write("\r\n"); }
+size_t Print::println(long v) { return print(v) + write("\r\n"); }
+
+size_t Print::printf(const char* fmt, ...) {
+  char b[512];
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(b, sizeof(b), fmt, ap);
+  va_end(ap);
+  if (n < 0) return 0;
+  return write((const uint8_t*)b, std::min((size_t)n, sizeof(b) - 1));
+}
+
+// ==================== CPU CLOCK / TASKS ====================
+static uint32_t gCpuMhz = 160;
+static uint32_t gTaskNotify = 0;
+
+bool setCpuFrequencyMhz(uint32_t mhz) {
+  gCpuMhz = mhz;
+  return true;
+}
+
+uint32_t getCpuFrequencyMhz() { return gCpuMhz; }
+
+TaskHandle_t xTaskGetCurrentTaskHandle() { return &gTaskNotify; }
+
+BaseType_t xTaskNotifyGive(TaskHandle_t) {
+  gTaskNotify++;
+  return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t, BaseType_t* woken) {
+  gTaskNotify++;
+  if (woken) *woken = pdFALSE;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks) {
+  if (gTaskNotify == 0) {
+    hostAdvanceUs((uint64_t)ticks * 1000);
+    return 0;
+  }
+  const uint32_t n = gTaskNotify;
+  gTaskNotify = clearOnExit ? 0 : n - 1;
+  return n;
+}
+
+// ==================== WIFI ====================
+
+uint8_t* WiFiClass::macAddress(uint8_t* mac) {
+  static const uint8_t HOST_MAC[6] = {0x02, 0x00, 0x00, 0x12, 0x34, 0x56};
+  memcpy(mac, HOST_MAC, 6);
+  return mac;
+}
+
+// ==================== NVS / PREFERENCES ====================
+typedef std::map<std::string, std::vector<uint8_t>> PrefsNamespace;
+static std::map<std::string, PrefsNamespace> gPrefs;
+
+void hostPrefsClear() { gPrefs.clear(); }
+
+esp_err_t nvs_flash_init() { return ESP_OK; }
+esp_err_t nvs_flash_erase() { gPrefs.clear(); return ESP_OK; }
+
+bool Preferences::begin(const char* name, bool readOnly) {
+  ns_ = name;
+  open_ = true;
+  readOnly_ = readOnly;
+  return true;
+}
+
+void Preferences::end() { open_ = false; }
+
+bool Preferences::clear() {
+  if (!open_ || readOnly_) return false;
+  gPrefs[ns_].clear();
+  return true;
+}
+
+bool Preferences::remove(const char* key) {
+  if (!open_ || readOnly_) return false;
+  return gPrefs[ns_].erase(key) > 0;
+}
+
+bool Preferences::isKey(const char* key) {
+  return open_ && gPrefs[ns_].count(key) > 0;
+}
+
+size_t Preferences::putBytes(const char* key, const void* v, size_t len) {
+  if (!open_ || readOnly_) return 0;
+  const uint8_t* p = (const uint8_t*)v;
+  gPrefs[ns_][key] = std::vector<uint8_t>(p, p + len);
+  return len;
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+  if (!open_) return 0;
+  PrefsNamespace& ns = gPrefs[ns_];
+  auto it = ns.find(key);
+  return (it == ns.end()) ? 0 : it->second.size();
+}
+
+size_t Preferences::getBytes(const char* key, void* buf, size_t maxLen) {
+  if (!open_) return 0;
+  PrefsNamespace& ns = gPrefs[ns_];
+  auto it = ns.find(key);
+  if (it == ns.end() || it->second.size() > maxLen) return 0;
+  memcpy(buf, it->second.data(), it->second.size());
+  return it->second.size();
+}
+
+String Preferences::getString(const char* key, const String& d) {
+  if (!open_) return d;
+  PrefsNamespace& ns = gPrefs[ns_];
+  auto it = ns.find(key);
+  if (it == ns.end()) return d;
+  return String(std::string(it->second.begin(), it->second.end()));
+}
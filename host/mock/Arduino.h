@@ -0,0 +1,214 @@
+/*
+ * Arduino.h - Host Mock of the Arduino-ESP32 Core
+ *
+ * Just enough of the core for the control modules to compile unchanged on
+ * a PC. Time is simulated: micros()/millis()/esp_timer_get_time() read a
+ * virtual clock that only moves through delay(), esp_rom_delay_us() and
+ * hostAdvanceUs() (see host_sim.h), which also fires the hardware timer ISR.
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+using std::min;
+using std::max;
+
+// ==================== ATTRIBUTES / CONSTANTS ====================
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_NOINIT_ATTR
+#define PROGMEM
+#define PGM_P const char*
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+#define DEC 10
+#define HEX 16
+
+// XIAO ESP32-C6 pin map
+#define D0 0
+#define D1 1
+#define D2 2
+#define D3 21
+#define D4 22
+#define D5 23
+#define D6 16
+#define D7 17
+#define D8 19
+#define D9 20
+#define D10 18
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+// ==================== TIME / GPIO ====================
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+void pinMode(int pin, int mode);
+void digitalWrite(int pin, int level);
+int digitalRead(int pin);
+int digitalPinToInterrupt(int pin);
+void attachInterrupt(int irq, void (*isr)(), int mode);
+void detachInterrupt(int irq);
+void noInterrupts();
+void interrupts();
+
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+
+// ==================== STRING ====================
+class String {
+ public:
+  String() {}
+  String(const char* c) : s_(c ? c : "") {}
+  String(const std::string& c) : s_(c) {}
+  String(char c) : s_(1, c) {}
+  String(int v, unsigned char base = 10) { fmt_(base == 16 ? "%x" : "%d", v); }
+  String(unsigned v, unsigned char base = 10) { fmt_(base == 16 ? "%x" : "%u", v); }
+  String(long v, unsigned char base = 10) { fmt_(base == 16 ? "%lx" : "%ld", v); }
+  String(unsigned long v, unsigned char base = 10) { fmt_(base == 16 ? "%lx" : "%lu", v); }
+  String(float v, unsigned char decimals = 2) { fmt_("%.*f", (int)decimals, (double)v); }
+  String(double v, unsigned char decimals = 2) { fmt_("%.*f", (int)decimals, v); }
+
+  const char* c_str() const { return s_.c_str(); }
+  unsigned length() const { return (unsigned)s_.size(); }
+  bool isEmpty() const { return s_.empty(); }
+  long toInt() const { return atol(s_.c_str()); }
+  float toFloat() const { return (float)atof(s_.c_str()); }
+  bool operator==(const char* o) const { return s_ == o; }
+  bool operator==(const String& o) const { return s_ == o.s_; }
+  bool operator!=(const char* o) const { return s_ != o; }
+  String& operator+=(const String& o) { s_ += o.s_; return *this; }
+  String& operator+=(const char* o) { s_ += o; return *this; }
+  String& operator+=(char o) { s_ += o; return *this; }
+  friend String operator+(const String& a, const String& b) { return String(a.s_ + b.s_); }
+
+ private:
+  template <typename... A>
+  void fmt_(const char* f, A... a) {
+    char b[48];
+    snprintf(b, sizeof(b), f, a...);
+    s_ = b;
+  }
+  std::string s_;
+};
+
+// ==================== SERIAL ====================
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) { return write(&c, 1); }
+  virtual size_t write(const uint8_t* data, size_t len);
+  size_t write(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+  size_t print(const char* s) { return write(s); }
+  size_t print(const String& s) { return write(s.c_str()); }
+  size_t print(long v);
+  size_t println(const char* s = "");
+  size_t println(const String& s) { return println(s.c_str()); }
+  size_t println(long v);
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+  int availableForWrite() { return 128; }
+  void flush() {}
+};
+
+class HardwareSerial : public Print {
+ public:
+  void begin(unsigned long) {}
+  operator bool() const { return true; }
+  int available() { return 0; }
+  int read() { return -1; }
+};
+
+extern HardwareSerial Serial;
+
+// ==================== ESP ====================
+class EspClass {
+ public:
+  void restart();
+  uint32_t getFreeHeap() { return 200000; }
+  uint32_t getMinFreeHeap() { return 180000; }
+  uint32_t getMaxAllocHeap() { return 100000; }
+  uint32_t getCpuFreqMHz() { return 160; }
+  uint32_t getCycleCount();       // Simulated: 160 cycles per simulated us
+  uint32_t getSketchSize() { return 0; }
+};
+
+extern EspClass ESP;
+
+// CPU clock as set by setCpuFrequencyMhz() (starts at 160; no effect on the
+// simulated clock)
+bool setCpuFrequencyMhz(uint32_t mhz);
+uint32_t getCpuFrequencyMhz();
+
+// ==================== HARDWARE TIMER ====================
+struct hw_timer_s;
+typedef struct hw_timer_s hw_timer_t;
+
+hw_timer_t* timerBegin(uint32_t frequency);
+void timerEnd(hw_timer_t* timer);
+void timerAttachInterrupt(hw_timer_t* timer, void (*isr)(void));
+void timerDetachInterrupt(hw_timer_t* timer);
+void timerAlarm(hw_timer_t* timer, uint64_t alarmValue, bool autoreload, uint64_t reloadCount);
+void timerStart(hw_timer_t* timer);
+void timerStop(hw_timer_t* timer);
+
+// ==================== FREERTOS ====================
+// Single-threaded host: critical sections are no-ops
+typedef struct { int unused; } portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED {0}
+#define portENTER_CRITICAL(m) ((void)(m))
+#define portEXIT_CRITICAL(m) ((void)(m))
+#define portENTER_CRITICAL_ISR(m) ((void)(m))
+#define portEXIT_CRITICAL_ISR(m) ((void)(m))
+
+typedef uint32_t TickType_t;
+typedef void* TaskHandle_t;
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+#define pdMS_TO_TICKS(x) ((TickType_t)(x))
+#define pdPASS 1
+#define pdTRUE 1
+#define pdFALSE 0
+#define taskYIELD() ((void)0)
+
+// Tasks run to completion inside xTaskCreate()
+inline BaseType_t xTaskCreate(void (*fn)(void*), const char*, uint32_t, void* arg, UBaseType_t, TaskHandle_t* handle) {
+  if (handle) *handle = NULL;
+  fn(arg);
+  return pdPASS;
+}
+inline void vTaskDelete(TaskHandle_t) {}
+
+// One notification count for the one host task; a take that finds none
+// waits out its timeout on the virtual clock
+TaskHandle_t xTaskGetCurrentTaskHandle();
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* woken);
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks);
+#define portYIELD_FROM_ISR(x) ((void)(x))
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,47 @@
+/*
+ * Preferences.h - Host Mock of the ESP32 NVS Preferences API (in memory)
+ */
+
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+#include <Arduino.h>
+
+class Preferences {
+ public:
+  bool begin(const char* name, bool readOnly = false);
+  void end();
+  bool clear();
+  bool remove(const char* key);
+  bool isKey(const char* key);
+
+  size_t putBool(const char* key, bool v) { return putBytes(key, &v, sizeof(v)); }
+  size_t putUChar(const char* key, uint8_t v) { return putBytes(key, &v, sizeof(v)); }
+  size_t putUInt(const char* key, uint32_t v) { return putBytes(key, &v, sizeof(v)); }
+  size_t putULong(const char* key, uint32_t v) { return putBytes(key, &v, sizeof(v)); }
+  size_t putFloat(const char* key, float v) { return putBytes(key, &v, sizeof(v)); }
+  size_t putString(const char* key, const char* v) { return putBytes(key, v, strlen(v)); }
+  size_t putString(const char* key, const String& v) { return putString(key, v.c_str()); }
+  size_t putBytes(const char* key, const void* v, size_t len);
+
+  bool getBool(const char* key, bool d = false) { return get_(key, d); }
+  uint8_t getUChar(const char* key, uint8_t d = 0) { return get_(key, d); }
+  uint32_t getUInt(const char* key, uint32_t d = 0) { return get_(key, d); }
+  uint32_t getULong(const char* key, uint32_t d = 0) { return get_(key, d); }
+  float getFloat(const char* key, float d = 0.0f) { return get_(key, d); }
+  String getString(const char* key, const String& d = String());
+  size_t getBytesLength(const char* key);
+  size_t getBytes(const char* key, void* buf, size_t maxLen);
+
+ private:
+  template <typename T>
+  T get_(const char* key, T d) {
+    T v;
+    return (getBytesLength(key) == sizeof(T) && getBytes(key, &v, sizeof(T)) == sizeof(T)) ? v : d;
+  }
+  std::string ns_;
+  bool open_ = false;
+  bool readOnly_ = false;
+};
+
+#endif // HOST_PREFERENCES_H
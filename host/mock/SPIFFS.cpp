@@ -0,0 +1,76 @@
+/*
+ * SPIFFS.cpp - Host Mock File System (one flat map of paths to bytes)
+ */
+
+#include <SPIFFS.h>
+#include "host_sim.h"
+#include <map>
+#include <string>
+
+SPIFFSFS SPIFFS;
+
+static const size_t HOST_SPIFFS_BYTES = 0x30000;   // spiffs in partition/xiao_c6_ota_16m.csv
+static std::map<std::string, std::vector<uint8_t>> gFiles;
+
+size_t File::read(uint8_t* buf, size_t len) {
+  if (!data_ || pos_ >= data_->size()) return 0;
+  const size_t n = std::min(len, data_->size() - pos_);
+  memcpy(buf, data_->data() + pos_, n);
+  pos_ += n;
+  return n;
+}
+
+size_t File::write(const uint8_t* buf, size_t len) {
+  if (!data_) return 0;
+  if (pos_ + len > data_->size()) data_->resize(pos_ + len);
+  memcpy(data_->data() + pos_, buf, len);
+  pos_ += len;
+  return len;
+}
+
+size_t SPIFFSFS::totalBytes() { return HOST_SPIFFS_BYTES; }
+
+size_t SPIFFSFS::usedBytes() {
+  size_t used = 0;
+  for (const auto& f : gFiles) used += f.second.size();
+  return used;
+}
+
+File SPIFFSFS::open(const char* path, const char* mode) {
+  if (mode[0] == 'r') {
+    auto it = gFiles.find(path);
+    return (it == gFiles.end()) ? File() : File(&it->second, false);
+  }
+  std::vector<uint8_t>& data = gFiles[path];
+  if (mode[0] == 'w') data.clear();
+  return File(&data, true);
+}
+
+bool SPIFFSFS::exists(const char* path) { return gFiles.count(path) > 0; }
+bool SPIFFSFS::remove(const char* path) { return gFiles.erase(path) > 0; }
+
+bool SPIFFSFS::rename(const char* from, const char* to) {
+  auto it = gFiles.find(from);
+  if (it == gFiles.end()) return false;
+  std::vector<uint8_t> data = std::move(it->second);
+  gFiles.erase(it);
+  gFiles[to] = std::move(data);
+  return true;
+}
+
+bool SPIFFSFS::format() { gFiles.clear(); return true; }
+
+// ==================== HOST ACCESS ====================
+
+void hostSpiffsPut(const char* path, const void* data, size_t len) {
+  const uint8_t* p = (const uint8_t*)data;
+  gFiles[path] = std::vector<uint8_t>(p, p + len);
+}
+
+size_t hostSpiffsGet(const char* path, void* buf, size_t maxLen) {
+  auto it = gFiles.find(path);
+  if (it == gFiles.end()) return 0;
+  const size_t n = std::min(maxLen, it->second.size());
+  if (buf) memcpy(buf, it->second.data(), n);
+  return it->second.size();
+}
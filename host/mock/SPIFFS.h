@@ -0,0 +1,44 @@
+/*
+ * SPIFFS.h - Host Mock of the ESP32 SPIFFS File System (in memory)
+ */
+
+#ifndef HOST_SPIFFS_H
+#define HOST_SPIFFS_H
+
+#include <Arduino.h>
+#include <vector>
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+#define FILE_APPEND "a"
+
+class File {
+ public:
+  File() {}
+  File(std::vector<uint8_t>* data, bool append) : data_(data), pos_(append ? data->size() : 0) {}
+  operator bool() const { return data_ != NULL; }
+  size_t size() const { return data_ ? data_->size() : 0; }
+  size_t read(uint8_t* buf, size_t len);
+  size_t write(const uint8_t* buf, size_t len);
+  void close() { data_ = NULL; }
+
+ private:
+  std::vector<uint8_t>* data_ = NULL;
+  size_t pos_ = 0;
+};
+
+class SPIFFSFS {
+ public:
+  bool begin(bool formatOnFail = false) { (void)formatOnFail; return true; }
+  size_t totalBytes();
+  size_t usedBytes();
+  File open(const char* path, const char* mode = FILE_READ);
+  bool exists(const char* path);
+  bool remove(const char* path);
+  bool rename(const char* from, const char* to);
+  bool format();
+};
+
+extern SPIFFSFS SPIFFS;
+
+#endif // HOST_SPIFFS_H
@@ -0,0 +1,26 @@
+#ifndef HOST_WEBSERVER_H
+#define HOST_WEBSERVER_H
+#include <Arduino.h>
+#include <string>
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+
+// Just enough of WebServer for JsonStreamWriter: the response body is
+// collected in 'body' instead of going to a client
+class WebServer {
+ public:
+  void setContentLength(size_t len) { contentLength = len; }
+  void send(int c, const char* type, const String& content) {
+    code = c;
+    contentType = type;
+    body = content.c_str();
+  }
+  void sendContent(const String& content) { body += content.c_str(); }
+  void sendContent(const char* content, size_t len) { body.append(content, len); }
+
+  size_t contentLength = 0;
+  int code = 0;
+  std::string contentType;
+  std::string body;
+};
+#endif
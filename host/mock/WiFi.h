@@ -0,0 +1,16 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+#include <Arduino.h>
+typedef enum { WIFI_MODE_NULL = 0, WIFI_MODE_STA, WIFI_MODE_AP, WIFI_MODE_APSTA } wifi_mode_t;
+typedef enum { WIFI_PS_NONE = 0, WIFI_PS_MIN_MODEM, WIFI_PS_MAX_MODEM } wifi_ps_type_t;
+
+class WiFiClass {
+ public:
+  uint8_t* macAddress(uint8_t* mac);   // Fixed 02:00:00:12:34:56
+  wifi_mode_t getMode() { return WIFI_MODE_STA; }
+  bool setSleep(wifi_ps_type_t type) { sleep = type; return true; }
+  wifi_ps_type_t getSleep() { return sleep; }
+  wifi_ps_type_t sleep = WIFI_PS_MIN_MODEM;
+};
+extern WiFiClass WiFi;
+#endif
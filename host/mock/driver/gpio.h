@@ -0,0 +1,8 @@
+#ifndef HOST_DRIVER_GPIO_H
+#define HOST_DRIVER_GPIO_H
+#include <stdint.h>
+#include "esp_err.h"
+typedef int gpio_num_t;
+esp_err_t gpio_set_level(gpio_num_t pin, uint32_t level);
+int gpio_get_level(gpio_num_t pin);
+#endif
@@ -0,0 +1,5 @@
+#ifndef HOST_ESP_ROM_SYS_H
+#define HOST_ESP_ROM_SYS_H
+#include <stdint.h>
+void esp_rom_delay_us(uint32_t us);   // Advances the simulated clock
+#endif
@@ -0,0 +1,42 @@
+/*
+ * host_sim.h - Host Simulation Controls
+ *
+ * Drives the virtual clock and pins behind the Arduino mock.
+ */
+
+#ifndef HOST_SIM_H
+#define HOST_SIM_H
+
+#include <Arduino.h>
+
+// Virtual time in us. Advancing fires the step timer ISR at its alarm times.
+uint64_t hostTimeUs();
+void hostAdvanceUs(uint64_t us);
+
+// What esp_reset_reason() reports (esp_reset_reason_t, default ESP_RST_POWERON).
+// RTC_NOINIT data simply persists in the process, as across a warm reset.
+void hostSetResetReason(int reason);
+
+// Input level returned by digitalRead()/gpio_get_level() (default HIGH)
+void hostSetPin(int pin, int level);
+
+// Called for every digitalWrite()/gpio_set_level() (NULL to remove)
+typedef void (*HostPinHook)(int pin, int level, uint64_t timeUs);
+void hostSetPinHook(HostPinHook hook);
+
+// Called for every Control Point indication the host BLE backend sends (NULL to remove)
+typedef void (*HostIndicateHook)(const uint8_t* data, size_t len);
+void hostSetIndicateHook(HostIndicateHook hook);
+
+// Mirror Serial output to stdout (off by default)
+void hostSerialEcho(bool on);
+
+// Clear all stored Preferences namespaces
+void hostPrefsClear();
+
+// In-memory SPIFFS: store a file, or read one back (returns its full size;
+// copies at most maxLen bytes, buf may be NULL)
+void hostSpiffsPut(const char* path, const void* data, size_t len);
+size_t hostSpiffsGet(const char* path, void* buf, size_t maxLen);
+
+#endif // HOST_SIM_H
@@ -0,0 +1,47 @@
+/*
+ * miniz.cpp - Host Mock of the ROM tinfl and CRC-32 (on zlib)
+ */
+
+#include <rom/miniz.h>
+#include <esp_rom_crc.h>
+#include <zlib.h>
+#include <stdlib.h>
+
+// zlib keeps its own window, so the caller's wrapping buffer is only output
+tinfl_status tinfl_decompress(tinfl_decompressor* r, const uint8_t* pIn_buf_next, size_t* pIn_buf_size,
+                              uint8_t* pOut_buf_start, uint8_t* pOut_buf_next, size_t* pOut_buf_size,
+                              const uint32_t decomp_flags) {
+  (void)pOut_buf_start;
+  if (decomp_flags & (TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF)) {
+    return TINFL_STATUS_BAD_PARAM;   // Not simulated
+  }
+  if (r->m_state == 0) {
+    z_stream* z = (z_stream*)calloc(1, sizeof(z_stream));
+    if (inflateInit2(z, -15) != Z_OK) return TINFL_STATUS_FAILED;
+    r->m_zlib = z;
+    r->m_state = 1;
+  }
+  if (r->m_state != 1) return TINFL_STATUS_FAILED;
+
+  z_stream* z = (z_stream*)r->m_zlib;
+  z->next_in = (Bytef*)pIn_buf_next;
+  z->avail_in = (uInt)*pIn_buf_size;
+  z->next_out = pOut_buf_next;
+  z->avail_out = (uInt)*pOut_buf_size;
+  const int rc = inflate(z, Z_NO_FLUSH);
+  *pIn_buf_size -= z->avail_in;
+  *pOut_buf_size -= z->avail_out;
+
+  if (rc == Z_STREAM_END || (rc != Z_OK && rc != Z_BUF_ERROR)) {
+    inflateEnd(z);
+    free(z);
+    r->m_zlib = NULL;
+    r->m_state = 2;
+    return (rc == Z_STREAM_END) ? TINFL_STATUS_DONE : TINFL_STATUS_FAILED;
+  }
+  return (z->avail_out == 0) ? TINFL_STATUS_HAS_MORE_OUTPUT : TINFL_STATUS_NEEDS_MORE_INPUT;
+}
+
+uint32_t esp_rom_crc32_le(uint32_t crc, uint8_t const* buf, uint32_t len) {
+  return (uint32_t)crc32(crc, buf, len);
+}
@@ -0,0 +1,39 @@
+/*
+ * host_test.h - Minimal Checks for the Host Tests
+ *
+ * Each test is its own executable; main() returns hostTestResult().
+ */
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>
+#include <math.h>
+
+static int gHostTestChecks = 0;
+static int gHostTestFailures = 0;
+
+#define CHECK(cond) do { \
+    gHostTestChecks++; \
+    if (!(cond)) { \
+      gHostTestFailures++; \
+      fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+    } \
+  } while (0)
+
+#define CHECK_NEAR(a, b, tol) do { \
+    gHostTestChecks++; \
+    const double va_ = (a), vb_ = (b); \
+    if (fabs(va_ - vb_) > (tol)) { \
+      gHostTestFailures++; \
+      fprintf(stderr, "%s:%d: %s = %g, expected %g +/- %g\n", \
+              __FILE__, __LINE__, #a, va_, vb_, (double)(tol)); \
+    } \
+  } while (0)
+
+static inline int hostTestResult(const char* name) {
+  printf("%s: %d checks, %d failed\n", name, gHostTestChecks, gHostTestFailures);
+  return gHostTestFailures ? 1 : 0;
+}
+
+#endif // HOST_TEST_H
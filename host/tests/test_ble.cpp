@@ -0,0 +1,51 @@
+/*
+ * test_ble.cpp - Indoor Bike Data Notification Pacing
+ */
+
+#include "host_test.h"
+#include "host_sim.h"
+#include "ble_trainer.h"
+#include "ble_backend.h"
+#include <vector>
+
+// 20 Hz samples with the comms task sometimes a millisecond late: every
+// other sample still goes out, never a whole sample late
+static void testNotifyPacing() {
+  static const uint8_t PEER[6] = {1, 2, 3, 4, 5, 6};
+  bleOnConnect(PEER);
+
+  std::vector<uint32_t> sent;
+  uint64_t start = hostTimeUs();
+  for (uint32_t k = 0; k < 200; k++) {
+    const uint64_t t = start + (uint64_t)k * 50000 + ((k % 4 == 0) ? 1000 : 0);
+    hostAdvanceUs(t - hostTimeUs());
+    if (bleNotifyPower(100.0f + k, 15.0f)) sent.push_back(millis());
+  }
+
+  CHECK(sent.size() >= 99);
+  uint32_t maxGap = 0, minGap = UINT32_MAX;
+  for (size_t i = 1; i < sent.size(); i++) {
+    const uint32_t gap = sent[i] - sent[i - 1];
+    if (gap > maxGap) maxGap = gap;
+    if (gap < minGap) minGap = gap;
+  }
+  CHECK(maxGap <= 101);
+  CHECK(minGap >= BLE_NOTIFY_MIN_INTERVAL_MS - BLE_NOTIFY_SLACK_MS);
+
+  // Unchanged frames: only the heartbeat
+  uint32_t beats = 0;
+  for (uint32_t k = 0; k < 60; k++) {
+    hostAdvanceUs(50000);
+    if (bleNotifyPower(300.0f, 15.0f)) beats++;
+  }
+  CHECK(beats >= 3 && beats <= 4);   // First change, then one per BLE_NOTIFY_HEARTBEAT_MS
+
+  bleOnDisconnect();
+  hostAdvanceUs(200000);
+  CHECK(!bleNotifyPower(100.0f, 15.0f));
+}
+
+int main() {
+  testNotifyPacing();
+  return hostTestResult("test_ble");
+}
@@ -0,0 +1,183 @@
+/*
+ * test_calibration.cpp - NVS Persistence of Settings and Tables
+ */
+
+#include "host_test.h"
+#include "host_sim.h"
+#include "sensors.h"
+#include "calibration.h"
+#include <Preferences.h>
+
+static void testTablesRoundTrip() {
+  powerTableSet(2, 3, 300.0);
+  ergTableSet(4, 5, 99.0);
+  simTableSet(6, 1, 480.0);
+  powerTableSave();
+  ergTableSave();
+  simTableSave();
+  calibrationFlush();
+
+  // Scribble over RAM, then reload from NVS
+  gPowerTable[2][3] = 0;
+  gErgTable[4][5] = 0;
+  gSimTable[6][1] = 0;
+  calibrationInit();
+
+  CHECK(powerTableGet(2, 3) == 300.0);
+  CHECK(ergTableGet(4, 5) == 99.0);
+  CHECK(simTableGet(6, 1) == 480.0);
+  CHECK_NEAR(powerFromSpeedPos(powerSpeedAxis(2), powerPosAxis(3)), 300.0, 0.05);  // Engine rebuilt
+
+  // Reset writes the defaults back to NVS
+  powerTableReset();
+  const double def = powerTableGet(2, 3);
+  CHECK(def != 300.0);
+  calibrationFlush();
+  gPowerTable[2][3] = 1.0;
+  calibrationInit();
+  CHECK(powerTableGet(2, 3) == def);
+}
+
+static void testSettingsRoundTrip() {
+  gIdleCurveA = 12.5f;
+  gIdleCurveD = -0.25f;
+  calibrationSave();
+  gErgPiKp = 3.5f;
+  gErgLookaheadMs = 250.0f;
+  gErgFromPower = true;
+  ergPiSave();
+  gPowerInertiaEnabled = true;
+  gPowerInertia = 0.042f;
+  inertiaSave();
+  gFleetRateHz = 5;
+  fleetSettingsSave();
+  wifiSettingsSave("ssid-1", "secret");
+  deviceNameSave("Rollers");
+  calibrationFlush();
+
+  gIdleCurveA = gIdleCurveD = 0;
+  gErgPiKp = gErgLookaheadMs = 0;
+  gErgFromPower = false;
+  gPowerInertiaEnabled = false;
+  gPowerInertia = 0;
+  gFleetRateHz = 0;
+  calibrationInit();
+
+  CHECK(gIdleCurveA == 12.5f);
+  CHECK(gIdleCurveD == -0.25f);
+  CHECK(gErgPiKp == 3.5f);
+  CHECK(gErgLookaheadMs == 250.0f);
+  CHECK(gErgFromPower);
+  CHECK(gPowerInertiaEnabled);
+  CHECK(gPowerInertia == 0.042f);
+  CHECK(gFleetRateHz == 5);
+  CHECK(gWifiConfigured);
+  CHECK(strcmp(gWifiSsid, "ssid-1") == 0);
+  CHECK(strcmp(getEffectiveHostname(), "rollers") == 0);
+
+  wifiSettingsClear();
+  deviceNameClear();
+  calibrationFlush();
+  calibrationInit();
+  CHECK(!gWifiConfigured);
+  CHECK(!gDeviceNameSet);
+  CHECK(strcmp(getEffectiveHostname(), "insideride-3456") == 0);  // From the mock MAC
+}
+
+// Edits coalesce into one commit, written once the debounce has passed
+static void testDebouncedCommit() {
+  CalibrationStats st;
+  calibrationGetStats(&st);
+  const uint32_t commits = st.commits;
+
+  powerTableSet(1, 1, 70.0);
+  powerTableSave();
+  delay(500);
+  ergPiSave();
+  calibrationService();
+  calibrationGetStats(&st);
+  CHECK(st.pending);
+  CHECK(st.commits == commits);
+
+  delay(CAL_COMMIT_DEBOUNCE_MS - 100);   // Counted from the last edit
+  calibrationService();
+  calibrationGetStats(&st);
+  CHECK(st.pending);
+
+  delay(200);
+  calibrationService();
+  calibrationGetStats(&st);
+  CHECK(!st.pending);
+  CHECK(st.commits == commits + 1);
+  CHECK(st.blobBytes < 2 * sizeof(gPowerTable) + sizeof(gErgTable) + sizeof(gSimTable));  // Float tables
+}
+
+// A damaged blob is ignored rather than loaded
+static void testCorruptBlob() {
+  gErgPiKp = 7.0f;
+  ergPiSave();
+  calibrationFlush();
+
+  Preferences p;
+  p.begin("calibration", false);
+  uint8_t buf[2048];
+  const size_t len = p.getBytes("cal", buf, sizeof(buf));
+  CHECK(len > 100);
+  buf[40] ^= 0x01;
+  p.putBytes("cal", buf, len);
+  p.end();
+
+  calibrationInit();
+  CHECK(gErgPiKp == ERG_PI_DEFAULT_KP);
+}
+
+// Settings of older firmware (one key each) are moved into the blob
+static void testLegacyMigration() {
+  hostPrefsClear();
+  Preferences p;
+  p.begin("calibration", false);
+  p.putFloat("idleB", 21.5f);
+  p.putFloat("ergKi", 0.75f);
+  p.putString("wifiSsid", "old-net");
+  p.putString("wifiPass", "pw");
+  double tbl[POWER_TABLE_ROWS][POWER_TABLE_COLS];
+  memcpy(tbl, gPowerTable, sizeof(tbl));
+  tbl[3][2] = 401.0;
+  p.putBytes("powerTbl", tbl, sizeof(tbl));
+  p.end();
+
+  calibrationInit();
+  CHECK(gIdleCurveB == 21.5f);
+  CHECK(gErgPiKi == 0.75f);
+  CHECK(strcmp(gWifiSsid, "old-net") == 0);
+  CHECK(powerTableGet(3, 2) == 401.0);
+
+  CalibrationStats st;
+  calibrationGetStats(&st);
+  CHECK(st.pending);
+  calibrationService();   // Rollers stopped: first slot
+  calibrationGetStats(&st);
+  CHECK(!st.pending);
+
+  p.begin("calibration", true);
+  CHECK(!p.isKey("idleB"));
+  CHECK(!p.isKey("powerTbl"));
+  CHECK(p.isKey("cal"));
+  p.end();
+
+  gIdleCurveB = 0;
+  calibrationInit();
+  CHECK(gIdleCurveB == 21.5f);
+  CHECK(powerTableGet(3, 2) == 401.0);
+}
+
+int main() {
+  hostPrefsClear();
+  calibrationInit();
+  testTablesRoundTrip();
+  testSettingsRoundTrip();
+  testDebouncedCommit();
+  testCorruptBlob();
+  testLegacyMigration();
+  return hostTestResult("test_calibration");
+}
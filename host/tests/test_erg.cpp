@@ -0,0 +1,59 @@
+/*
+ * test_erg.cpp - ERG Controller (speed lookahead, feed-forward)
+ */
+
+#include "host_test.h"
+#include "sensors.h"
+#include "calibration.h"
+#include "erg_control.h"
+
+static void testLookaheadOff() {
+  gErgLookaheadMs = 0.0f;
+  CHECK(ergProjectSpeed(15.0f, 0.0f) == 15.0f);
+  CHECK(ergProjectSpeed(15.0f, 8.0f) == 15.0f);
+  CHECK(ergProjectSpeed(15.0f, -8.0f) == 15.0f);
+  CHECK(ergProjectSpeed(0.0f, 5.0f) == 0.0f);
+}
+
+static void testProjection() {
+  gErgLookaheadMs = 200.0f;
+  CHECK_NEAR(ergProjectSpeed(15.0f, 0.0f), 15.0, 1e-6);
+  CHECK_NEAR(ergProjectSpeed(15.0f, 5.0f), 16.0, 1e-5);    // Speeding up: projected higher
+  CHECK_NEAR(ergProjectSpeed(15.0f, -5.0f), 14.0, 1e-5);   // Slowing down: lower
+  CHECK_NEAR(ergProjectSpeed(15.0f, 2.5f), 15.5, 1e-5);
+
+  // Change clamped to +/-ERG_LOOKAHEAD_MAX_DELTA_MPH
+  CHECK_NEAR(ergProjectSpeed(15.0f, 50.0f), 15.0 + ERG_LOOKAHEAD_MAX_DELTA_MPH, 1e-5);
+  CHECK_NEAR(ergProjectSpeed(15.0f, -50.0f), 15.0 - ERG_LOOKAHEAD_MAX_DELTA_MPH, 1e-5);
+  gErgLookaheadMs = ERG_LOOKAHEAD_MAX_MS;
+  CHECK_NEAR(ergProjectSpeed(20.0f, 100.0f), 20.0 + ERG_LOOKAHEAD_MAX_DELTA_MPH, 1e-5);
+
+  // Never below standstill
+  gErgLookaheadMs = 200.0f;
+  CHECK(ergProjectSpeed(1.0f, -10.0f) == 0.0f);
+}
+
+// The feed-forward is the ERG table at the projected speed
+static void testFeedForward() {
+  gErgPiEnabled = false;
+  gErgLookaheadMs = 200.0f;
+  const int32_t pos = ergControlUpdate(15.0f, 5.0f, 200.0f, 200.0f, 0.05f);
+  CHECK_NEAR(gErgProjectedMph, 16.0, 1e-5);
+  CHECK_NEAR(gErgFeedForward, stepFromPowerSpeed(16.0f, 200.0f), 1e-3);
+  CHECK(pos == (int32_t)lroundf(stepFromPowerSpeed(16.0f, 200.0f)));
+
+  gErgLookaheadMs = 0.0f;
+  ergControlUpdate(15.0f, 5.0f, 200.0f, 200.0f, 0.05f);
+  CHECK(gErgProjectedMph == 15.0f);
+  CHECK_NEAR(gErgFeedForward, stepFromPowerSpeed(15.0f, 200.0f), 1e-3);
+  gErgPiEnabled = true;
+}
+
+int main() {
+  calibrationInit();
+  sensorsInit();
+  testLookaheadOff();
+  testProjection();
+  testFeedForward();
+  return hostTestResult("test_erg");
+}
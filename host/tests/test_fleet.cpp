@@ -0,0 +1,109 @@
+/*
+ * test_fleet.cpp - Fleet Datagram Layout
+ */
+
+#include "host_test.h"
+#include "host_sim.h"
+#include "calibration.h"
+#include "fleet.h"
+
+static TelemetryFrame makeFrame() {
+  TelemetryFrame f;
+  for (int i = 0; i < TF_COUNT; i++) f.v[i] = 1000 * i + 7;
+  return f;
+}
+
+static uint32_t readLe32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Header fields, byte order, and the telemetry frame after the name
+static void testHeader() {
+  strcpy(gDeviceId, "A1B2");
+  strcpy(gDeviceName, "Trainer1");
+  gDeviceNameSet = true;
+  hostAdvanceUs(0x01020304ULL * 1000 - (uint64_t)millis() * 1000);
+  const uint32_t ms = millis();
+  CHECK(ms == 0x01020304);
+
+  const TelemetryFrame f = makeFrame();
+  uint8_t out[FLEET_DATAGRAM_MAX];
+  const size_t n = fleetEncode(f, 0xBEEF, out, sizeof(out));
+  CHECK(n > FLEET_HEADER + 8);
+
+  CHECK(out[0] == 'I' && out[1] == 'R');
+  CHECK(out[2] == FLEET_VERSION);
+  CHECK(out[3] == 8);
+  CHECK(out[4] == 0xEF && out[5] == 0xBE);
+  CHECK(out[6] == 0x04 && out[7] == 0x03 && out[8] == 0x02 && out[9] == 0x01);
+  CHECK(memcmp(out + 10, "A1B2", 4) == 0);
+  CHECK(memcmp(out + FLEET_HEADER, "Trainer1", 8) == 0);
+
+  // A full frame (prev == NULL), with the low byte of the sequence number
+  const uint8_t* bin = out + FLEET_HEADER + 8;
+  CHECK(bin[0] == TELEMETRY_BIN_MAGIC);
+  CHECK(bin[1] == 0xEF);
+  CHECK(readLe32(bin + 2) == (TF_COUNT == 32 ? 0xFFFFFFFFu : (1u << TF_COUNT) - 1));
+
+  uint8_t ref[TELEMETRY_BIN_MAX];
+  const size_t refLen = telemetryEncodeBinary(f, NULL, 0xEF, ref, sizeof(ref));
+  CHECK(refLen > 6);
+  CHECK(n == FLEET_HEADER + 8 + refLen);
+  CHECK(memcmp(bin, ref, refLen) == 0);
+}
+
+// Names over FLEET_NAME_MAX are cut, not terminated; the default is the hostname
+static void testName() {
+  const TelemetryFrame f = makeFrame();
+  uint8_t out[FLEET_DATAGRAM_MAX];
+
+  memset(gDeviceName, 0, sizeof(gDeviceName));
+  memset(gDeviceName, 'x', sizeof(gDeviceName) - 1);   // 31 characters
+  gDeviceNameSet = true;
+  size_t n = fleetEncode(f, 1, out, sizeof(out));
+  CHECK(out[3] == FLEET_NAME_MAX);
+  CHECK(out[FLEET_HEADER + FLEET_NAME_MAX - 1] == 'x');
+  CHECK(out[FLEET_HEADER + FLEET_NAME_MAX] == TELEMETRY_BIN_MAGIC);
+  CHECK(n <= FLEET_DATAGRAM_MAX);
+
+  // Longer than the field allows (the name buffer itself cannot hold one)
+  char longName[] = "0123456789abcdef0123456789abcdefXYZ";
+  CHECK(strlen(longName) > FLEET_NAME_MAX);
+  memcpy(gDeviceName, longName, sizeof(gDeviceName) - 1);
+  n = fleetEncode(f, 1, out, sizeof(out));
+  CHECK(out[3] == FLEET_NAME_MAX);
+  CHECK(memcmp(out + FLEET_HEADER, longName, FLEET_NAME_MAX) == 0);
+  CHECK(out[FLEET_HEADER + FLEET_NAME_MAX] == TELEMETRY_BIN_MAGIC);
+
+  gDeviceNameSet = false;
+  const char* host = getEffectiveHostname();
+  n = fleetEncode(f, 1, out, sizeof(out));
+  CHECK(out[3] == strlen(host));
+  CHECK(memcmp(out + FLEET_HEADER, host, strlen(host)) == 0);
+  CHECK(out[FLEET_HEADER + strlen(host)] == TELEMETRY_BIN_MAGIC);
+}
+
+// An unset ID digit goes out as '0'; a short buffer writes nothing
+static void testEdges() {
+  const TelemetryFrame f = makeFrame();
+  uint8_t out[FLEET_DATAGRAM_MAX];
+
+  strcpy(gDeviceName, "T");
+  gDeviceNameSet = true;
+  memset(gDeviceId, 0, sizeof(gDeviceId));
+  strcpy(gDeviceId, "AB");
+  fleetEncode(f, 0, out, sizeof(out));
+  CHECK(memcmp(out + 10, "AB00", 4) == 0);
+
+  CHECK(fleetEncode(f, 0, out, FLEET_HEADER + 1 + TELEMETRY_BIN_MAX) > 0);
+  CHECK(fleetEncode(f, 0, out, FLEET_HEADER + 1 + TELEMETRY_BIN_MAX - 1) == 0);
+  CHECK(fleetEncode(f, 0, out, FLEET_HEADER) == 0);
+}
+
+int main() {
+  calibrationInit();
+  testHeader();
+  testName();
+  testEdges();
+  return hostTestResult("test_fleet");
+}
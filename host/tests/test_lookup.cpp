@@ -0,0 +1,124 @@
+/*
+ * test_lookup.cpp - Calibration Table Lookups (power, ERG, SIM)
+ */
+
+#include "host_test.h"
+#include "sensors.h"
+#include "calibration.h"
+
+// Fixed-point engine: grid points come back within a fraction of a unit
+static const double GRID_TOL = 0.05;
+
+static void testGridPoints() {
+  for (int i = 0; i < POWER_TABLE_ROWS; i++)
+    for (int j = 0; j < POWER_TABLE_COLS; j++)
+      CHECK_NEAR(powerFromSpeedPos(gPowerSpeedAxis[i], gPowerPosAxis[j]), gPowerTable[i][j], GRID_TOL);
+
+  for (int i = 0; i < ERG_TABLE_ROWS; i++)
+    for (int j = 0; j < ERG_TABLE_COLS; j++)
+      CHECK_NEAR(stepFromPowerSpeed(gErgSpeedAxis[i], gErgPowerAxis[j]), gErgTable[i][j], GRID_TOL);
+
+  for (int i = 0; i < SIM_TABLE_ROWS; i++)
+    for (int j = 0; j < SIM_TABLE_COLS; j++)
+      CHECK_NEAR(gradeToSteps(gSimSpeedAxis[i], gSimGradeAxis[j]), gSimTable[i][j], GRID_TOL);
+}
+
+static void testBilinear() {
+  // Cell centre is the mean of its four corners
+  const double mid = (gPowerTable[2][1] + gPowerTable[2][2] + gPowerTable[3][1] + gPowerTable[3][2]) / 4.0;
+  CHECK_NEAR(powerFromSpeedPos(12.5f, 375.0f), mid, 0.1);
+
+  // Linear along an edge
+  const double edge = gPowerTable[4][0] + 0.3 * (gPowerTable[5][0] - gPowerTable[4][0]);
+  CHECK_NEAR(powerFromSpeedPos(21.5f, 0.0f), edge, 0.1);
+
+  // Power rises with position at every speed above 0
+  for (float mph = 1.0f; mph <= 50.0f; mph += 0.7f) {
+    float prev = -1.0f;
+    for (float pos = 0.0f; pos <= 1000.0f; pos += 25.0f) {
+      const float w = powerFromSpeedPos(mph, pos);
+      CHECK(w >= prev);
+      prev = w;
+    }
+  }
+}
+
+static void testOutOfRange() {
+  CHECK(powerFromSpeedPos(-1.0f, 500.0f) == 0.0f);
+  CHECK(powerFromSpeedPos(51.0f, 500.0f) == 0.0f);
+  CHECK(powerFromSpeedPos(20.0f, 1001.0f) == 0.0f);
+  CHECK(stepFromPowerSpeed(60.0f, 200.0f) == 0.0f);
+  CHECK(stepFromPowerSpeed(20.0f, 1500.0f) == 0.0f);
+  CHECK(gradeToSteps(60.0f, 2.0f) == 500.0f);
+
+  // SIM grade clamps to the table edge instead of failing
+  CHECK_NEAR(gradeToSteps(10.0f, 20.0f), gSimTable[2][SIM_TABLE_COLS - 1], GRID_TOL);
+  CHECK_NEAR(gradeToSteps(10.0f, -20.0f), gSimTable[2][0], GRID_TOL);
+}
+
+static void testPointUpdate() {
+  const double old = powerTableGet(3, 2);
+  powerTableSet(3, 2, 450.0);
+  CHECK_NEAR(powerFromSpeedPos(15.0f, 500.0f), 450.0, GRID_TOL);
+  powerTableSet(3, 2, old);
+  CHECK_NEAR(powerFromSpeedPos(15.0f, 500.0f), old, GRID_TOL);
+}
+
+// ERG from the power table: the position it picks gives back the target power.
+// Skips one grid step at either end of the row's power range, where the
+// dense grid blends in the clamped neighbour.
+static float ergInverseWorstError(float* worstMph, float* worstW) {
+  float worst = 0.0f;
+  for (float mph = 3.0f; mph <= 45.0f; mph += 0.35f) {
+    const float lo = max(powerFromSpeedPos(mph, 0.0f), powerFromSpeedPos(mph + 1.0f, 0.0f)) + ERG_INV_WATT_STEP;
+    const float hi = min(powerFromSpeedPos(mph - 1.0f, 1000.0f), 2000.0f);
+    for (float w = lo; w < hi; w += 7.0f) {
+      const float err = fabsf(powerFromSpeedPos(mph, stepFromPowerSpeed(mph, w)) - w);
+      if (err > worst) {
+        worst = err;
+        *worstMph = mph;
+        *worstW = w;
+      }
+    }
+  }
+  return worst;
+}
+
+static void testErgFromPower() {
+  gErgFromPower = true;
+  float mph = 0, w = 0;
+  const float worst = ergInverseWorstError(&mph, &w);
+  printf("ERG inverse: worst |power(pos) - target| %.1f W at %.1f mph, %.0f W\n", worst, mph, w);
+  CHECK(worst < 10.0f);
+
+  // Power table grid points: kinks fall between 16 W columns, so compare power
+  for (int j = 1; j < POWER_TABLE_COLS; j++)
+    CHECK_NEAR(powerFromSpeedPos(15.0f, stepFromPowerSpeed(15.0f, gPowerTable[3][j])), gPowerTable[3][j], 4.0);
+
+  // Outside the row's power range: minimum / position of maximum power
+  CHECK_NEAR(stepFromPowerSpeed(15.0f, 50.0f), 0.0, GRID_TOL);
+  CHECK_NEAR(stepFromPowerSpeed(15.0f, 900.0f), 1000.0, GRID_TOL);
+  CHECK(stepFromPowerSpeed(60.0f, 200.0f) == 0.0f);
+
+  // A power cell edit moves the inverse right away, and a non-monotone
+  // row still inverts to the lowest position that reaches the power
+  const double old = powerTableGet(3, 3);
+  powerTableSet(3, 3, 300.0);   // Below the 500 position's 383 W
+  CHECK_NEAR(stepFromPowerSpeed(15.0f, 300.0f), 250.0 + 250.0 * (300.0 - 246.0) / (383.0 - 246.0), 1.0);
+  CHECK_NEAR(stepFromPowerSpeed(15.0f, 490.0f), 750.0 + 250.0 * (490.0 - 383.0) / (597.0 - 383.0), 1.0);
+  powerTableSet(3, 3, old);
+  CHECK_NEAR(stepFromPowerSpeed(15.0f, gPowerTable[3][3]), 750.0, 1.0);
+  CHECK(ergInverseWorstError(&mph, &w) == worst);   // Same as the full build
+
+  gErgFromPower = false;
+}
+
+int main() {
+  sensorsInit();
+  testGridPoints();
+  testBilinear();
+  testOutOfRange();
+  testPointUpdate();
+  testErgFromPower();
+  return hostTestResult("test_lookup");
+}
@@ -0,0 +1,155 @@
+/*
+ * test_ota.cpp - OTA Image Stream (plain and gzip uploads)
+ */
+
+#include "host_test.h"
+#include "host_sim.h"
+#include "ota_stream.h"
+#include <zlib.h>
+#include <vector>
+
+typedef std::vector<uint8_t> Bytes;
+
+static Bytes gFlash;
+static size_t gFlashLimit = SIZE_MAX;   // Simulated write failure past this size
+
+static bool flashWrite(const uint8_t* data, size_t len, void*) {
+  if (gFlash.size() + len > gFlashLimit) return false;
+  gFlash.insert(gFlash.end(), data, data + len);
+  return true;
+}
+
+// Firmware-like image: code-ish runs, tables and a random tail
+static Bytes makeImage(size_t len) {
+  Bytes img(len);
+  uint32_t x = 12345;
+  for (size_t i = 0; i < len; i++) {
+    x = x * 1103515245u + 12345u;
+    img[i] = (i % 4096 < 3000) ? (uint8_t)((i * 7) ^ (i >> 5)) : (uint8_t)(x >> 24);
+  }
+  img[0] = 0xE9;   // ESP image magic
+  return img;
+}
+
+static Bytes gzipOf(const Bytes& in, const char* name) {
+  z_stream z = {};
+  deflateInit2(&z, 9, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+  gz_header h = {};
+  h.name = (Bytef*)name;
+  h.extra = (Bytef*)"xx";
+  h.extra_len = name ? 2 : 0;
+  h.hcrc = name ? 1 : 0;
+  if (name) deflateSetHeader(&z, &h);
+
+  Bytes out(deflateBound(&z, in.size()) + 64);
+  z.next_in = (Bytef*)in.data();
+  z.avail_in = in.size();
+  z.next_out = out.data();
+  z.avail_out = out.size();
+  deflate(&z, Z_FINISH);
+  out.resize(z.total_out);
+  deflateEnd(&z);
+  return out;
+}
+
+// Upload in HTTP-sized chunks (varying, as the WebServer hands them over)
+static bool upload(const Bytes& file, size_t chunk) {
+  gFlash.clear();
+  otaStreamBegin(flashWrite, NULL);
+  size_t off = 0;
+  for (int i = 0; off < file.size(); i++) {
+    const size_t n = std::min(file.size() - off, chunk + (i % 3) * 17);
+    delay(1);
+    if (!otaStreamFeed(file.data() + off, n)) {
+      otaStreamAbort();
+      return false;
+    }
+    off += n;
+  }
+  return otaStreamEnd();
+}
+
+static void testPlain() {
+  const Bytes img = makeImage(300000);
+  CHECK(upload(img, 1436));
+  CHECK(gFlash == img);
+
+  OtaStreamStats st;
+  otaStreamGetStats(&st);
+  CHECK(!st.gzip && !st.active);
+  CHECK(st.inBytes == img.size() && st.outBytes == img.size());
+  CHECK(otaStreamError() == NULL);
+}
+
+static void testGzip() {
+  const Bytes img = makeImage(700001);
+  const Bytes gz = gzipOf(img, NULL);
+  CHECK(gz.size() < img.size() * 3 / 4);
+
+  const size_t chunks[] = {1, 7, 1436, 40000};
+  for (size_t c : chunks) {
+    CHECK(upload(gz, c));
+    CHECK(gFlash == img);
+  }
+
+  OtaStreamStats st;
+  otaStreamGetStats(&st);
+  CHECK(st.gzip);
+  CHECK(st.inBytes == gz.size() && st.outBytes == img.size());
+  CHECK(st.lastMs > st.startMs);
+
+  // Optional header fields (name, extra, header CRC) are skipped
+  const Bytes named = gzipOf(img, "firmware.bin");
+  CHECK(named.size() > gz.size());
+  CHECK(upload(named, 1436));
+  CHECK(gFlash == img);
+}
+
+static void testBadImages() {
+  const Bytes img = makeImage(100000);
+  const Bytes gz = gzipOf(img, NULL);
+
+  // Trailer CRC and length are checked
+  Bytes badCrc = gz;
+  badCrc[gz.size() - 6] ^= 0x01;
+  CHECK(!upload(badCrc, 1436));
+  CHECK(otaStreamError() != NULL);
+
+  Bytes badLen = gz;
+  badLen[gz.size() - 2] ^= 0x01;
+  CHECK(!upload(badLen, 1436));
+
+  // Truncated upload
+  const Bytes cut(gz.begin(), gz.begin() + gz.size() / 2);
+  CHECK(!upload(cut, 1436));
+
+  // Corrupt deflate data
+  Bytes corrupt = gz;
+  for (size_t i = 20; i < 60; i++) corrupt[i] = 0xFF;
+  CHECK(!upload(corrupt, 1436));
+
+  // Not gzip after all, and not deflate
+  Bytes notGzip = gz;
+  notGzip[1] = 0x00;
+  CHECK(!upload(notGzip, 1436));
+
+  // Flash write failure stops the stream
+  gFlashLimit = 50000;
+  CHECK(!upload(gz, 1436));
+  CHECK(gFlash.size() <= 50000);
+  gFlashLimit = SIZE_MAX;
+
+  // Empty upload
+  CHECK(!upload(Bytes(), 1436));
+
+  // A good one still works after all that
+  CHECK(upload(gz, 1436));
+  CHECK(gFlash == img);
+}
+
+int main() {
+  testPlain();
+  testGzip();
+  testBadImages();
+  return hostTestResult("test_ota");
+}
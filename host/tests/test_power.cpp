@@ -0,0 +1,147 @@
+/*
+ * test_power.cpp - Idle Power Management (entry, wake sources, model)
+ */
+
+#include "host_test.h"
+#include "host_sim.h"
+#include "power.h"
+#include "sensors.h"
+#include "stepper_control.h"
+#include "ble_trainer.h"
+#include "ble_backend.h"
+#include <WiFi.h>
+
+// loop() as far as power management sees it; returns the simulated time
+static uint32_t runLoopMs(uint32_t ms) {
+  const uint64_t start = hostTimeUs();
+  while (hostTimeUs() - start < (uint64_t)ms * 1000) {
+    powerService();
+    powerLoopWait();
+  }
+  return (uint32_t)((hostTimeUs() - start) / 1000);
+}
+
+static void runUntilIdle() {
+  for (uint32_t i = 0; i < POWER_IDLE_AFTER_MS + 100 && !gPowerIdle; i++) runLoopMs(1);
+}
+
+static void testIdleEntry() {
+  powerInit();
+  CHECK(!gPowerIdle);
+
+  runLoopMs(POWER_IDLE_AFTER_MS - 100);
+  CHECK(!gPowerIdle);
+  CHECK(getCpuFrequencyMhz() == 160);
+
+  runUntilIdle();
+  CHECK(gPowerIdle);
+  CHECK(getCpuFrequencyMhz() == POWER_IDLE_CPU_MHZ);
+  CHECK(WiFi.getSleep() == WIFI_PS_MAX_MODEM);
+
+  // Idle passes sleep POWER_IDLE_LOOP_MS, not 1 ms
+  const uint64_t t0 = hostTimeUs();
+  powerService();
+  powerLoopWait();
+  CHECK(hostTimeUs() - t0 == (uint64_t)POWER_IDLE_LOOP_MS * 1000);
+
+  PowerStats st;
+  powerGetStats(&st);
+  CHECK(st.state == POWER_IDLE);
+  CHECK(st.idleEntries == 1);
+  CHECK(st.estMa == POWER_EST_IDLE_STA_MA);
+}
+
+// A Hall edge ends the idle wait at once and restores the clock
+static void testHallWake() {
+  CHECK(gPowerIdle);
+  hostAdvanceUs(5000);
+  hallISR();
+  const uint64_t t0 = hostTimeUs();
+  powerLoopWait();                      // Notification already pending: no wait
+  CHECK(hostTimeUs() == t0);
+  powerService();
+  CHECK(!gPowerIdle);
+  CHECK(getCpuFrequencyMhz() == 160);
+  CHECK(WiFi.getSleep() == WIFI_PS_MIN_MODEM);
+
+  PowerStats st;
+  powerGetStats(&st);
+  CHECK(st.lastWake == POWER_WAKE_HALL);
+  CHECK(st.lastWakeUs < 1000);
+
+  // Edges keep it awake; after they stop, the full timeout runs again
+  for (int i = 0; i < 20; i++) {
+    runLoopMs(200);
+    hallISR();
+  }
+  CHECK(!gPowerIdle);
+  runLoopMs(POWER_IDLE_AFTER_MS - 100);
+  CHECK(!gPowerIdle);
+  runUntilIdle();
+  CHECK(gPowerIdle);
+}
+
+static void testOtherWakeSources() {
+  // BLE connection: woken straight away, and held awake while connected
+  CHECK(gPowerIdle);
+  static const uint8_t PEER[6] = {1, 2, 3, 4, 5, 6};
+  bleOnConnect(PEER);
+  powerService();
+  CHECK(!gPowerIdle);
+  PowerStats st;
+  powerGetStats(&st);
+  CHECK(st.lastWake == POWER_WAKE_BLE);
+  runLoopMs(2 * POWER_IDLE_AFTER_MS);
+  CHECK(!gPowerIdle);
+  bleOnDisconnect();
+  runUntilIdle();
+  CHECK(gPowerIdle);
+
+  // Web activity (any task)
+  powerActivity(POWER_WAKE_WEB);
+  powerLoopWait();
+  powerService();
+  CHECK(!gPowerIdle);
+  powerGetStats(&st);
+  CHECK(st.lastWake == POWER_WAKE_WEB);
+  runUntilIdle();
+
+  // An enabled motor wakes it and blocks idle
+  gStepEn = true;
+  runLoopMs(POWER_IDLE_LOOP_MS);
+  CHECK(!gPowerIdle);
+  powerGetStats(&st);
+  CHECK(st.lastWake == POWER_WAKE_MOTOR);
+  runLoopMs(2 * POWER_IDLE_AFTER_MS);
+  CHECK(!gPowerIdle);
+  gStepEn = false;
+  runUntilIdle();
+  CHECK(gPowerIdle);
+}
+
+static void testCurrentModel() {
+  PowerStats st;
+  powerGetStats(&st);
+  CHECK(st.idleEntries == 5);
+  CHECK(st.idleMs > 0 && st.activeMs > 0);
+  CHECK(st.estAvgMa > POWER_EST_IDLE_STA_MA && st.estAvgMa < POWER_EST_ACTIVE_MA);
+  const float expect = (st.activeMs * POWER_EST_ACTIVE_MA + st.idleMs * POWER_EST_IDLE_STA_MA) /
+                       (float)(st.activeMs + st.idleMs);
+  CHECK_NEAR(st.estAvgMa, expect, 0.01);
+
+  // Idle time only grows while idle
+  runLoopMs(10000);
+  PowerStats later;
+  powerGetStats(&later);
+  CHECK(later.idleMs >= st.idleMs + 9990);
+  CHECK(later.activeMs == st.activeMs);
+  CHECK(later.estAvgMa < st.estAvgMa);
+}
+
+int main() {
+  testIdleEntry();
+  testHallWake();
+  testOtherWakeSources();
+  testCurrentModel();
+  return hostTestResult("test_power");
+}
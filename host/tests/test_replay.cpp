@@ -0,0 +1,263 @@
+/*
+ * test_replay.cpp - Record a Simulated Ride, Then Replay It
+ */
+
+#include "host_test.h"
+#include "host_sim.h"
+#include "../tools/replay_clock.h"
+#include "calibration.h"
+#include "sensors.h"
+#include "stepper_control.h"
+#include "control.h"
+#include "ble_trainer.h"
+#include "ble_backend.h"
+#include "trainer_state.h"
+#include "recorder.h"
+#include "replay.h"
+#include <vector>
+
+// ==================== SIMULATED RIDE ====================
+// Runs the control task's schedule: 5 ms stepper housekeeping, 20 Hz
+// sensors, target and recorder sample; edges come from a speed profile.
+static float rideMph(float tS) {
+  if (tS < 5.0f) return 4.0f * tS;           // Spin up to 20 mph
+  if (tS < 20.0f) return 20.0f + 0.3f * sinf(tS * 2.0f);
+  if (tS < 24.0f) return 20.0f - 5.0f * (tS - 20.0f);
+  return 0.0f;
+}
+
+static void ftmsWrite(std::initializer_list<uint8_t> bytes) {
+  std::vector<uint8_t> v(bytes);
+  bleOnControlPointWrite(v.data(), v.size());
+}
+
+static void recordRide() {
+  const uint64_t start = hostTimeUs();
+  uint64_t nextEdgeUs = start;
+  uint32_t tick = 0;
+  bool sentErg = false, sentSim = false, sentStop = false;
+
+  for (;;) {
+    const uint64_t tickUs = start + (uint64_t)tick * CONTROL_PERIOD_MS * 1000;
+    const float tS = (tickUs - start) * 1e-6f;
+    if (tS > 32.0f) break;
+
+    // Hall edges up to this tick
+    while (nextEdgeUs <= tickUs) {
+      hostAdvanceUs(nextEdgeUs - hostTimeUs());
+      const float mph = rideMph((nextEdgeUs - start) * 1e-6f);
+      if (mph > 0.5f) {
+        hallISR();
+        nextEdgeUs += (uint64_t)(60e6f / (mphToRpm(mph) * HALL_PULSES_PER_REV));
+      } else {
+        nextEdgeUs += 1000;
+      }
+    }
+    hostAdvanceUs(tickUs - hostTimeUs());
+
+    // Central: ERG 200 W, then 3 % grade, then stop
+    if (!sentErg && tS >= 3.0f) { ftmsWrite({FTMS_OP_SET_TARGET_POWER, 200, 0}); sentErg = true; }
+    if (!sentSim && tS >= 12.0f) { ftmsWrite({FTMS_OP_SET_SIMULATION, 0, 0, 44, 1, 0, 0}); sentSim = true; }
+    if (!sentStop && tS >= 22.0f) { ftmsWrite({FTMS_OP_STOP_PAUSE, 1}); sentStop = true; }
+
+    stepperUpdate();
+    stepperUpdateSpeedBasedEnable(currentSpeedMph);
+    if (tick % 10 == 0) {
+      sensorsUpdate();
+      stepperSetTarget(controlTargetUpdate(0.05f));
+      trainerStatePublish();
+      TrainerSnapshot snap;
+      trainerStateRead(&snap);
+      recorderSample(snap, hallLastIntervalUs());
+
+      // Flash writes only between moves (they would stall the step timer)
+      RecorderStats before, after;
+      recorderGetStats(&before);
+      const bool moving = gStepEn && (physStepPos != physStepTarget || gIsHoming);
+      recorderService();
+      recorderGetStats(&after);
+      if (after.writes != before.writes) CHECK(!moving);
+    }
+    tick++;
+  }
+}
+
+// ==================== TESTS ====================
+
+static std::vector<RecorderRecord> readRecords(const char* path) {
+  std::vector<RecorderRecord> recs(hostSpiffsGet(path, NULL, 0) / sizeof(RecorderRecord));
+  hostSpiffsGet(path, recs.data(), recs.size() * sizeof(RecorderRecord));
+  return recs;
+}
+
+static ReplayStats runReplay(ReplayClockFn clock) {
+  CHECK(replayStart(clock));
+  CHECK(replayActive());
+  for (int i = 0; i < 1000 && replayActive(); i++) replayService();
+  ReplayStats st;
+  replayGetStats(&st);
+  return st;
+}
+
+static std::vector<std::vector<uint8_t>> gIndications;
+
+static void captureIndication(const uint8_t* data, size_t len) {
+  gIndications.emplace_back(data, data + len);
+}
+
+// A central connects mid-replay and writes: refused with "operation failed",
+// never applied, and the replay's own commands get no indications
+static void testWriteDuringReplay(const std::vector<RecorderRecord>& expect) {
+  static const uint8_t PEER[6] = {1, 2, 3, 4, 5, 6};
+  const ControlMode modeBefore = gMode;
+  const int16_t wattsBefore = ergTargetWatts;
+  bleSendResponses();   // The comms task had discarded the ride's responses (no central)
+  gIndications.clear();
+  hostSetIndicateHook(captureIndication);
+
+  CHECK(replayStart(NULL));
+  replayService();
+  bleOnConnect(PEER);
+  ftmsWrite({FTMS_OP_SET_TARGET_POWER, 0x2C, 0x01});   // 300 W
+  bleSendResponses();
+  CHECK(gIndications.size() == 1);
+  if (gIndications.size() == 1) {
+    const std::vector<uint8_t> refused = {FTMS_OP_RESPONSE_CODE, FTMS_OP_SET_TARGET_POWER, FTMS_RESULT_FAILED};
+    CHECK(gIndications[0] == refused);
+  }
+  while (replayActive()) {
+    replayService();
+    bleSendResponses();
+  }
+  CHECK(gIndications.size() == 1);
+
+  // Same output as without the write, and nothing left queued behind it
+  const std::vector<RecorderRecord> out = readRecords(REPLAY_FILE);
+  CHECK(out.size() == expect.size() &&
+        memcmp(out.data(), expect.data(), out.size() * sizeof(RecorderRecord)) == 0);
+  bleProcessCommands();
+  bleSendResponses();
+  CHECK(gMode == modeBefore && ergTargetWatts == wattsBefore);
+  CHECK(gIndications.size() == 1);
+
+  // After the replay, writes are applied and answered again
+  ftmsWrite({FTMS_OP_REQUEST_CONTROL});
+  bleProcessCommands();
+  bleSendResponses();
+  CHECK(gIndications.size() == 2);
+  bleOnDisconnect();
+  hostSetIndicateHook(NULL);
+}
+
+// The control task's recorder sample, every 50 ms for ms
+static void sampleFor(uint32_t ms) {
+  for (uint32_t t = 0; t < ms; t += 50) {
+    hostAdvanceUs(50000);
+    trainerStatePublish();
+    TrainerSnapshot snap;
+    trainerStateRead(&snap);
+    recorderSample(snap, 0);
+  }
+}
+
+// A buffer handed over mid-move stays in RAM until the motor stops; until
+// then neither a flush nor a replay start counts it as on flash
+static void testWriteWaitsForMotor() {
+  stepperEnable(true);
+  stepperSetTarget(logStepPos + 800);
+  for (int i = 0; i < 4; i++) {
+    hostAdvanceUs(5000);
+    stepperUpdate();
+  }
+
+  RecorderStats before, mid, after;
+  recorderGetStats(&before);
+  TrainerSnapshot snap;
+  trainerStatePublish();
+  trainerStateRead(&snap);
+  recorderSample(snap, 0);
+  recorderFlush();              // Hand-over requested...
+  recorderSample(snap, 0);      // ...and done on the next sample
+  CHECK(physStepPos != physStepTarget);
+  recorderService();
+  recorderGetStats(&mid);
+  CHECK(mid.writes == before.writes);
+  CHECK(mid.writesDeferred > before.writesDeferred);
+  CHECK(!recorderFlush());
+  CHECK(!replayStart(NULL));
+  ReplayStats rst;
+  replayGetStats(&rst);
+  CHECK(rst.state == REPLAY_FAILED && rst.error && strstr(rst.error, "flash"));
+
+  for (int i = 0; i < 2000 && physStepPos != physStepTarget; i++) {
+    hostAdvanceUs(5000);
+    stepperUpdate();
+  }
+  CHECK(gStepEn);                 // Settled, not merely disabled
+  recorderService();
+  recorderGetStats(&after);
+  CHECK(after.writes == before.writes + 1);
+  CHECK(after.dropped == before.dropped);
+
+  // Settled and past the recorder's tail: everything reaches flash
+  sampleFor(RECORDER_TAIL_MS + 500);
+  CHECK(recorderFlush());
+  recorderGetStats(&after);
+  CHECK(!after.active);
+  CHECK(replayStart(NULL));
+  while (replayActive()) replayService();
+}
+
+int main() {
+  calibrationInit();
+  sensorsInit();
+  stepperInit();
+  recorderInit();
+  recordRide();
+
+  const std::vector<RecorderRecord> rec = readRecords(RECORDER_FILE);
+  CHECK(rec.size() > 500);
+  RecorderStats recSt;
+  recorderGetStats(&recSt);
+  CHECK(recSt.dropped == 0);      // The second buffer covers the deferrals
+  const ControlMode modeAfter = gMode;
+
+  // Modelled stepper (the on-device path): a pure function of the recording
+  const ReplayStats a = runReplay(NULL);
+  const std::vector<RecorderRecord> outA = readRecords(REPLAY_FILE);
+  const ReplayStats b = runReplay(NULL);
+  const std::vector<RecorderRecord> outB = readRecords(REPLAY_FILE);
+  CHECK(a.state == REPLAY_DONE && a.modelStepper);
+  CHECK(a.records == rec.size());
+  CHECK(outA.size() == rec.size());
+  CHECK(a.commands == 3);
+  CHECK(a.edges > 4000);
+  CHECK(outA.size() == outB.size() &&
+        memcmp(outA.data(), outB.data(), outA.size() * sizeof(RecorderRecord)) == 0);
+  CHECK(b.records == a.records && b.speedRmsMph == a.speedRmsMph);
+  CHECK(a.speedRmsMph < 0.3f);
+  CHECK(gMode == modeAfter);   // Control state restored
+  CHECK(currentSpeedMph == 0.0f);
+  testWriteDuringReplay(outA);
+
+  // Real planner on the simulated step timer: targets track the recording
+  hostStepperPark(rec[0].pos);
+  hostReplayClockReset();
+  const ReplayStats live = runReplay(hostReplayClock);
+  CHECK(live.state == REPLAY_DONE && !live.modelStepper);
+  CHECK(live.records == rec.size());
+  CHECK(live.speedRmsMph < 0.3f);
+  CHECK(live.powerRmsW < 10.0f);
+  CHECK(live.targetRms < 10.0f);
+  printf("replay: %u records, %u s of ride; live rms speed %.3f mph, power %.1f W, target %.1f; "
+         "model rms power %.1f W, target %.1f\n",
+         (unsigned)live.records, (unsigned)(live.rideMs / 1000), live.speedRmsMph, live.powerRmsW, live.targetRms, a.powerRmsW, a.targetRms);
+
+  // Refused while the rollers turn
+  currentSpeedMph = 10.0f;
+  CHECK(!replayStart(NULL));
+  currentSpeedMph = 0.0f;
+
+  testWriteWaitsForMotor();
+  return hostTestResult("test_replay");
+}
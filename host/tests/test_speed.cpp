@@ -0,0 +1,74 @@
+/*
+ * test_speed.cpp - Hall Edge Ring and Speed Estimator
+ */
+
+#include "host_test.h"
+#include "host_sim.h"
+#include "sensors.h"
+
+static const uint64_t UPDATE_US = 50000;   // sensorsUpdate() at 20 Hz, as in controlTask
+static uint64_t gNextEdgeUs = 0;
+static uint64_t gNextUpdateUs = 0;
+
+// Run for `us` with the roller at mph(t); edges fire the hall ISR
+static void ride(uint64_t us, float (*mph)(float tS)) {
+  const uint64_t start = hostTimeUs();
+  const uint64_t end = start + us;
+  if (gNextEdgeUs < start) gNextEdgeUs = start;
+  if (gNextUpdateUs < start) gNextUpdateUs = start + UPDATE_US;
+
+  while (true) {
+    const uint64_t next = (gNextEdgeUs < gNextUpdateUs) ? gNextEdgeUs : gNextUpdateUs;
+    if (next > end) break;
+    hostAdvanceUs(next - hostTimeUs());
+
+    if (next == gNextEdgeUs) {
+      const float v = mph((next - start) * 1e-6f);
+      if (v > 0.0f) {
+        hallISR();
+        gNextEdgeUs = next + (uint64_t)(60e6f / (mphToRpm(v) * HALL_PULSES_PER_REV));
+      } else {
+        gNextEdgeUs = next + 1000;  // Stopped: poll the profile again shortly
+      }
+    } else {
+      sensorsUpdate();
+      gNextUpdateUs = next + UPDATE_US;
+    }
+  }
+  hostAdvanceUs(end - hostTimeUs());
+}
+
+static float steady20(float) { return 20.0f; }
+static float stopped(float) { return 0.0f; }
+static float ramp(float tS) { return 10.0f + 2.0f * tS; }  // +2 mph/s
+
+int main() {
+  sensorsInit();
+
+  // Conversions are inverse of each other
+  CHECK_NEAR(rpmToMph(mphToRpm(17.3f)), 17.3, 1e-3);
+  CHECK(rpmToMph(-5.0f) == 0.0f);
+
+  // Constant speed: converges and holds without acceleration
+  ride(3000000, steady20);
+  CHECK_NEAR(currentSpeedMph, 20.0, 0.05);
+  CHECK_NEAR(currentAccelMphS, 0.0, 0.1);
+  CHECK(hallLastIntervalUs() > 0);
+  CHECK(currentPowerWatts > 0.0f);
+
+  // Steady ramp: tracks speed and reports the slope
+  ride(3000000, ramp);
+  CHECK_NEAR(currentSpeedMph, 16.0, 0.3);
+  CHECK_NEAR(currentAccelMphS, 2.0, 0.4);
+
+  // Stop: falls to zero once the edges stop
+  ride(1000000, stopped);
+  CHECK(currentSpeedMph == 0.0f);
+  CHECK(hallLastIntervalUs() == 0);
+
+  // Restart after a stop starts a new run (no span across the gap)
+  ride(2000000, steady20);
+  CHECK_NEAR(currentSpeedMph, 20.0, 0.05);
+
+  return hostTestResult("test_speed");
+}
@@ -0,0 +1,238 @@
+/*
+ * test_stepper.cpp - Step Timer Planner and Homing
+ */
+
+#include "host_test.h"
+#include "host_sim.h"
+#include "stepper_control.h"
+#include <esp_system.h>
+#include <vector>
+
+// Step pulse log from the STEP/DIR pins
+static std::vector<uint64_t> gEdges;
+static bool gDirForward = false;
+static int32_t gPinPos = 0;       // Position counted from the pins
+static int32_t gLimitAtOrBelow = -1000000;  // Simulated switch position (physical steps)
+
+static void pinHook(int pin, int level, uint64_t timeUs) {
+  if (pin == DIR_PIN) gDirForward = (level != 0);
+  if (pin == STEP_PIN && level) {
+    gEdges.push_back(timeUs);
+    gPinPos += gDirForward ? 1 : -1;
+    hostSetPin(LIMIT_PIN, gPinPos <= gLimitAtOrBelow ? LOW : HIGH);
+  }
+}
+
+// Task side, as controlTask runs it
+static void runMs(uint32_t ms) {
+  for (uint32_t i = 0; i < ms; i += 5) {
+    hostAdvanceUs(5000);
+    stepperUpdate();
+  }
+}
+
+static void testMove(int32_t fromLog, int32_t toLog) {
+  stepperSetTarget(fromLog);
+  runMs(3000);
+  CHECK(logStepPos == fromLog);
+
+  gEdges.clear();
+  stepperResetPulseStats();
+  const int32_t start = physStepPos;
+  const int32_t goal = logicalToSteps(toLog);
+  const int dir = (goal > start) ? 1 : -1;
+  stepperSetTarget(toLog);
+
+  int32_t furthest = 0;
+  for (int i = 0; i < 20000 && physStepPos != goal; i++) {
+    hostAdvanceUs(500);
+    if (i % 10 == 0) stepperUpdate();
+    const int32_t travelled = dir * (physStepPos - start);
+    if (travelled > furthest) furthest = travelled;
+  }
+
+  CHECK(physStepPos == goal);
+  CHECK(furthest == dir * (goal - start));          // No overshoot
+  CHECK((int32_t)gEdges.size() == dir * (goal - start));
+
+  // Never faster than the run speed; the timer holds the programmed interval
+  uint64_t minGap = UINT64_MAX;
+  for (size_t i = 1; i < gEdges.size(); i++) {
+    if (gEdges[i] - gEdges[i - 1] < minGap) minGap = gEdges[i] - gEdges[i - 1];
+  }
+  CHECK(minGap >= 1000000 / (uint64_t)DEFAULT_STEP_SPEED_SPS);
+  CHECK(gStepLateMaxUs <= 3);  // Pulse width + DIR setup inside the ISR
+}
+
+static void testDeadband() {
+  // Settled and disabled: a nudge inside STEP_ON_DEADBAND_LOG stays put
+  stepperSetTarget(500);
+  runMs(4000);
+  CHECK(!gStepEn);
+  stepperSetTarget(505);
+  runMs(500);
+  CHECK(!gStepEn);
+  CHECK(logStepPos == 500);
+
+  stepperSetTarget(520);
+  runMs(500);
+  CHECK(physStepPos == logicalToSteps(520));
+}
+
+static void testRetarget() {
+  // A target that moves during the move blends into the new one
+  stepperSetTarget(100);
+  runMs(3000);
+  stepperSetTarget(700);
+  runMs(150);
+  stepperSetTarget(300);
+  runMs(3000);
+  CHECK(logStepPos == 300);
+  CHECK(physStepPos == logicalToSteps(300));
+}
+
+static void testHoming() {
+  // Switch closes at physical step 0 of a rotor sitting at step 2000
+  gPinPos = 2000;
+  gLimitAtOrBelow = 0;
+  hostSetPin(LIMIT_PIN, HIGH);
+
+  stepperHomeStart();
+  CHECK(gIsHoming);
+  for (int i = 0; i < 5000 && gIsHoming; i++) runMs(5);
+
+  CHECK(!gIsHoming);
+  CHECK(physStepPos == 0);
+  CHECK(logStepPos == 0);
+  // Seek stopped on the switch, then released a fixed distance from it
+  CHECK(gPinPos > 0 && gPinPos <= 200);
+  CHECK(!stepperLimitPressed());
+}
+
+static void runHoming() {
+  for (int i = 0; i < 5000 && gIsHoming; i++) runMs(5);
+}
+
+// A reset re-runs setup() with RAM state gone; only the RTC record survives
+static void warmReset(int reason) {
+  physStepPos = physStepTarget = 0;
+  logStepPos = logStepTarget = 0;
+  hostSetResetReason(reason);
+  stepperBootHome();
+}
+
+static void testWarmBoot() {
+  StepperBootInfo boot;
+
+  // Power-on always homes, whatever RTC memory holds
+  warmReset(ESP_RST_POWERON);
+  stepperGetBootInfo(&boot);
+  CHECK(boot.homing == BOOT_HOME_FULL);
+  CHECK(gIsHoming);
+  runHoming();
+  CHECK(!gIsHoming);
+  const int32_t pinAtZero = gPinPos;
+
+  // Settled at 600: a software reset trusts the saved position, no motion
+  stepperSetTarget(600);
+  runMs(3000);
+  const int32_t settled = physStepPos;
+  warmReset(ESP_RST_SW);
+  stepperGetBootInfo(&boot);
+  CHECK(boot.homing == BOOT_HOME_TRUSTED);
+  CHECK(!gIsHoming);
+  CHECK(!boot.verifyPending);
+  CHECK(physStepPos == settled && boot.restoredPos == settled);
+  CHECK(logStepPos == 600);
+  CHECK(gPinPos - pinAtZero == settled);
+
+  // Reset in the middle of a move: the record is stale, so home
+  stepperSetTarget(900);
+  runMs(100);
+  CHECK(physStepPos != physStepTarget);
+  warmReset(ESP_RST_SW);
+  stepperGetBootInfo(&boot);
+  CHECK(boot.homing == BOOT_HOME_FULL);
+  runHoming();
+  CHECK(gPinPos == pinAtZero);
+
+  // Brownout with the carriage at 800: trusted, touch deferred until parked low
+  stepperSetTarget(800);
+  runMs(3000);
+  warmReset(ESP_RST_BROWNOUT);
+  stepperGetBootInfo(&boot);
+  CHECK(boot.homing == BOOT_HOME_TRUSTED && boot.verifyPending);
+  runMs(500);
+  CHECK(!gIsHoming);
+
+  // The carriage really sits 30 steps further out than the record says;
+  // parking near the switch starts the touch, which finds the difference
+  gPinPos += 30;
+  stepperSetTarget(20);
+  bool touched = false;
+  for (int i = 0; i < 600 && !touched; i++) {
+    runMs(5);
+    touched = gIsHoming;
+  }
+  CHECK(touched);
+  runHoming();
+  stepperGetBootInfo(&boot);
+  CHECK(boot.verified && !boot.verifyPending);
+  CHECK(boot.verifyErrorSteps >= -31 && boot.verifyErrorSteps <= -29);
+  CHECK(gPinPos == pinAtZero && physStepPos == 0);   // Re-zeroed against the switch
+
+  // Switch pressed at boot: never trust the record
+  stepperSetTarget(0);
+  runMs(3000);
+  gPinPos = gLimitAtOrBelow;
+  hostSetPin(LIMIT_PIN, LOW);
+  warmReset(ESP_RST_SW);
+  stepperGetBootInfo(&boot);
+  CHECK(boot.homing == BOOT_HOME_FULL);
+  runHoming();
+  CHECK(!gIsHoming && !stepperLimitPressed());
+}
+
+// A rehome request stops the carriage where it is, also inside the cooldown
+static void testRehomeFreeze() {
+  stepperSetTarget(900);
+  runMs(3000);
+  stepperSetTarget(100);
+  runMs(150);
+  const int32_t at = logStepPos;
+  CHECK(at < 900 && at > 300);
+
+  stepperRequestRehome("test");
+  CHECK(gRehomeRequested);
+  gRehomeRequested = false;       // Nothing homes here: the freeze has to hold by itself
+  runMs(600);
+  const int32_t stopped = logStepPos;
+  CHECK(stopped <= at && stopped > at - 100);    // Braked, never went on toward 100
+  runMs(400);
+  CHECK(logStepPos == stopped);
+
+  stepperSetTarget(100);
+  runMs(150);
+  const int32_t again = logStepPos;
+  stepperRequestRehome("cooldown");
+  CHECK(!gRehomeRequested);       // Inside REHOME_COOLDOWN_MS: no new homing...
+  runMs(1000);
+  CHECK(logStepPos <= again && logStepPos > again - 100);   // ...but still frozen
+}
+
+int main() {
+  hostSetPinHook(pinHook);
+  stepperInit();
+  stepperEnable(true);
+
+  testMove(0, 900);
+  testMove(900, 50);
+  testMove(200, 230);    // Short move: never reaches cruise
+  testDeadband();
+  testRetarget();
+  testRehomeFreeze();
+  testHoming();
+  testWarmBoot();
+
+  return hostTestResult("test_stepper");
+}
@@ -0,0 +1,184 @@
+/*
+ * test_sweep.cpp - Calibration Sweep Against a Simulated Power Meter
+ */
+
+#include "host_test.h"
+#include "host_sim.h"
+#include "calibration.h"
+#include "sensors.h"
+#include "stepper_control.h"
+#include "ble_backend.h"
+#include "trainer_state.h"
+#include "power_meter.h"
+#include "sweep.h"
+
+// ==================== SIMULATED RIDE ====================
+// Stand-in for the trainer: the stepper arrives at the held position at
+// once, the meter notifies once a second with the model power.
+static float modelWatts(float mph, float pos) {
+  return mph * (5.0f + 0.03f * pos) + 0.15f * mph * mph;
+}
+
+static void meterNotify(float watts) {
+  const int16_t w = (int16_t)lroundf(watts);
+  const uint8_t cpm[4] = {0x00, 0x00, (uint8_t)(w & 0xFF), (uint8_t)((uint16_t)w >> 8)};
+  bleOnMeterMeasurement(cpm, sizeof(cpm));
+}
+
+// What the rider rides, given what the sweep asks for
+typedef float (*RiderFn)(const SweepStatus& st, float tS);
+
+static void ride(RiderFn rider, uint32_t maxS, bool meterOn = true) {
+  const uint32_t startMs = millis();
+  uint32_t nextNotifyMs = startMs;
+  while (millis() - startMs < maxS * 1000) {
+    SweepStatus st;
+    sweepGetStatus(&st);
+    const float tS = (millis() - startMs) * 0.001f;
+
+    currentSpeedMph = rider(st, tS);
+    currentAccelMphS = 0.0f;
+    if (gManualHoldActive) logStepPos = logStepTarget = gManualHoldTarget;
+    trainerStatePublish();
+
+    if (meterOn && (int32_t)(millis() - nextNotifyMs) >= 0) {
+      meterNotify(modelWatts(currentSpeedMph, (float)logStepPos));
+      nextNotifyMs += 1000;
+    }
+    sweepService();
+    if (!sweepActive()) return;
+    delay(50);
+  }
+}
+
+// Holds the band shown, wandering +/-0.6 mph over ~10 s, so the windows
+// have a speed spread to fit
+static float riderFollows(const SweepStatus& st, float tS) {
+  return (st.state == SWEEP_WAIT_METER ? 5.0f : st.bandMph) + 0.6f * sinf(tS * 0.63f);
+}
+
+static float riderStaysSlow(const SweepStatus& st, float tS) {
+  return 5.0f;
+}
+
+// ==================== TESTS ====================
+
+static void testFullSweep() {
+  const double row0 = powerTableGet(0, 2);
+  const double row6 = powerTableGet(POWER_TABLE_ROWS - 1, 2);
+
+  CHECK(sweepStart(NULL));
+  ride(riderFollows, 1200);
+
+  SweepStatus st;
+  sweepGetStatus(&st);
+  CHECK(st.state == SWEEP_DONE);
+  CHECK(st.cells == 25);                 // 5..25 mph x 5 positions
+  CHECK(st.fitted == 25);
+  CHECK(st.skipped == 0);
+  CHECK(!gManualHoldActive);
+
+  // Fitted at the band speed, not at whatever the rider averaged
+  double worst = 0.0;
+  for (int r = 1; r <= 5; r++) {
+    for (int c = 0; c < POWER_TABLE_COLS; c++) {
+      float w = -1.0f;
+      CHECK(sweepResult(r, c, &w));
+      worst = fmax(worst, fabs(w - modelWatts(powerSpeedAxis(r), powerPosAxis(c))));
+    }
+  }
+  printf("  worst fitted cell error %.2f W\n", worst);
+  CHECK(worst < 2.0);
+
+  CHECK(sweepApply() == 25);
+  CHECK_NEAR(powerTableGet(3, 4), modelWatts(15.0f, 1000.0f), 2.0);
+  CHECK_NEAR(powerFromSpeedPos(20.0f, 500.0f), modelWatts(20.0f, 500.0f), 2.0);
+  CHECK(powerTableGet(0, 2) == row0);    // 0 and 50 mph rows untouched
+  CHECK(powerTableGet(POWER_TABLE_ROWS - 1, 2) == row6);
+}
+
+static void testUnsteadyCellsSkipped() {
+  CHECK(sweepStart(NULL));
+  ride(riderStaysSlow, 4000);
+
+  SweepStatus st;
+  sweepGetStatus(&st);
+  CHECK(st.state == SWEEP_DONE);
+  CHECK(st.fitted == 5);                 // Only the 5 mph band
+  CHECK(st.skipped == 20);
+  float w;
+  CHECK(sweepResult(1, 3, &w));
+  CHECK_NEAR(w, modelWatts(5.0f, 750.0f), 1.0);   // No speed spread: plain mean
+  CHECK(!sweepResult(2, 0, &w));
+}
+
+static void testNoMeter() {
+  delay(METER_STALE_MS);
+  CHECK(sweepStart(NULL));
+  ride(riderFollows, 60, false);
+
+  SweepStatus st;
+  sweepGetStatus(&st);
+  CHECK(st.state == SWEEP_FAILED);
+  CHECK(st.error != NULL);
+  CHECK(sweepApply() == 0);
+}
+
+static void testHoldTakenOver() {
+  CHECK(sweepStart(NULL));
+  meterNotify(100.0f);
+  currentSpeedMph = 5.0f;
+  delay(50);
+  trainerStatePublish();
+  sweepService();
+
+  SweepStatus st;
+  sweepGetStatus(&st);
+  CHECK(st.state == SWEEP_SETTLE);
+  CHECK(gManualHoldActive && gManualHoldTarget == st.position);
+
+  gManualHoldActive = false;             // "Resume app" from the web page
+  delay(50);
+  trainerStatePublish();
+  sweepService();
+  sweepGetStatus(&st);
+  CHECK(st.state == SWEEP_FAILED);
+
+  // And cancel releases the hold
+  CHECK(sweepStart(NULL));
+  meterNotify(100.0f);
+  ride(riderFollows, 1);
+  CHECK(gManualHoldActive);
+  sweepCancel();
+  CHECK(!sweepActive());
+  CHECK(!gManualHoldActive);
+}
+
+static void testMeterParsing() {
+  MeterInfo info;
+  const uint8_t shortFrame[3] = {0, 0, 10};
+  meterGetInfo(&info);
+  const uint32_t before = info.measurements;
+  bleOnMeterMeasurement(shortFrame, sizeof(shortFrame));
+  meterNotify(-12.0f);                   // sint16
+  meterGetInfo(&info);
+  CHECK(info.measurements == before + 1);
+  CHECK(info.watts == -12);
+
+  uint8_t peer[6];
+  CHECK(meterParseAddress("c4:3A:00:11:fe:09", peer));
+  CHECK(peer[0] == 0xC4 && peer[5] == 0x09);
+  CHECK(!meterParseAddress("c4:3A:00", peer));
+}
+
+int main() {
+  hostPrefsClear();
+  calibrationInit();
+  delay(1000);
+  testFullSweep();
+  testUnsteadyCellsSkipped();
+  testNoMeter();
+  testHoldTakenOver();
+  testMeterParsing();
+  return hostTestResult("test_sweep");
+}
@@ -0,0 +1,121 @@
+/*
+ * replay.cpp - Replay a Downloaded Ride (/rec.csv) on the Host
+ *
+ *   replay ride.csv [-o replay.csv] [--model] [--lookahead MS]
+ *
+ * Runs the recording through the firmware's sensor/control pipeline with the
+ * real step planner on the simulated step timer (--model: the on-device
+ * position model instead). Writes the replayed trace in the same CSV
+ * columns and prints the differences against the recording, and how far
+ * replayed power was from the ERG setpoint. --lookahead sets the ERG
+ * lookahead (gErgLookaheadMs) for the run; compare runs to pick one.
+ */
+
+#include "host_sim.h"
+#include "replay_clock.h"
+#include "calibration.h"
+#include "sensors.h"
+#include "stepper_control.h"
+#include "recorder.h"
+#include "replay.h"
+#include <chrono>
+#include <vector>
+#include <string.h>
+
+static bool parseCsv(const char* path, std::vector<RecorderRecord>* out) {
+  FILE* f = fopen(path, "r");
+  if (!f) return false;
+  char line[256];
+  while (fgets(line, sizeof(line), f)) {
+    unsigned long ms;
+    unsigned hallUs, flags;
+    float speed, accel;
+    int power, pos, target, setpoint;
+    char mode[8];
+    if (sscanf(line, "%lu,%u,%f,%f,%d,%d,%d,%7[^,],%d,%u", &ms, &hallUs, &speed, &accel,
+               &power, &pos, &target, mode, &setpoint, &flags) != 10) {
+      continue;   // Header
+    }
+    RecorderRecord r;
+    r.ms = (uint32_t)ms;
+    r.hallUs = (uint16_t)hallUs;
+    r.speed = (uint16_t)lroundf(speed * 100.0f);
+    r.accel = (int16_t)lroundf(accel * 100.0f);
+    r.powerW = (int16_t)power;
+    r.pos = (int16_t)pos;
+    r.target = (int16_t)target;
+    r.setpoint = (int16_t)setpoint;
+    r.mode = !strcmp(mode, "ERG") ? MODE_ERG : !strcmp(mode, "SIM") ? MODE_SIM : MODE_IDLE;
+    r.flags = (uint8_t)flags;
+    out->push_back(r);
+  }
+  fclose(f);
+  return true;
+}
+
+static void writeCsv(const char* text, size_t len, void* ctx) {
+  fwrite(text, 1, len, (FILE*)ctx);
+}
+
+int main(int argc, char** argv) {
+  const char* in = NULL;
+  const char* outPath = NULL;
+  bool model = false;
+  float lookaheadMs = -1.0f;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--model")) model = true;
+    else if (!strcmp(argv[i], "--lookahead") && i + 1 < argc) lookaheadMs = (float)atof(argv[++i]);
+    else if (!strcmp(argv[i], "-o") && i + 1 < argc) outPath = argv[++i];
+    else in = argv[i];
+  }
+  if (!in) {
+    fprintf(stderr, "usage: replay ride.csv [-o replay.csv] [--model] [--lookahead MS]\n");
+    return 2;
+  }
+
+  std::vector<RecorderRecord> recs;
+  if (!parseCsv(in, &recs) || recs.empty()) {
+    fprintf(stderr, "replay: no records in %s\n", in);
+    return 1;
+  }
+
+  calibrationInit();
+  if (lookaheadMs >= 0.0f) gErgLookaheadMs = constrain(lookaheadMs, 0.0f, ERG_LOOKAHEAD_MAX_MS);
+  sensorsInit();
+  stepperInit();
+  recorderInit();
+  hostSpiffsPut(RECORDER_FILE, recs.data(), recs.size() * sizeof(RecorderRecord));
+
+  if (!model) {
+    hostStepperPark(recs[0].pos);
+    hostReplayClockReset();
+  }
+  if (!replayStart(model ? NULL : hostReplayClock)) {
+    fprintf(stderr, "replay: start failed\n");
+    return 1;
+  }
+  // cpuUs is simulated time here (micros() is the virtual clock): time the host
+  const auto t0 = std::chrono::steady_clock::now();
+  while (replayActive()) replayService();
+  const double hostMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+  FILE* out = outPath ? fopen(outPath, "w") : stdout;
+  if (!out) {
+    fprintf(stderr, "replay: cannot write %s\n", outPath);
+    return 1;
+  }
+  replayExportCsv(writeCsv, out);
+  if (outPath) fclose(out);
+
+  ReplayStats st;
+  replayGetStats(&st);
+  fprintf(stderr, "%u records, %u edges, %u commands, %.1f s of ride in %.1f ms (%s stepper)\n",
+          (unsigned)st.records, (unsigned)st.edges, (unsigned)st.commands, st.rideMs * 1e-3,
+          hostMs, st.modelStepper ? "modelled" : "live");
+  fprintf(stderr, "replayed - recorded: speed rms %.3f / max %.2f mph, power rms %.1f / max %.0f W, "
+          "target rms %.1f / max %.0f\n", st.speedRmsMph, st.speedMaxMph, st.powerRmsW, st.powerMaxW,
+          st.targetRms, st.targetMax);
+  fprintf(stderr, "ERG (lookahead %.0f ms): replayed power - setpoint rms %.1f / max %.0f W over %u records\n",
+          gErgLookaheadMs, st.ergRmsW, st.ergMaxW, (unsigned)st.ergRecords);
+  return 0;
+}
@@ -0,0 +1,52 @@
+/*
+ * replay_clock.h - Live Stepper Clock for Host Replays
+ *
+ * Maps the replay's virtual time onto the simulated clock and runs the
+ * control task's 5 ms stepperUpdate() on the way, so the step timer ISR
+ * moves the motor exactly as it would on the trainer.
+ */
+
+#ifndef HOST_REPLAY_CLOCK_H
+#define HOST_REPLAY_CLOCK_H
+
+#include "host_sim.h"
+#include "stepper_control.h"
+
+static bool gReplayClockSynced = false;
+static uint64_t gReplayClockBaseUs = 0;
+static uint32_t gReplayClockBaseVirtUs = 0;
+static uint64_t gReplayClockNextUpdateUs = 0;
+
+static void hostReplayClockReset() {
+  gReplayClockSynced = false;
+}
+
+static void hostReplayClock(uint32_t nowUs) {
+  if (!gReplayClockSynced) {
+    gReplayClockSynced = true;
+    gReplayClockBaseUs = hostTimeUs();
+    gReplayClockBaseVirtUs = nowUs;
+    gReplayClockNextUpdateUs = hostTimeUs() + CONTROL_PERIOD_MS * 1000;
+  }
+  const uint64_t until = gReplayClockBaseUs + (uint32_t)(nowUs - gReplayClockBaseVirtUs);
+  while (hostTimeUs() < until) {
+    if (gReplayClockNextUpdateUs <= until) {
+      hostAdvanceUs(gReplayClockNextUpdateUs - hostTimeUs());
+      stepperUpdate();
+      gReplayClockNextUpdateUs += CONTROL_PERIOD_MS * 1000;
+    } else {
+      hostAdvanceUs(until - hostTimeUs());
+    }
+  }
+}
+
+// Park the motor at a logical position (settled and idle) before a replay
+static void hostStepperPark(int32_t logical) {
+  stepperSetTarget(logical);
+  for (int i = 0; i < 1200; i++) {   // 6 s: move, then the idle disable
+    hostAdvanceUs(CONTROL_PERIOD_MS * 1000);
+    stepperUpdate();
+  }
+}
+
+#endif // HOST_REPLAY_CLOCK_H
@@ -0,0 +1,151 @@
+/*
+ * json_stream.cpp - Chunked Streaming JSON Writer Implementation
+ */
+
+#include "json_stream.h"
+#include <stdarg.h>
+#include <math.h>
+
+// ==================== RESPONSE ====================
+
+void JsonStreamWriter::begin(int code) {
+  server_.setContentLength(CONTENT_LENGTH_UNKNOWN);  // Chunked transfer
+  server_.send(code, "application/json", "");
+  len_ = 0;
+  depth_ = 0;
+  hasItem_ = 0;
+  afterKey_ = false;
+}
+
+void JsonStreamWriter::end() {
+  flush_();
+  server_.sendContent("");  // Zero-length chunk ends the body
+}
+
+// ==================== STRUCTURE ====================
+
+void JsonStreamWriter::beginObject(const char* key) {
+  startContainer_(key);
+  rawChar_('{');
+  if (depth_ < MAX_DEPTH) depth_++;
+  hasItem_ &= ~(1u << depth_);
+}
+
+void JsonStreamWriter::endObject() {
+  rawChar_('}');
+  if (depth_ > 0) depth_--;
+}
+
+void JsonStreamWriter::beginArray(const char* key) {
+  startContainer_(key);
+  rawChar_('[');
+  if (depth_ < MAX_DEPTH) depth_++;
+  hasItem_ &= ~(1u << depth_);
+}
+
+void JsonStreamWriter::endArray() {
+  rawChar_(']');
+  if (depth_ > 0) depth_--;
+}
+
+// ==================== VALUES ====================
+
+void JsonStreamWriter::value(long v) {
+  separator_();
+  printf_("%ld", v);
+}
+
+void JsonStreamWriter::value(unsigned long v) {
+  separator_();
+  printf_("%lu", v);
+}
+
+void JsonStreamWriter::value(float v, uint8_t decimals) {
+  separator_();
+  if (isnan(v) || isinf(v)) {
+    raw_("null");
+  } else {
+    printf_("%.*f", (int)decimals, v);
+  }
+}
+
+void JsonStreamWriter::value(bool v) {
+  separator_();
+  raw_(v ? "true" : "false");
+}
+
+void JsonStreamWriter::value(const char* v) {
+  separator_();
+  rawChar_('"');
+  for (const char* p = v ? v : ""; *p; p++) {
+    const char c = *p;
+    if (c == '"' || c == '\\') {
+      rawChar_('\\');
+      rawChar_(c);
+    } else if ((uint8_t)c < 0x20) {
+      printf_("\\u%04x", (unsigned)(uint8_t)c);
+    } else {
+      rawChar_(c);
+    }
+  }
+  rawChar_('"');
+}
+
+// ==================== INTERNALS ====================
+
+void JsonStreamWriter::key_(const char* key) {
+  value(key);
+  rawChar_(':');
+  afterKey_ = true;
+}
+
+void JsonStreamWriter::startContainer_(const char* key) {
+  if (key) {
+    key_(key);
+    afterKey_ = false;  // The container itself is the value
+  } else {
+    separator_();
+  }
+}
+
+// Comma before every item except the first at this level (and never after a key)
+void JsonStreamWriter::separator_() {
+  if (afterKey_) {
+    afterKey_ = false;
+    return;
+  }
+  const uint32_t bit = 1u << depth_;
+  if (hasItem_ & bit) rawChar_(',');
+  hasItem_ |= bit;
+}
+
+void JsonStreamWriter::raw_(const char* s, size_t n) {
+  while (n > 0) {
+    if (len_ == BUF_SIZE) flush_();
+    size_t take = min(n, BUF_SIZE - len_);
+    memcpy(buf_ + len_, s, take);
+    len_ += take;
+    s += take;
+    n -= take;
+  }
+}
+
+void JsonStreamWriter::rawChar_(char c) {
+  if (len_ == BUF_SIZE) flush_();
+  buf_[len_++] = c;
+}
+
+void JsonStreamWriter::printf_(const char* fmt, ...) {
+  char tmp[32];
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(tmp, sizeof(tmp), fmt, args);
+  va_end(args);
+  if (n > 0) raw_(tmp, min((size_t)n, sizeof(tmp) - 1));
+}
+
+void JsonStreamWriter::flush_() {
+  if (len_ == 0) return;
+  server_.sendContent(buf_, len_);
+  len_ = 0;
+}
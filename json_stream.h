@@ -0,0 +1,72 @@
+/*
+ * json_stream.h - Chunked Streaming JSON Writer
+ *
+ * Emits JSON into a small fixed buffer that is flushed to the WebServer
+ * client as HTTP chunks, so a response costs the same RAM however large
+ * it gets. Commas are inserted automatically:
+ *
+ *   JsonStreamWriter j(server);
+ *   j.begin();
+ *   j.beginObject();
+ *   j.field("a", 1.5f, 2);
+ *   j.beginArray("values"); j.value(1); j.value(2); j.endArray();
+ *   j.endObject();
+ *   j.end();
+ */
+
+#ifndef JSON_STREAM_H
+#define JSON_STREAM_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+
+class JsonStreamWriter {
+ public:
+  static constexpr size_t BUF_SIZE = 256;
+  static constexpr int MAX_DEPTH = 16;
+
+  explicit JsonStreamWriter(WebServer& server) : server_(server) {}
+
+  void begin(int code = 200);   // Send headers (chunked, application/json)
+  void end();                   // Flush and terminate the chunked body
+
+  void beginObject(const char* key = NULL);
+  void endObject();
+  void beginArray(const char* key = NULL);
+  void endArray();
+
+  // Array elements
+  void value(long v);
+  void value(int v) { value((long)v); }
+  void value(unsigned long v);
+  void value(float v, uint8_t decimals);
+  void value(bool v);
+  void value(const char* v);
+
+  // Object members
+  void field(const char* key, long v)          { key_(key); value(v); }
+  void field(const char* key, int v)           { key_(key); value((long)v); }
+  void field(const char* key, unsigned long v) { key_(key); value(v); }
+  void field(const char* key, float v, uint8_t decimals) { key_(key); value(v, decimals); }
+  void field(const char* key, bool v)          { key_(key); value(v); }
+  void field(const char* key, const char* v)   { key_(key); value(v); }
+
+ private:
+  void key_(const char* key);
+  void startContainer_(const char* key);
+  void separator_();
+  void raw_(const char* s, size_t n);
+  void raw_(const char* s) { raw_(s, strlen(s)); }
+  void rawChar_(char c);
+  void printf_(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+  void flush_();
+
+  WebServer& server_;
+  char buf_[BUF_SIZE];
+  size_t len_ = 0;
+  int depth_ = 0;
+  uint32_t hasItem_ = 0;        // Bit per nesting level: needs a comma before next item
+  bool afterKey_ = false;
+};
+
+#endif // JSON_STREAM_H
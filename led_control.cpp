@@ -6,89 +6,93 @@
 #include "stepper_control.h"
 #include "ble_trainer.h"
 #include "web_server.h"
+#include "trainer_state.h"
 
 // ==================== LED STATE ====================
+// Steady patterns run in the LEDC peripheral (blink rate = PWM frequency,
+// on-time = duty), so loop() only touches the LED when the pattern changes.
+// The blips don't fit one PWM period and are still timed in software.
+struct LedHwPattern {
+  uint8_t freqHz;       // 0 = steady level
+  uint16_t onPermille;
+};
+
+static const LedHwPattern LED_HW_PATTERNS[] = {
+  {0, 0},      // LED_OFF
+  {0, 1000},   // LED_SOLID
+  {1, 500},    // LED_BLINK_SLOW: 1 Hz (500/500)
+  {2, 500},    // LED_BLINK_MED: 2 Hz (250/250)
+  {10, 500},   // LED_BLINK_FAST: 10 Hz (50/50)
+  {1, 80},     // LED_HEARTBEAT: 80 ms on, 920 ms off
+};
+static constexpr uint32_t LED_DUTY_MAX = (1UL << LED_LEDC_BITS) - 1;
+
 static LedPattern gLedPattern = LED_OFF;
-static bool gLedOn = false;
 static uint32_t gLedNextMs = 0;
+static uint32_t gLedSelectMs = 0;
 static uint8_t gLedPhase = 0;
+static uint8_t gLedFreqHz = 1;     // Current LEDC frequency
 
 // ==================== HELPER FUNCTIONS ====================
 
+static inline void ledDuty(uint16_t onPermille) {
+  uint32_t duty = (uint32_t)((uint64_t)LED_DUTY_MAX * onPermille / 1000);
+  if (!LED_ACTIVE_HIGH) duty = LED_DUTY_MAX - duty;
+  ledcWrite(LED_PIN, duty);
+}
+
 static inline void ledWrite(bool on) {
-  digitalWrite(LED_PIN, (on ^ !LED_ACTIVE_HIGH) ? HIGH : LOW);
+  ledDuty(on ? 1000 : 0);
+}
+
+static inline bool ledIsHardware(LedPattern p) {
+  return p < sizeof(LED_HW_PATTERNS) / sizeof(LED_HW_PATTERNS[0]);
 }
 
 // ==================== PUBLIC FUNCTIONS ====================
 
 void ledInit() {
-  pinMode(LED_PIN, OUTPUT);
+  if (!ledcAttach(LED_PIN, gLedFreqHz, LED_LEDC_BITS)) {
+    Serial.println("✗ LED: LEDC attach failed");
+  }
   ledWrite(false);
-  Serial.println("✓ LED initialized");
+  Serial.println("✓ LED initialized (LEDC)");
 }
 
 void ledSetPattern(LedPattern p) {
   if (p == gLedPattern) return;
   gLedPattern = p;
   gLedPhase = 0;
-  gLedOn = false;
   gLedNextMs = 0;
-  ledWrite(false);
+
+  if (!ledIsHardware(p)) {
+    ledWrite(false);
+    return;
+  }
+  const LedHwPattern& hw = LED_HW_PATTERNS[p];
+  if (hw.freqHz != 0 && hw.freqHz != gLedFreqHz) {
+    if (ledcChangeFrequency(LED_PIN, hw.freqHz, LED_LEDC_BITS) != 0) gLedFreqHz = hw.freqHz;
+  }
+  ledDuty(hw.onPermille);
 }
 
 // Forward declaration
 static void ledSelectPattern();
 
 void ledUpdate() {
-  // Update pattern based on system state
-  ledSelectPattern();
-  
-  // Execute current pattern
   const uint32_t now = millis();
+
+  // Update pattern based on system state
+  if (now - gLedSelectMs >= LED_SELECT_MS) {
+    gLedSelectMs = now;
+    ledSelectPattern();
+  }
+
+  // Hardware patterns need nothing further; blips step on their own timing
+  if (ledIsHardware(gLedPattern)) return;
   if (gLedNextMs != 0 && (int32_t)(now - gLedNextMs) < 0) return;
   
   switch (gLedPattern) {
-    case LED_OFF:
-      ledWrite(false);
-      gLedNextMs = now + 500;
-      break;
-      
-    case LED_SOLID:
-      ledWrite(true);
-      gLedNextMs = now + 500;
-      break;
-      
-    case LED_BLINK_SLOW:  // 1 Hz (500/500)
-      gLedOn = !gLedOn;
-      ledWrite(gLedOn);
-      gLedNextMs = now + 500;
-      break;
-      
-    case LED_BLINK_MED:  // 2 Hz (250/250)
-      gLedOn = !gLedOn;
-      ledWrite(gLedOn);
-      gLedNextMs = now + 250;
-      break;
-      
-    case LED_BLINK_FAST:  // 10 Hz (50/50)
-      gLedOn = !gLedOn;
-      ledWrite(gLedOn);
-      gLedNextMs = now + 50;
-      break;
-      
-    case LED_HEARTBEAT:
-      // Short ON (80ms) then long OFF (920ms)
-      if (gLedPhase == 0) {
-        ledWrite(true);
-        gLedNextMs = now + 80;
-        gLedPhase = 1;
-      } else {
-        ledWrite(false);
-        gLedNextMs = now + 920;
-        gLedPhase = 0;
-      }
-      break;
-      
     case LED_DOUBLE_BLIP:
       // ON 80, OFF 120, ON 80, OFF 1700
       switch (gLedPhase) {
@@ -150,10 +154,16 @@ void ledUpdate() {
           break;
       }
       break;
+
+    default:
+      break;
   }
 }
 
 static void ledSelectPattern() {
+  TrainerSnapshot snap;
+  trainerStateRead(&snap);
+
   // Highest priority first
   if (gOtaInProgress) {
     ledSetPattern(LED_BLINK_FAST);
@@ -165,18 +175,18 @@ static void ledSelectPattern() {
     return;
   }
   
-  if (gRehomeRequested) {
+  if (snap.rehomeRequested) {
     ledSetPattern(LED_TRIPLE_BLIP);
     return;
   }
   
-  if (gIsHoming) {
+  if (snap.homing) {
     ledSetPattern(LED_BLINK_MED);
     return;
   }
   
   if (deviceConnected) {
-    switch (gMode) {
+    switch (snap.mode) {
       case MODE_ERG:
         ledSetPattern(LED_SOLID);
         return;
@@ -190,7 +200,7 @@ static void ledSelectPattern() {
   }
   
   // Not connected
-  switch (gMode) {
+  switch (snap.mode) {
     case MODE_ERG:
       ledSetPattern(LED_SOLID);
       break;
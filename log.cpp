@@ -0,0 +1,121 @@
+/*
+ * log.cpp - Deferred, Leveled Logging Implementation
+ */
+
+#include "log.h"
+#include <stdarg.h>
+
+// ==================== RING BUFFER ====================
+// Positions are free-running byte counters; index = pos % LOG_RING_SIZE.
+// gLogSerialPos trails gLogHead by whatever the UART has not taken yet.
+static char gLogRing[LOG_RING_SIZE];
+static uint32_t gLogHead = 0;
+static uint32_t gLogSerialPos = 0;
+static uint32_t gLogDropped = 0;
+static portMUX_TYPE gLogMux = portMUX_INITIALIZER_UNLOCKED;
+
+static constexpr size_t LOG_LINE_MAX = 192;
+
+static const char LOG_LEVEL_CHARS[] = {'-', 'E', 'W', 'I', 'D'};
+
+// ==================== HELPERS ====================
+
+// Copy len bytes starting at ring position pos (handles the wrap)
+static void ringRead(uint32_t pos, char* dst, size_t len) {
+  size_t idx = pos % LOG_RING_SIZE;
+  size_t first = min(len, (size_t)LOG_RING_SIZE - idx);
+  memcpy(dst, gLogRing + idx, first);
+  memcpy(dst + first, gLogRing, len - first);
+}
+
+static void ringWrite(uint32_t pos, const char* src, size_t len) {
+  size_t idx = pos % LOG_RING_SIZE;
+  size_t first = min(len, (size_t)LOG_RING_SIZE - idx);
+  memcpy(gLogRing + idx, src, first);
+  memcpy(gLogRing, src + first, len - first);
+}
+
+// ==================== PUBLIC FUNCTIONS ====================
+
+void logWrite(uint8_t level, const char* tag, const char* fmt, ...) {
+  char line[LOG_LINE_MAX];
+  uint32_t ms = millis();
+
+  // Format outside the lock: "  12.345 I [TAG] message\n"
+  int n = snprintf(line, sizeof(line), "%5lu.%03lu %c [%s] ",
+                   (unsigned long)(ms / 1000), (unsigned long)(ms % 1000),
+                   LOG_LEVEL_CHARS[level <= LOG_LEVEL_DEBUG ? level : 0], tag);
+  if (n < 0) return;
+
+  va_list args;
+  va_start(args, fmt);
+  int m = vsnprintf(line + n, sizeof(line) - n, fmt, args);
+  va_end(args);
+  if (m < 0) return;
+
+  size_t len = min((size_t)(n + m), sizeof(line) - 2);
+  if (len == 0 || line[len - 1] != '\n') line[len++] = '\n';
+
+  portENTER_CRITICAL(&gLogMux);
+  ringWrite(gLogHead, line, len);
+  gLogHead += len;
+  // Writer lapped the serial cursor: oldest pending text is gone
+  if (gLogHead - gLogSerialPos > LOG_RING_SIZE) {
+    gLogDropped += (gLogHead - LOG_RING_SIZE) - gLogSerialPos;
+    gLogSerialPos = gLogHead - LOG_RING_SIZE;
+  }
+  portEXIT_CRITICAL(&gLogMux);
+}
+
+void logDrain() {
+#if LOG_TO_SERIAL
+  int room = Serial.availableForWrite();
+  if (room <= 0) return;
+
+  char chunk[64];
+  while (room > 0) {
+    size_t n = 0;
+    portENTER_CRITICAL(&gLogMux);
+    size_t pending = gLogHead - gLogSerialPos;
+    n = min(pending, min((size_t)room, sizeof(chunk)));
+    ringRead(gLogSerialPos, chunk, n);
+    gLogSerialPos += n;
+    portEXIT_CRITICAL(&gLogMux);
+
+    if (n == 0) break;
+    Serial.write((const uint8_t*)chunk, n);
+    room -= n;
+  }
+#else
+  portENTER_CRITICAL(&gLogMux);
+  gLogSerialPos = gLogHead;
+  portEXIT_CRITICAL(&gLogMux);
+#endif
+}
+
+size_t logCopyHistory(char* out, size_t outSize) {
+  if (outSize == 0) return 0;
+
+  portENTER_CRITICAL(&gLogMux);
+  uint32_t end = gLogHead;
+  uint32_t avail = min(end, (uint32_t)LOG_RING_SIZE);
+  uint32_t count = min(avail, (uint32_t)(outSize - 1));
+  uint32_t start = end - count;
+  ringRead(start, out, count);
+  bool midLine = (start > 0 && gLogRing[(start - 1) % LOG_RING_SIZE] != '\n');
+  portEXIT_CRITICAL(&gLogMux);
+
+  // Drop a partial first line if the window starts mid-line
+  size_t skip = 0;
+  if (midLine) {
+    while (skip < count && out[skip] != '\n') skip++;
+    if (skip < count) skip++;
+  }
+  memmove(out, out + skip, count - skip);
+  out[count - skip] = '\0';
+  return count - skip;
+}
+
+uint32_t logDroppedBytes() {
+  return gLogDropped;
+}
@@ -0,0 +1,61 @@
+/*
+ * log.h - Deferred, Leveled Logging
+ *
+ * LOG_x("TAG", fmt, ...) formats into a RAM ring buffer instead of writing
+ * to the UART. logDrain() (called from loop) copies pending text to Serial
+ * only as far as the TX FIFO has room, so a log call never stalls on the
+ * baud rate. The ring also keeps recent history for the web UI (/log.txt).
+ *
+ * Levels above LOG_LEVEL (config.h) compile to nothing. Safe from any task;
+ * NOT safe from an ISR.
+ */
+
+#ifndef LOG_H
+#define LOG_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ==================== LOG LEVELS ====================
+#define LOG_LEVEL_NONE  0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_INFO  3
+#define LOG_LEVEL_DEBUG 4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+// ==================== LOG MACROS ====================
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_E(tag, fmt, ...) logWrite(LOG_LEVEL_ERROR, tag, fmt, ##__VA_ARGS__)
+#else
+#define LOG_E(tag, fmt, ...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_W(tag, fmt, ...) logWrite(LOG_LEVEL_WARN, tag, fmt, ##__VA_ARGS__)
+#else
+#define LOG_W(tag, fmt, ...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_I(tag, fmt, ...) logWrite(LOG_LEVEL_INFO, tag, fmt, ##__VA_ARGS__)
+#else
+#define LOG_I(tag, fmt, ...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_D(tag, fmt, ...) logWrite(LOG_LEVEL_DEBUG, tag, fmt, ##__VA_ARGS__)
+#else
+#define LOG_D(tag, fmt, ...) do {} while (0)
+#endif
+
+// ==================== FUNCTIONS ====================
+void logWrite(uint8_t level, const char* tag, const char* fmt, ...) __attribute__((format(printf, 3, 4)));
+void logDrain();                        // Push pending text to Serial without blocking
+size_t logCopyHistory(char* out, size_t outSize);  // Most recent complete lines, NUL-terminated
+uint32_t logDroppedBytes();             // Bytes overwritten before reaching Serial
+
+#endif // LOG_H
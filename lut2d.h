@@ -0,0 +1,225 @@
+/*
+ * lut2d.h - Fixed-Point 2-D Lookup Engine
+ *
+ * Bilinear interpolation over the calibration grids (power, ERG, SIM).
+ * The ESP32-C6 has no FPU, so everything the hot path needs - segment
+ * index, reciprocal axis spacing and per-cell slopes - is precomputed in
+ * fixed point whenever a table is built or edited. A lookup is then a
+ * bucket index plus a handful of integer multiplies: no float/double math
+ * and no axis scan.
+ */
+
+#ifndef LUT2D_H
+#define LUT2D_H
+
+#include <Arduino.h>
+
+// ==================== FIXED POINT ====================
+// Q16.16: +/-32767 range, 1/65536 resolution (covers mph, watts, positions, grade)
+typedef int32_t q16_t;
+static constexpr int LUT_Q = 16;
+static constexpr q16_t LUT_ONE = (q16_t)1 << LUT_Q;
+
+// Reciprocals are kept with extra precision: t = (x - x1) * inv >> LUT_INV_SHIFT
+static constexpr int LUT_INV_SHIFT = 24;
+
+static inline q16_t lutToQ16(float v) {
+  if (v >= 32767.0f) return (q16_t)32767 * LUT_ONE;
+  if (v <= -32767.0f) return -(q16_t)32767 * LUT_ONE;
+  return (q16_t)(v * (float)LUT_ONE + (v >= 0.0f ? 0.5f : -0.5f));
+}
+
+static inline q16_t lutToQ16(double v) {
+  return lutToQ16((float)v);
+}
+
+static inline float lutFromQ16(q16_t v) {
+  return (float)v * (1.0f / (float)LUT_ONE);
+}
+
+// ==================== AXIS ====================
+// Non-uniform breakpoints with an O(1) segment finder: a uniform bucket grid
+// maps x to the first segment that can contain it. Buckets are narrower than
+// the smallest breakpoint spacing on all shipped axes, so at most one
+// correction step is needed.
+template <int N>
+class LutAxis {
+ public:
+  static constexpr int BUCKETS = 64;
+
+  void build(const double* values) {
+    for (int i = 0; i < N; i++) {
+      pt_[i] = lutToQ16(values[i]);
+    }
+    for (int i = 0; i < N - 1; i++) {
+      int64_t dx = (int64_t)pt_[i + 1] - pt_[i];
+      inv_[i] = (dx > 0) ? (int64_t)((((int64_t)1 << (LUT_Q + LUT_INV_SHIFT)) + dx / 2) / dx) : 0;
+    }
+
+    int64_t span = (int64_t)pt_[N - 1] - pt_[0];
+    bucketInv_ = (span > 0) ? (int64_t)((((int64_t)BUCKETS << (LUT_Q + LUT_INV_SHIFT)) + span / 2) / span) : 0;
+
+    int seg = 0;
+    for (int b = 0; b < BUCKETS; b++) {
+      q16_t start = (q16_t)(pt_[0] + (span * b) / BUCKETS);
+      while (seg < N - 2 && start >= pt_[seg + 1]) seg++;
+      bucket_[b] = (uint8_t)seg;
+    }
+  }
+
+  inline q16_t minQ() const { return pt_[0]; }
+  inline q16_t maxQ() const { return pt_[N - 1]; }
+  inline bool inRange(q16_t x) const { return x >= pt_[0] && x <= pt_[N - 1]; }
+
+  inline q16_t clamp(q16_t x) const {
+    if (x < pt_[0]) return pt_[0];
+    if (x > pt_[N - 1]) return pt_[N - 1];
+    return x;
+  }
+
+  // Segment i (0..N-2) with pt[i] <= x <= pt[i+1]; *t = fraction in Q16
+  inline int locate(q16_t x, q16_t* t) const {
+    int b = (int)((((int64_t)x - pt_[0]) * bucketInv_) >> (LUT_Q + LUT_INV_SHIFT));
+    if (b < 0) b = 0;
+    if (b >= BUCKETS) b = BUCKETS - 1;
+
+    int seg = bucket_[b];
+    while (seg < N - 2 && x >= pt_[seg + 1]) seg++;
+    while (seg > 0 && x < pt_[seg]) seg--;       // Bucket edge rounding
+
+    *t = (q16_t)((((int64_t)x - pt_[seg]) * inv_[seg]) >> LUT_INV_SHIFT);
+    return seg;
+  }
+
+ private:
+  q16_t pt_[N];
+  int64_t inv_[N - 1];        // 1/(pt[i+1]-pt[i]) scaled by 2^(16+24)
+  int64_t bucketInv_;         // BUCKETS/span scaled by 2^(16+24)
+  uint8_t bucket_[BUCKETS];
+};
+
+// ==================== TABLE ====================
+// table[row][col] indexed by (x = row axis, y = column axis)
+template <int ROWS, int COLS>
+class Lut2D {
+ public:
+  void build(const double* xAxis, const double* yAxis, const double table[][COLS]) {
+    x_.build(xAxis);
+    y_.build(yAxis);
+    for (int i = 0; i < ROWS - 1; i++) {
+      for (int j = 0; j < COLS - 1; j++) {
+        buildCell(table, i, j);
+      }
+    }
+  }
+
+  // Re-derive only the (up to 4) cells that share grid point (row, col)
+  void updatePoint(const double table[][COLS], int row, int col) {
+    for (int i = row - 1; i <= row; i++) {
+      for (int j = col - 1; j <= col; j++) {
+        if (i >= 0 && i < ROWS - 1 && j >= 0 && j < COLS - 1) {
+          buildCell(table, i, j);
+        }
+      }
+    }
+  }
+
+  inline const LutAxis<ROWS>& xAxis() const { return x_; }
+  inline const LutAxis<COLS>& yAxis() const { return y_; }
+
+  // Inputs are clamped to the grid; result in Q16
+  inline q16_t lookupQ16(q16_t x, q16_t y) const {
+    q16_t tx, ty;
+    const int i = x_.locate(x_.clamp(x), &tx);
+    const int j = y_.locate(y_.clamp(y), &ty);
+    const Cell& c = cell_[i][j];
+
+    // f = f11 + a*tx + (b + c*tx)*ty
+    const int64_t alongY = (int64_t)c.b + (((int64_t)c.c * tx) >> LUT_Q);
+    return (q16_t)(c.f11 + (((int64_t)c.a * tx) >> LUT_Q) + ((alongY * ty) >> LUT_Q));
+  }
+
+ private:
+  struct Cell {
+    q16_t f11;   // Value at (x1, y1)
+    q16_t a;     // f21 - f11 (change across x)
+    q16_t b;     // f12 - f11 (change across y)
+    q16_t c;     // f22 - f21 - f12 + f11 (twist)
+  };
+
+  void buildCell(const double table[][COLS], int i, int j) {
+    const q16_t f11 = lutToQ16(table[i][j]);
+    const q16_t f12 = lutToQ16(table[i][j + 1]);
+    const q16_t f21 = lutToQ16(table[i + 1][j]);
+    const q16_t f22 = lutToQ16(table[i + 1][j + 1]);
+    Cell& c = cell_[i][j];
+    c.f11 = f11;
+    c.a = f21 - f11;
+    c.b = f12 - f11;
+    c.c = f22 - f21 - f12 + f11;
+  }
+
+  LutAxis<ROWS> x_;
+  LutAxis<COLS> y_;
+  Cell cell_[ROWS - 1][COLS - 1];
+};
+
+// ==================== UNIFORM GRID ====================
+// Dense table on evenly spaced axes (x0 + i*dx, y0 + j*dy) for values derived
+// on the device, such as the ERG inverse of the power table. The cell comes
+// straight from one multiply per axis: no breakpoint search. Values are
+// stored as int16 in 1/16 units (|v| < 2048, enough for positions), which keeps
+// a dense grid small.
+template <int NX, int NY>
+class LutGrid {
+ public:
+  static constexpr int FRAC = 4;
+
+  void setAxes(float x0, float dx, float y0, float dy) {
+    x0_ = lutToQ16(x0);
+    y0_ = lutToQ16(y0);
+    dx_ = dx;
+    dy_ = dy;
+    xInv_ = (int64_t)((((int64_t)1 << (LUT_Q + LUT_INV_SHIFT)) + lutToQ16(dx) / 2) / lutToQ16(dx));
+    yInv_ = (int64_t)((((int64_t)1 << (LUT_Q + LUT_INV_SHIFT)) + lutToQ16(dy) / 2) / lutToQ16(dy));
+  }
+
+  inline float xAt(int i) const { return lutFromQ16(x0_) + dx_ * i; }
+  inline float yAt(int j) const { return lutFromQ16(y0_) + dy_ * j; }
+
+  inline void set(int i, int j, float v) {
+    v_[i][j] = (int16_t)lroundf(constrain(v, -2047.0f, 2047.0f) * (1 << FRAC));
+  }
+
+  // Inputs are clamped to the grid; result in Q16
+  inline q16_t lookupQ16(q16_t x, q16_t y) const {
+    int i, j;
+    q16_t tx, ty;
+    index(x, x0_, xInv_, NX, &i, &tx);
+    index(y, y0_, yInv_, NY, &j, &ty);
+
+    const int32_t f11 = v_[i][j], f12 = v_[i][j + 1];
+    const int32_t f21 = v_[i + 1][j], f22 = v_[i + 1][j + 1];
+    const int64_t a = f11 + (((int64_t)(f21 - f11) * tx) >> LUT_Q);
+    const int64_t b = f12 + (((int64_t)(f22 - f12) * tx) >> LUT_Q);
+    return (q16_t)((a + (((b - a) * ty) >> LUT_Q)) << (LUT_Q - FRAC));
+  }
+
+ private:
+  static inline void index(q16_t v, q16_t v0, int64_t inv, int n, int* cell, q16_t* t) {
+    int64_t pos = (((int64_t)v - v0) * inv) >> LUT_INV_SHIFT;   // Grid index in Q16
+    if (pos < 0) pos = 0;
+    if (pos > (int64_t)(n - 1) << LUT_Q) pos = (int64_t)(n - 1) << LUT_Q;
+    int c = (int)(pos >> LUT_Q);
+    if (c > n - 2) c = n - 2;
+    *cell = c;
+    *t = (q16_t)(pos - ((int64_t)c << LUT_Q));
+  }
+
+  q16_t x0_ = 0, y0_ = 0;
+  float dx_ = 1.0f, dy_ = 1.0f;
+  int64_t xInv_ = 0, yInv_ = 0;
+  int16_t v_[NX][NY];
+};
+
+#endif // LUT2D_H
@@ -0,0 +1,265 @@
+/*
+ * ota_stream.cpp - OTA Image Stream Implementation
+ */
+
+#include "ota_stream.h"
+#include "log.h"
+#include <rom/miniz.h>     // tinfl in ROM (no flash cost)
+#include <esp_rom_crc.h>
+
+// ==================== STREAM STATE ====================
+// tinfl needs the whole 32 KB deflate window as its output buffer when it
+// wraps; each time the window fills it goes to the writer in one piece.
+static constexpr size_t OTA_WINDOW_SIZE = TINFL_LZ_DICT_SIZE;
+
+// gzip header (RFC 1952)
+static constexpr uint8_t GZ_ID1 = 0x1F;
+static constexpr uint8_t GZ_ID2 = 0x8B;
+static constexpr uint8_t GZ_CM_DEFLATE = 8;
+static constexpr uint8_t GZ_FHCRC = 0x02;
+static constexpr uint8_t GZ_FEXTRA = 0x04;
+static constexpr uint8_t GZ_FNAME = 0x08;
+static constexpr uint8_t GZ_FCOMMENT = 0x10;
+static constexpr size_t GZ_FIXED_HEADER = 10;
+static constexpr size_t GZ_TRAILER = 8;       // CRC-32, ISIZE (both little-endian)
+
+enum OtaStreamState : uint8_t {
+  OS_DETECT = 0,   // First byte decides plain vs. gzip
+  OS_RAW,          // Plain image: straight to the writer
+  OS_HEADER,       // gzip header, byte by byte
+  OS_DEFLATE,      // Inflating
+  OS_TRAILER,      // Deflate stream done; only the trailer is left
+  OS_FAILED
+};
+
+static OtaStreamState gState = OS_DETECT;
+static OtaWriteFn gWrite = NULL;
+static void* gWriteCtx = NULL;
+static const char* gError = NULL;
+static OtaStreamStats gStats = {};
+
+static tinfl_decompressor* gInflator = NULL;
+static uint8_t* gWindow = NULL;
+static size_t gWinPos = 0;
+static uint32_t gCrc = 0;
+
+// Header parse
+static uint8_t gHdr[GZ_FIXED_HEADER];
+static uint32_t gHdrPos = 0;      // Bytes of the current header field seen
+static uint8_t gHdrFlags = 0;
+static uint8_t gHdrField = 0;     // Optional field being skipped (GZ_F*), 0 = fixed part
+static uint32_t gHdrSkip = 0;     // FEXTRA: bytes left (after the 2-byte length)
+
+// Last GZ_TRAILER bytes received: the trailer is the end of the file, however
+// much input tinfl read ahead
+static uint8_t gTail[GZ_TRAILER];
+static uint32_t gTailLen = 0;
+
+// ==================== HELPERS ====================
+
+static bool streamFail(const char* why) {
+  gState = OS_FAILED;
+  if (!gError) gError = why;
+  LOG_W("OTA", "Stream failed: %s", why);
+  return false;
+}
+
+static void freeWindow() {
+  free(gWindow);
+  free(gInflator);
+  gWindow = NULL;
+  gInflator = NULL;
+}
+
+static bool writeOut(const uint8_t* data, size_t len) {
+  if (len == 0) return true;
+  const uint32_t start = micros();
+  const bool ok = gWrite(data, len, gWriteCtx);
+  gStats.writeUs += micros() - start;
+  if (!ok) return streamFail("flash write failed");
+  gStats.outBytes += len;
+  return true;
+}
+
+static bool flushWindow() {
+  gCrc = esp_rom_crc32_le(gCrc, gWindow, gWinPos);
+  const bool ok = writeOut(gWindow, gWinPos);
+  gWinPos = 0;
+  return ok;
+}
+
+static void keepTail(const uint8_t* data, size_t len) {
+  if (len >= GZ_TRAILER) {
+    memcpy(gTail, data + len - GZ_TRAILER, GZ_TRAILER);
+    gTailLen = GZ_TRAILER;
+    return;
+  }
+  const size_t keep = min((size_t)gTailLen, GZ_TRAILER - len);
+  memmove(gTail, gTail + gTailLen - keep, keep);
+  memcpy(gTail + keep, data, len);
+  gTailLen = keep + len;
+}
+
+static inline uint32_t rdLe32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// One gzip header byte; switches to OS_DEFLATE after the last one
+static bool headerByte(uint8_t b) {
+  if (gHdrField == 0) {
+    gHdr[gHdrPos++] = b;
+    if (gHdrPos < GZ_FIXED_HEADER) return true;
+    if (gHdr[0] != GZ_ID1 || gHdr[1] != GZ_ID2) return streamFail("not a gzip or firmware image");
+    if (gHdr[2] != GZ_CM_DEFLATE) return streamFail("gzip method is not deflate");
+    gHdrFlags = gHdr[3];
+    gHdrPos = 0;
+  } else if (gHdrField == GZ_FEXTRA) {
+    if (gHdrPos < 2) {
+      gHdrSkip |= (uint32_t)b << (8 * gHdrPos++);
+      if (gHdrPos < 2 || gHdrSkip > 0) return true;
+    } else if (--gHdrSkip > 0) {
+      return true;
+    }
+    gHdrFlags &= ~GZ_FEXTRA;
+  } else if (gHdrField == GZ_FHCRC) {
+    if (++gHdrPos < 2) return true;
+    gHdrFlags &= ~GZ_FHCRC;
+  } else {
+    if (b != 0) return true;              // FNAME / FCOMMENT: zero-terminated
+    gHdrFlags &= ~gHdrField;
+  }
+
+  // Next optional field, in the order RFC 1952 puts them
+  gHdrPos = 0;
+  gHdrSkip = 0;
+  gHdrField = (gHdrFlags & GZ_FEXTRA) ? GZ_FEXTRA :
+              (gHdrFlags & GZ_FNAME) ? GZ_FNAME :
+              (gHdrFlags & GZ_FCOMMENT) ? GZ_FCOMMENT :
+              (gHdrFlags & GZ_FHCRC) ? GZ_FHCRC : 0;
+  if (gHdrField == 0) gState = OS_DEFLATE;
+  return true;
+}
+
+static bool inflateFeed(const uint8_t* in, size_t len) {
+  tinfl_status status;
+  do {
+    size_t inBytes = len;
+    size_t outBytes = OTA_WINDOW_SIZE - gWinPos;
+    const uint32_t start = micros();
+    status = tinfl_decompress(gInflator, in, &inBytes, gWindow, gWindow + gWinPos, &outBytes,
+                              TINFL_FLAG_HAS_MORE_INPUT);
+    gStats.inflateUs += micros() - start;
+    in += inBytes;
+    len -= inBytes;
+    gWinPos += outBytes;
+
+    if (status < TINFL_STATUS_DONE) return streamFail("corrupt compressed data");
+    if (gWinPos == OTA_WINDOW_SIZE || status == TINFL_STATUS_DONE) {
+      if (!flushWindow()) return false;
+    }
+    if (status == TINFL_STATUS_DONE) {
+      gState = OS_TRAILER;   // Anything after the deflate stream is the trailer
+      return true;
+    }
+  } while (len > 0 || status == TINFL_STATUS_HAS_MORE_OUTPUT);
+  return true;
+}
+
+// ==================== PUBLIC FUNCTIONS ====================
+
+void otaStreamBegin(OtaWriteFn write, void* ctx) {
+  freeWindow();
+  gState = OS_DETECT;
+  gWrite = write;
+  gWriteCtx = ctx;
+  gError = NULL;
+  gWinPos = 0;
+  gCrc = 0;
+  gHdrPos = gHdrSkip = 0;
+  gHdrFlags = gHdrField = 0;
+  gTailLen = 0;
+
+  gStats = OtaStreamStats();
+  gStats.active = true;
+  gStats.startMs = gStats.lastMs = millis();
+}
+
+bool otaStreamFeed(const uint8_t* data, size_t len) {
+  if (gState == OS_FAILED) return false;
+  if (len == 0) return true;
+  gStats.inBytes += len;
+  gStats.lastMs = millis();
+  keepTail(data, len);
+
+  if (gState == OS_DETECT) {
+    if (data[0] != GZ_ID1) {
+      gState = OS_RAW;
+    } else {
+      gWindow = (uint8_t*)malloc(OTA_WINDOW_SIZE);
+      gInflator = (tinfl_decompressor*)malloc(sizeof(tinfl_decompressor));
+      if (!gWindow || !gInflator) {
+        freeWindow();
+        return streamFail("no memory for the inflate window");
+      }
+      tinfl_init(gInflator);
+      gStats.gzip = true;
+      gState = OS_HEADER;
+      LOG_I("OTA", "gzip image, inflating in a %u byte window", (unsigned)OTA_WINDOW_SIZE);
+    }
+  }
+
+  if (gState == OS_RAW) return writeOut(data, len);
+
+  while (len > 0 && gState == OS_HEADER) {
+    if (!headerByte(*data)) return false;
+    data++;
+    len--;
+  }
+  if (gState == OS_DEFLATE && len > 0) return inflateFeed(data, len);
+  return gState != OS_FAILED;
+}
+
+bool otaStreamEnd() {
+  gStats.active = false;
+  gStats.lastMs = millis();
+  bool ok = gState != OS_FAILED;
+
+  if (ok && gState == OS_DETECT) {
+    ok = streamFail("empty upload");
+  } else if (ok && gStats.gzip) {
+    if (gState != OS_TRAILER || gTailLen < GZ_TRAILER) {
+      ok = streamFail("compressed image truncated");
+    } else if (rdLe32(gTail) != gCrc) {
+      ok = streamFail("gzip CRC mismatch");
+    } else if (rdLe32(gTail + 4) != gStats.outBytes) {
+      ok = streamFail("gzip length mismatch");
+    }
+  }
+  freeWindow();
+
+  if (ok) {
+    const uint32_t ms = max(gStats.lastMs - gStats.startMs, (uint32_t)1);
+    LOG_I("OTA", "Stream done: %lu bytes in, %lu bytes out, %lu ms (%lu kB/s), inflate %lu ms, flash %lu ms",
+          (unsigned long)gStats.inBytes, (unsigned long)gStats.outBytes, (unsigned long)ms,
+          (unsigned long)(gStats.inBytes / ms), (unsigned long)(gStats.inflateUs / 1000),
+          (unsigned long)(gStats.writeUs / 1000));
+  }
+  return ok;
+}
+
+void otaStreamAbort() {
+  if (gStats.active) {
+    gStats.active = false;
+    gStats.lastMs = millis();
+    if (gState != OS_FAILED) streamFail("upload aborted");
+  }
+  freeWindow();
+}
+
+const char* otaStreamError() {
+  return gError;
+}
+
+void otaStreamGetStats(OtaStreamStats* out) {
+  *out = gStats;
+}
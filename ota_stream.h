@@ -0,0 +1,39 @@
+/*
+ * ota_stream.h - OTA Image Stream (plain or gzip-compressed)
+ *
+ * Sits between the HTTP upload and the flash writer. A plain .bin goes
+ * through unchanged. A gzip file (1f 8b) is inflated as it arrives with the
+ * ROM's tinfl, into a fixed 32 KB window that doubles as the output buffer,
+ * so any image size costs the same RAM (window + decompressor, about 43 KB,
+ * allocated only for the upload). The gzip trailer (CRC-32 and length of the
+ * image) is checked at the end, before the image is accepted.
+ */
+
+#ifndef OTA_STREAM_H
+#define OTA_STREAM_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Receives the image in order; returns false to stop the upload
+typedef bool (*OtaWriteFn)(const uint8_t* data, size_t len, void* ctx);
+
+struct OtaStreamStats {
+  bool active;
+  bool gzip;
+  uint32_t inBytes;       // Received (compressed size for gzip)
+  uint32_t outBytes;      // Handed to the writer (image size)
+  uint32_t startMs;
+  uint32_t lastMs;        // Last data, or the end of the upload
+  uint32_t inflateUs;     // Time spent in tinfl
+  uint32_t writeUs;       // Time spent in the writer (flash)
+};
+
+void otaStreamBegin(OtaWriteFn write, void* ctx);
+bool otaStreamFeed(const uint8_t* data, size_t len);   // False: stop (see otaStreamError)
+bool otaStreamEnd();     // Flush and check the gzip trailer; false on any error
+void otaStreamAbort();   // Frees the window; the writer must be aborted by the caller
+const char* otaStreamError();   // Why the last stream failed (NULL if it did not)
+void otaStreamGetStats(OtaStreamStats* out);
+
+#endif // OTA_STREAM_H
@@ -0,0 +1,149 @@
+/*
+ * perf.cpp - Loop Profiler Implementation
+ */
+
+#include "perf.h"
+
+// ==================== STATE ====================
+static PerfStats gSections[PERF_SECTION_COUNT];
+static PerfStats gLoopPeriod;
+static uint32_t gSectionWindowMax[PERF_SECTION_COUNT];
+static uint32_t gLoopWindowMax = 0;
+static PerfStats gControlPeriod;
+static uint32_t gControlWindowMax = 0;
+static uint32_t gLastControlUs = 0;
+
+static uint32_t gCyclesPerUs = 160;
+static uint32_t gLastLoopUs = 0;
+static uint32_t gLastServiceMs = 0;
+static volatile bool gPaused = false;      // Idle power mode: lower clock, sleeping loop()
+
+static uint32_t gHeapFree = 0;
+static uint32_t gHeapMinFree = UINT32_MAX;
+static uint32_t gHeapLargest = 0;
+static uint32_t gHeapMinLargest = UINT32_MAX;
+
+static const char* const SECTION_NAMES[PERF_SECTION_COUNT] = {
+  "web", "led", "stepper", "sensors", "target", "ble_notify", "ble_adv", "log", "recorder"
+};
+
+// ==================== HELPERS ====================
+
+static inline uint8_t histBucket(uint32_t us) {
+  uint8_t b = 0;
+  while (b < PERF_HIST_BUCKETS - 1 && us >= PERF_HIST_EDGES_US[b]) b++;
+  return b;
+}
+
+static void statsClear(PerfStats& s) {
+  memset(&s, 0, sizeof(s));
+  s.min = UINT32_MAX;
+}
+
+static inline void statsAdd(PerfStats& s, uint32_t value, uint32_t us, uint32_t& windowMax) {
+  s.count++;
+  s.sum += value;
+  if (value < s.min) s.min = value;
+  if (value > s.max) s.max = value;
+  if (value > windowMax) windowMax = value;
+  s.hist[histBucket(us)]++;
+}
+
+// ==================== PUBLIC FUNCTIONS ====================
+
+#if ENABLE_PERF
+PerfScope::~PerfScope() {
+  const uint32_t cycles = ESP.getCycleCount() - start;
+  if (gPaused) return;
+  statsAdd(gSections[section], cycles, cycles / gCyclesPerUs, gSectionWindowMax[section]);
+}
+#endif
+
+void perfInit() {
+  gCyclesPerUs = ESP.getCpuFreqMHz();
+  if (gCyclesPerUs == 0) gCyclesPerUs = 160;
+  perfReset();
+}
+
+// Cycle counts at the idle clock and idle loop() sleeps would skew the stats
+void perfPause(bool paused) {
+  gPaused = paused;
+}
+
+void perfReset() {
+  for (int i = 0; i < PERF_SECTION_COUNT; i++) {
+    statsClear(gSections[i]);
+    gSectionWindowMax[i] = 0;
+  }
+  statsClear(gLoopPeriod);
+  gLoopWindowMax = 0;
+  gLastLoopUs = 0;
+  statsClear(gControlPeriod);
+  gControlWindowMax = 0;
+  gLastControlUs = 0;
+  gHeapMinFree = UINT32_MAX;
+  gHeapMinLargest = UINT32_MAX;
+}
+
+void perfLoopMark() {
+#if ENABLE_PERF
+  const uint32_t now = micros();
+  if (gPaused) {
+    gLastLoopUs = 0;
+    return;
+  }
+  if (gLastLoopUs != 0) {
+    const uint32_t period = now - gLastLoopUs;
+    statsAdd(gLoopPeriod, period, period, gLoopWindowMax);
+  }
+  gLastLoopUs = now;
+#endif
+}
+
+void perfControlMark() {
+#if ENABLE_PERF
+  const uint32_t now = micros();
+  if (gLastControlUs != 0) {
+    const uint32_t period = now - gLastControlUs;
+    statsAdd(gControlPeriod, period, period, gControlWindowMax);
+  }
+  gLastControlUs = now;
+#endif
+}
+
+void perfService() {
+  if (millis() - gLastServiceMs < 1000) return;
+  gLastServiceMs = millis();
+
+  // Close the 1 s windows
+  for (int i = 0; i < PERF_SECTION_COUNT; i++) {
+    gSections[i].windowMax = gSectionWindowMax[i];
+    gSectionWindowMax[i] = 0;
+  }
+  gLoopPeriod.windowMax = gLoopWindowMax;
+  gLoopWindowMax = 0;
+  gControlPeriod.windowMax = gControlWindowMax;
+  gControlWindowMax = 0;
+
+  gHeapFree = ESP.getFreeHeap();
+  gHeapLargest = ESP.getMaxAllocHeap();
+  if (gHeapFree < gHeapMinFree) gHeapMinFree = gHeapFree;
+  if (gHeapLargest < gHeapMinLargest) gHeapMinLargest = gHeapLargest;
+}
+
+const char* perfSectionName(uint8_t section) {
+  return (section < PERF_SECTION_COUNT) ? SECTION_NAMES[section] : "?";
+}
+
+const PerfStats& perfSection(uint8_t section) {
+  return gSections[section < PERF_SECTION_COUNT ? section : 0];
+}
+
+const PerfStats& perfLoopPeriod() { return gLoopPeriod; }
+const PerfStats& perfControlPeriod() { return gControlPeriod; }
+uint32_t perfCyclesPerUs() { return gCyclesPerUs; }
+
+uint32_t perfHeapFree() { return gHeapFree; }
+uint32_t perfHeapMinFree() { return gHeapMinFree == UINT32_MAX ? 0 : gHeapMinFree; }
+uint32_t perfHeapLargest() { return gHeapLargest; }
+uint32_t perfHeapMinLargest() { return gHeapMinLargest == UINT32_MAX ? 0 : gHeapMinLargest; }
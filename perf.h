@@ -0,0 +1,76 @@
+/*
+ * perf.h - Loop Profiler
+ *
+ * Per-section cycle-counter timing (min/avg/max + histogram), loop and
+ * control task period jitter, worst step-pulse gap and heap watermarks. Cost per section is two
+ * cycle-counter reads and a few adds, so it stays compiled in on production
+ * units. Reported at /perf.json and (summary) in the diag WebSocket.
+ */
+
+#ifndef PERF_H
+#define PERF_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ==================== SECTIONS ====================
+enum PerfSection : uint8_t {
+  PERF_WEB = 0,
+  PERF_LED,
+  PERF_STEPPER,
+  PERF_SENSORS,
+  PERF_TARGET,
+  PERF_BLE_NOTIFY,
+  PERF_BLE_ADV,
+  PERF_LOG,
+  PERF_RECORDER,
+  PERF_SECTION_COUNT
+};
+
+// Histogram bucket upper bounds in us (last bucket is open-ended)
+static constexpr int PERF_HIST_BUCKETS = 8;
+static const uint32_t PERF_HIST_EDGES_US[PERF_HIST_BUCKETS - 1] = {10, 30, 100, 300, 1000, 3000, 10000};
+
+struct PerfStats {
+  uint32_t count;
+  uint64_t sum;        // Cycles (sections) or us (loop period)
+  uint32_t min;
+  uint32_t max;
+  uint32_t windowMax;  // Max over the last complete 1 s window
+  uint32_t hist[PERF_HIST_BUCKETS];
+};
+
+// ==================== SCOPED TIMER ====================
+#if ENABLE_PERF
+struct PerfScope {
+  explicit PerfScope(PerfSection s) : section(s), start(ESP.getCycleCount()) {}
+  ~PerfScope();
+  PerfSection section;
+  uint32_t start;
+};
+#define PERF_SCOPE(section) PerfScope _perfScope(section)
+#else
+#define PERF_SCOPE(section) do {} while (0)
+#endif
+
+// ==================== FUNCTIONS ====================
+void perfInit();
+void perfLoopMark();            // Call once at the top of loop()
+void perfControlMark();         // Call once per control task tick
+void perfService();             // 1 Hz housekeeping (heap sampling, windows)
+void perfReset();
+void perfPause(bool paused);    // Idle power mode: stop sampling sections and loop period
+
+const char* perfSectionName(uint8_t section);
+const PerfStats& perfSection(uint8_t section);
+const PerfStats& perfLoopPeriod();
+const PerfStats& perfControlPeriod();
+uint32_t perfCyclesPerUs();
+
+// Heap watermarks (bytes)
+uint32_t perfHeapFree();
+uint32_t perfHeapMinFree();
+uint32_t perfHeapLargest();
+uint32_t perfHeapMinLargest();
+
+#endif // PERF_H
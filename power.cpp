@@ -0,0 +1,171 @@
+/*
+ * power.cpp - Idle Power Management Implementation
+ */
+
+#include "power.h"
+#include "sensors.h"
+#include "stepper_control.h"
+#include "ble_trainer.h"
+#include "replay.h"
+#include "sweep.h"
+#include "perf.h"
+#include "log.h"
+#include <WiFi.h>
+
+// ==================== POWER STATE ====================
+volatile bool gPowerIdle = false;
+
+static TaskHandle_t gLoopTask = NULL;        // Woken by powerActivity()/the Hall ISR
+static uint32_t gActiveMhz = 0;              // Clock to return to (what the core booted with)
+static volatile PowerWake gWakePending = POWER_WAKE_NONE;
+static volatile uint32_t gWakeIsrUs = 0;     // micros() of the Hall edge that woke us
+
+static volatile uint32_t gLastUseMs = 0;     // Last activity of any kind
+static uint32_t gLastEdges = 0;
+static uint32_t gStateSinceMs = 0;
+static uint32_t gIdleMs = 0;                 // Closed periods only
+static uint32_t gActiveMs = 0;
+static uint32_t gIdleEntries = 0;
+static PowerWake gLastWake = POWER_WAKE_NONE;
+static uint32_t gLastWakeUs = 0;
+
+// ==================== HELPERS ====================
+
+static float idleMa() {
+  return (WiFi.getMode() & WIFI_MODE_STA) ? POWER_EST_IDLE_STA_MA : POWER_EST_IDLE_AP_MA;
+}
+
+// Something that rules out idle right now (checked every loop() pass)
+static PowerWake powerBusy() {
+  const uint32_t edges = hallEdgeCount();
+  if (edges != gLastEdges) {
+    gLastEdges = edges;
+    return POWER_WAKE_HALL;
+  }
+  if (deviceConnected) return POWER_WAKE_BLE;
+  if (gStepEn || gIsHoming) return POWER_WAKE_MOTOR;
+  if (replayActive() || sweepActive()) return POWER_WAKE_BUSY;
+  return POWER_WAKE_NONE;
+}
+
+static void enterIdle(uint32_t now) {
+  perfPause(true);
+  setCpuFrequencyMhz(POWER_IDLE_CPU_MHZ);
+  WiFi.setSleep(WIFI_PS_MAX_MODEM);    // Client mode only; AP mode keeps the radio on
+
+  gActiveMs += now - gStateSinceMs;
+  gStateSinceMs = now;
+  gIdleEntries++;
+  gWakePending = POWER_WAKE_NONE;
+  gPowerIdle = true;
+  LOG_I("POWER", "Idle: CPU %lu MHz, WiFi max modem sleep", (unsigned long)getCpuFrequencyMhz());
+}
+
+static void exitIdle(PowerWake why, uint32_t now) {
+  setCpuFrequencyMhz(gActiveMhz);
+  gPowerIdle = false;
+  if (why == POWER_WAKE_HALL && gWakeIsrUs != 0) gLastWakeUs = micros() - gWakeIsrUs;
+  WiFi.setSleep(WIFI_PS_MIN_MODEM);
+  perfPause(false);
+
+  gIdleMs += now - gStateSinceMs;
+  gStateSinceMs = now;
+  gLastWake = why;
+  gWakePending = POWER_WAKE_NONE;
+  gWakeIsrUs = 0;
+  LOG_I("POWER", "Awake (%s): CPU %lu MHz", powerWakeName(why), (unsigned long)getCpuFrequencyMhz());
+}
+
+// ==================== PUBLIC FUNCTIONS ====================
+
+void powerInit() {
+  gLoopTask = xTaskGetCurrentTaskHandle();
+  gActiveMhz = getCpuFrequencyMhz();
+  gPowerIdle = false;
+  gWakePending = POWER_WAKE_NONE;
+  gWakeIsrUs = 0;
+  gLastEdges = hallEdgeCount();
+  gLastUseMs = gStateSinceMs = millis();
+  gIdleMs = gActiveMs = gIdleEntries = gLastWakeUs = 0;
+  gLastWake = POWER_WAKE_NONE;
+  Serial.printf("✓ Power management (idle after %lu s at %lu MHz, active %lu MHz)\n",
+                (unsigned long)(POWER_IDLE_AFTER_MS / 1000), (unsigned long)POWER_IDLE_CPU_MHZ,
+                (unsigned long)gActiveMhz);
+}
+
+void powerService() {
+  const uint32_t now = millis();
+  const PowerWake busy = powerBusy();
+  if (busy != POWER_WAKE_NONE) gLastUseMs = now;
+
+  if (gPowerIdle) {
+    const PowerWake pending = gWakePending;
+    const PowerWake why = (pending != POWER_WAKE_NONE) ? pending : busy;
+    if (why != POWER_WAKE_NONE) exitIdle(why, now);
+  } else if (now - gLastUseMs >= POWER_IDLE_AFTER_MS) {
+    enterIdle(now);
+  }
+}
+
+void powerLoopWait() {
+  if (!gPowerIdle) {
+    delay(1);
+    return;
+  }
+  // Web polling slows to POWER_IDLE_LOOP_MS; a wake ends the wait early
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(POWER_IDLE_LOOP_MS));
+}
+
+void powerActivity(PowerWake source) {
+  gLastUseMs = millis();
+  if (!gPowerIdle || gWakePending != POWER_WAKE_NONE) return;
+  gWakePending = source;
+  if (gLoopTask != NULL) xTaskNotifyGive(gLoopTask);
+}
+
+void IRAM_ATTR powerWakeFromISR() {
+  if (gWakePending != POWER_WAKE_NONE) return;
+  gWakePending = POWER_WAKE_HALL;
+  gWakeIsrUs = micros();
+  if (gLoopTask == NULL) return;
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR(gLoopTask, &woken);
+  portYIELD_FROM_ISR(woken);
+}
+
+void powerGetStats(PowerStats* out) {
+  const uint32_t now = millis();
+  const uint32_t inState = now - gStateSinceMs;
+  const bool idle = gPowerIdle;
+  const float idleEst = idleMa();
+
+  out->state = idle ? POWER_IDLE : POWER_ACTIVE;
+  out->cpuMhz = getCpuFrequencyMhz();
+  out->idleEntries = gIdleEntries;
+  out->idleMs = gIdleMs + (idle ? inState : 0);
+  out->activeMs = gActiveMs + (idle ? 0 : inState);
+  out->stateMs = inState;
+  out->lastWake = gLastWake;
+  out->lastWakeUs = gLastWakeUs;
+  out->estMa = idle ? idleEst : POWER_EST_ACTIVE_MA;
+
+  const float totalMs = (float)out->idleMs + (float)out->activeMs;
+  out->estAvgMa = totalMs > 0
+      ? ((float)out->activeMs * POWER_EST_ACTIVE_MA + (float)out->idleMs * idleEst) / totalMs
+      : out->estMa;
+}
+
+const char* powerStateName(PowerState state) {
+  return state == POWER_IDLE ? "idle" : "active";
+}
+
+const char* powerWakeName(PowerWake wake) {
+  switch (wake) {
+    case POWER_WAKE_HALL: return "hall";
+    case POWER_WAKE_BLE: return "ble";
+    case POWER_WAKE_WEB: return "web";
+    case POWER_WAKE_MOTOR: return "motor";
+    case POWER_WAKE_BUSY: return "busy";
+    default: return "none";
+  }
+}
@@ -0,0 +1,64 @@
+/*
+ * power.h - Idle Power Management
+ *
+ * The trainer sits powered most of the day with nobody riding. Once the
+ * rollers have been still, the motor disabled and no BLE central, web
+ * client, OTA upload, replay or sweep around for POWER_IDLE_AFTER_MS,
+ * powerService() lowers the CPU clock, moves WiFi (client mode) from
+ * minimum to maximum modem sleep and loop() sleeps on a task notification
+ * instead of spinning every millisecond.
+ *
+ * Any Hall edge (from hallISR()), BLE connection or web request wakes it:
+ * the notification ends powerLoopWait() at once and the full clock is back
+ * before the next loop() pass. All clock and WiFi changes happen in loop().
+ *
+ * There is no current sensor on the board, so the draw reported is a model
+ * (POWER_EST_* in config.h weighted by time in each state).
+ */
+
+#ifndef POWER_H
+#define POWER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+enum PowerState : uint8_t {
+  POWER_ACTIVE = 0,
+  POWER_IDLE
+};
+
+// What ended the last idle period (or keeps the trainer awake)
+enum PowerWake : uint8_t {
+  POWER_WAKE_NONE = 0,
+  POWER_WAKE_HALL,        // Roller turned
+  POWER_WAKE_BLE,         // Central connected
+  POWER_WAKE_WEB,         // HTTP request, WebSocket client or OTA upload
+  POWER_WAKE_MOTOR,       // Stepper enabled or homing
+  POWER_WAKE_BUSY         // Replay or calibration sweep
+};
+
+struct PowerStats {
+  PowerState state;
+  uint32_t cpuMhz;          // Current clock (getCpuFrequencyMhz)
+  uint32_t idleEntries;
+  uint32_t idleMs;          // Total time idle since boot
+  uint32_t activeMs;
+  uint32_t stateMs;         // Time in the current state
+  PowerWake lastWake;
+  uint32_t lastWakeUs;      // Hall edge to full clock, last Hall wake
+  float estMa;              // Modelled draw now
+  float estAvgMa;           // Modelled average since boot
+};
+
+extern volatile bool gPowerIdle;
+
+void powerInit();                       // setup(), from the loop() task
+void powerService();                    // loop(): idle entry/exit
+void powerLoopWait();                   // End of loop(): 1 ms active, until woken idle
+void powerActivity(PowerWake source);   // Any task: counts as use, wakes if idle
+void IRAM_ATTR powerWakeFromISR();      // hallISR()
+void powerGetStats(PowerStats* out);
+const char* powerStateName(PowerState state);
+const char* powerWakeName(PowerWake wake);
+
+#endif // POWER_H
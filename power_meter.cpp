@@ -0,0 +1,143 @@
+/*
+ * power_meter.cpp - BLE Cycling Power Meter Implementation
+ */
+
+#include "power_meter.h"
+#include "ble_backend.h"
+#include "log.h"
+
+// ==================== STATE ====================
+// Written from the BLE host task (notifications) and the meter task,
+// read from loop()
+static MeterInfo gInfo = {};
+static int32_t gWindowSum = 0;
+static uint16_t gWindowCount = 0;
+static portMUX_TYPE gMeterMux = portMUX_INITIALIZER_UNLOCKED;
+
+static uint8_t gRequestPeer[6];
+static bool gRequestAny = true;
+
+// Cycling Power Measurement: flags (uint16), instantaneous power (sint16, W),
+// then optional fields this module does not need
+static constexpr size_t CPM_MIN_LEN = 4;
+
+// ==================== STACK EVENTS ====================
+
+void bleOnMeterFound(const uint8_t* peer, const char* name) {
+  portENTER_CRITICAL(&gMeterMux);
+  memcpy(gInfo.peer, peer, sizeof(gInfo.peer));
+  snprintf(gInfo.name, sizeof(gInfo.name), "%s", name);
+  portEXIT_CRITICAL(&gMeterMux);
+}
+
+void bleOnMeterMeasurement(const uint8_t* data, size_t len) {
+  if (len < CPM_MIN_LEN) return;
+  const int16_t watts = (int16_t)(data[2] | (data[3] << 8));
+  const uint32_t now = millis();
+
+  portENTER_CRITICAL(&gMeterMux);
+  gInfo.watts = watts;
+  gInfo.lastMs = now ? now : 1;
+  gInfo.measurements++;
+  gWindowSum += watts;
+  if (gWindowCount < 0xFFFF) gWindowCount++;
+  portEXIT_CRITICAL(&gMeterMux);
+}
+
+void bleOnMeterDisconnect() {
+  portENTER_CRITICAL(&gMeterMux);
+  const bool wasConnected = (gInfo.state == METER_CONNECTED);
+  if (wasConnected) gInfo.state = METER_IDLE;
+  portEXIT_CRITICAL(&gMeterMux);
+  if (wasConnected) LOG_W("METER", "Power meter disconnected");
+}
+
+// ==================== METER TASK ====================
+
+static void setState(MeterState state) {
+  portENTER_CRITICAL(&gMeterMux);
+  gInfo.state = state;
+  if (state == METER_CONNECTED) gInfo.connects++;
+  portEXIT_CRITICAL(&gMeterMux);
+}
+
+static void meterTask(void* arg) {
+  const bool ok = bleBackendMeterConnect(gRequestAny ? NULL : gRequestPeer, METER_SCAN_MS);
+  setState(ok ? METER_CONNECTED : METER_FAILED);
+  if (ok) LOG_I("METER", "Power meter connected (%s)", gInfo.name[0] ? gInfo.name : "unnamed");
+  vTaskDelete(NULL);
+}
+
+// ==================== PUBLIC FUNCTIONS ====================
+
+bool meterConnect(const uint8_t* peer) {
+  if (gInfo.state == METER_CONNECTING) return false;
+  if (gInfo.state == METER_CONNECTED) {
+    if (peer == NULL || memcmp(peer, gInfo.peer, sizeof(gInfo.peer)) == 0) return true;
+    bleBackendMeterDisconnect();
+  }
+
+  gRequestAny = (peer == NULL);
+  if (peer) memcpy(gRequestPeer, peer, sizeof(gRequestPeer));
+  setState(METER_CONNECTING);
+  LOG_I("METER", "Scanning for a Cycling Power sensor");
+  if (xTaskCreate(meterTask, "meter", METER_TASK_STACK, NULL, 1, NULL) != pdPASS) {
+    setState(METER_FAILED);
+    LOG_E("METER", "Meter task create failed");
+    return false;
+  }
+  return true;
+}
+
+void meterDisconnect() {
+  bleBackendMeterDisconnect();
+  setState(METER_IDLE);
+}
+
+void meterGetInfo(MeterInfo* out) {
+  portENTER_CRITICAL(&gMeterMux);
+  *out = gInfo;
+  portEXIT_CRITICAL(&gMeterMux);
+}
+
+const char* meterStateName(MeterState state) {
+  switch (state) {
+    case METER_CONNECTING: return "connecting";
+    case METER_CONNECTED:  return "connected";
+    case METER_FAILED:     return "failed";
+    default:               return "idle";
+  }
+}
+
+bool meterFresh() {
+  portENTER_CRITICAL(&gMeterMux);
+  const uint32_t last = gInfo.lastMs;
+  portEXIT_CRITICAL(&gMeterMux);
+  return last != 0 && millis() - last < METER_STALE_MS;
+}
+
+bool meterParseAddress(const char* text, uint8_t* peer) {
+  unsigned b[6];
+  if (sscanf(text, "%2x:%2x:%2x:%2x:%2x:%2x", &b[0], &b[1], &b[2], &b[3], &b[4], &b[5]) != 6) return false;
+  for (int i = 0; i < 6; i++) peer[i] = (uint8_t)b[i];
+  return true;
+}
+
+void meterWindowReset() {
+  portENTER_CRITICAL(&gMeterMux);
+  gWindowSum = 0;
+  gWindowCount = 0;
+  portEXIT_CRITICAL(&gMeterMux);
+}
+
+uint16_t meterWindowTake(float* avgWatts) {
+  portENTER_CRITICAL(&gMeterMux);
+  const int32_t sum = gWindowSum;
+  const uint16_t count = gWindowCount;
+  gWindowSum = 0;
+  gWindowCount = 0;
+  portEXIT_CRITICAL(&gMeterMux);
+
+  *avgWatts = count ? (float)sum / count : 0.0f;
+  return count;
+}
@@ -0,0 +1,49 @@
+/*
+ * power_meter.h - BLE Cycling Power Meter (Reference for the Sweep)
+ *
+ * Central-role client for a standard Cycling Power Service sensor (pedals,
+ * crank or hub meter). The backend scans, connects and subscribes; this
+ * module parses Cycling Power Measurement (0x2A63) notifications and keeps
+ * the last reading plus a running sum the calibration sweep averages over
+ * its steady windows. The link is opened on demand and is not remembered
+ * across restarts.
+ */
+
+#ifndef POWER_METER_H
+#define POWER_METER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+enum MeterState : uint8_t {
+  METER_IDLE = 0,
+  METER_CONNECTING,     // Scan + connect running in the meter task
+  METER_CONNECTED,
+  METER_FAILED          // Last connect found nothing or failed
+};
+
+struct MeterInfo {
+  MeterState state;
+  uint8_t peer[6];      // MSB first (valid once a sensor was found)
+  char name[24];
+  int16_t watts;        // Last instantaneous power
+  uint32_t lastMs;      // millis() of the last measurement (0 = none yet)
+  uint32_t measurements;
+  uint32_t connects;
+};
+
+// ==================== FUNCTIONS ====================
+// loop() context. peer NULL = first Cycling Power sensor found. false if a
+// connect is already running.
+bool meterConnect(const uint8_t* peer);
+void meterDisconnect();
+void meterGetInfo(MeterInfo* out);
+const char* meterStateName(MeterState state);
+bool meterFresh();                            // A reading within METER_STALE_MS
+bool meterParseAddress(const char* text, uint8_t* peer);   // "AA:BB:CC:DD:EE:FF"
+
+// Averaging: readings since the last reset
+void meterWindowReset();
+uint16_t meterWindowTake(float* avgWatts);    // Count (0 = none); resets the window
+
+#endif // POWER_METER_H
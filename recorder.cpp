@@ -0,0 +1,267 @@
+/*
+ * recorder.cpp - On-Device Ride Recorder Implementation
+ */
+
+#include "recorder.h"
+#include "ble_trainer.h"
+#include "stepper_control.h"
+#include "log.h"
+#include <SPIFFS.h>
+
+// ==================== FILES ====================
+static const char* REC_FILE = RECORDER_FILE;
+static const char* REC_OLD = RECORDER_FILE_OLD;
+
+static bool gMounted = false;
+static uint32_t gFileMax = 0;       // Bytes per file (two files kept)
+static uint32_t gCurBytes = 0;      // Size of REC_FILE (loop only)
+static uint32_t gOldBytes = 0;      // Size of REC_OLD (loop only)
+static uint32_t gWrites = 0;
+static uint32_t gWriteMaxUs = 0;
+static uint32_t gDeferred = 0;      // recorderService() passes that waited for the motor
+
+// ==================== DOUBLE BUFFER ====================
+// The control task fills gBuf[gActive]. A full (or flushed) buffer is handed
+// to loop() by publishing its record count in gPending; the producer only
+// switches to the other buffer once loop() has cleared that buffer's count.
+static RecorderRecord gBuf[2][RECORDER_BUFFER_RECORDS];
+static uint8_t gActive = 0;                     // Producer only
+static uint16_t gFill = 0;                      // Producer only
+static volatile uint16_t gPending[2] = {0, 0};  // Set by producer, cleared by loop
+static volatile bool gFlushRequest = false;     // loop -> producer: hand over a partial buffer
+
+static volatile bool gEnabled = RECORDER_ENABLED_DEFAULT;
+static volatile bool gRecActive = false;
+static volatile uint32_t gRecords = 0;
+static volatile uint32_t gDropped = 0;
+static uint32_t gLastMovingMs = 0;
+
+static bool handOver() {
+  if (gFill == 0) return true;
+  const uint8_t next = gActive ^ 1;
+  if (gPending[next] != 0) return false;  // loop() has not written it yet
+
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  gPending[gActive] = gFill;
+  gActive = next;
+  gFill = 0;
+  return true;
+}
+
+static inline int16_t sat16(float v) {
+  if (v > 32767.0f) return 32767;
+  if (v < -32768.0f) return -32768;
+  return (int16_t)lroundf(v);
+}
+
+// ==================== PUBLIC FUNCTIONS ====================
+
+void recorderFillRecord(const TrainerSnapshot& s, uint32_t hallIntervalUs, RecorderRecord* out) {
+  RecorderRecord& r = *out;
+  r.ms = s.ms;
+  r.hallUs = (uint16_t)min(hallIntervalUs, (uint32_t)0xFFFF);
+  r.speed = (uint16_t)sat16(s.speedMph * 100.0f);
+  r.accel = sat16(s.accelMphS * 100.0f);
+  r.powerW = sat16(s.powerWatts);
+  r.pos = (int16_t)s.logPos;
+  r.target = (int16_t)s.logTarget;
+  r.setpoint = (s.mode == MODE_ERG) ? s.ergTargetWatts :
+               (s.mode == MODE_SIM) ? sat16(s.simGradePercent * 100.0f) : 0;
+  r.mode = (uint8_t)s.mode;
+  r.flags = (s.stepEn ? REC_FLAG_STEP_EN : 0) |
+            (s.manualHold ? REC_FLAG_MANUAL_HOLD : 0) |
+            (s.homing ? REC_FLAG_HOMING : 0) |
+            (deviceConnected ? REC_FLAG_BLE : 0);
+}
+
+void recorderInit() {
+  gMounted = SPIFFS.begin(true);  // Formats an unformatted partition
+  if (!gMounted) {
+    Serial.println("[REC] ERROR: SPIFFS mount failed, recorder disabled");
+    return;
+  }
+
+  const uint32_t total = SPIFFS.totalBytes();
+  gFileMax = (uint32_t)(total * RECORDER_FLASH_SHARE) / 2;
+  gFileMax -= gFileMax % sizeof(RecorderRecord);
+
+  File f = SPIFFS.open(REC_FILE, FILE_READ);
+  if (f) { gCurBytes = f.size(); f.close(); }
+  f = SPIFFS.open(REC_OLD, FILE_READ);
+  if (f) { gOldBytes = f.size(); f.close(); }
+
+  Serial.printf("✓ Recorder ready (SPIFFS %lu bytes, %lu stored, %lu max, ~%lu min at 20 Hz)\n",
+                (unsigned long)total, (unsigned long)(gCurBytes + gOldBytes),
+                (unsigned long)(2 * gFileMax),
+                (unsigned long)(2 * gFileMax / sizeof(RecorderRecord) / 20 / 60));
+}
+
+void recorderSample(const TrainerSnapshot& s, uint32_t hallIntervalUs) {
+  // Settled = at the step the target maps to (not every logical value is one)
+  const bool settled = s.logPos == stepsToLogical(logicalToSteps(s.logTarget));
+  const bool moving = s.speedMph > 0.0f || !settled || s.homing;
+  if (moving) gLastMovingMs = s.ms ? s.ms : 1;
+
+  const bool active = gEnabled && gMounted &&
+                      gLastMovingMs != 0 && s.ms - gLastMovingMs < RECORDER_TAIL_MS;
+  gRecActive = active;
+
+  // Stopped (or asked to flush): give loop() what we have so it reaches flash
+  if (!active || gFlushRequest) {
+    if (handOver()) gFlushRequest = false;
+    if (!active) return;
+  }
+
+  if (gFill == RECORDER_BUFFER_RECORDS && !handOver()) {
+    gDropped++;
+    return;
+  }
+
+  recorderFillRecord(s, hallIntervalUs, &gBuf[gActive][gFill]);
+  gFill++;
+  gRecords++;
+
+  if (gFill == RECORDER_BUFFER_RECORDS) handOver();
+}
+
+// SPIFFS writes (sector erase, GC) disable the flash cache, and the step
+// timer ISR is not IRAM-safe, so pulses would stall mid-move. Write only
+// while the motor holds still, as calibrationService() does; the other
+// buffer leaves RECORDER_BUFFER_RECORDS samples (10 s) of slack.
+static bool motorQuiet() {
+  return !gStepEn || (physStepPos == physStepTarget && !gIsHoming);
+}
+
+void recorderService() {
+  if ((gPending[0] != 0 || gPending[1] != 0) && !motorQuiet()) {
+    gDeferred++;
+    return;
+  }
+  for (int i = 0; i < 2; i++) {
+    const uint16_t count = gPending[i];
+    if (count == 0) continue;
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+    const uint32_t len = count * sizeof(RecorderRecord);
+    const uint32_t start = micros();
+
+    // Retention: keep one previous file, drop the one before it
+    if (gCurBytes + len > gFileMax) {
+      SPIFFS.remove(REC_OLD);
+      SPIFFS.rename(REC_FILE, REC_OLD);
+      gOldBytes = gCurBytes;
+      gCurBytes = 0;
+    }
+
+    File f = SPIFFS.open(REC_FILE, FILE_APPEND);
+    if (f) {
+      const size_t written = f.write((const uint8_t*)gBuf[i], len);
+      f.close();
+      gCurBytes += written;
+      if (written != len) LOG_W("REC", "Short write (%u of %lu bytes)", (unsigned)written, (unsigned long)len);
+    } else {
+      LOG_W("REC", "Open %s failed, %u records lost", REC_FILE, (unsigned)count);
+    }
+
+    const uint32_t us = micros() - start;
+    if (us > gWriteMaxUs) gWriteMaxUs = us;
+    gWrites++;
+
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    gPending[i] = 0;
+  }
+}
+
+bool recorderFlush() {
+  if (!gMounted) return false;
+
+  // Pull the partially filled buffer out of the control task (next sample).
+  // Not recording: its last sample already handed everything over.
+  if (gRecActive) {
+    gFlushRequest = true;
+    for (int i = 0; i < 40 && gFlushRequest; i++) delay(5);
+  }
+  recorderService();
+  return !gFlushRequest && gPending[0] == 0 && gPending[1] == 0;
+}
+
+void recorderSetEnabled(bool enabled) {
+  gEnabled = enabled;
+  LOG_I("REC", "Recorder %s", enabled ? "enabled" : "disabled");
+}
+
+void recorderClear() {
+  if (!gMounted) return;
+  // Handed-over buffers are cleared with the files (written, they would
+  // recreate REC_FILE)
+  gPending[0] = gPending[1] = 0;
+  SPIFFS.remove(REC_FILE);
+  SPIFFS.remove(REC_OLD);
+  gCurBytes = gOldBytes = 0;
+  LOG_I("REC", "Recordings cleared");
+}
+
+void recorderGetStats(RecorderStats* out) {
+  out->mounted = gMounted;
+  out->enabled = gEnabled;
+  out->active = gRecActive;
+  out->records = gRecords;
+  out->dropped = gDropped;
+  out->bytesStored = gCurBytes + gOldBytes;
+  out->bytesMax = 2 * gFileMax;
+  out->writes = gWrites;
+  out->writeMaxUs = gWriteMaxUs;
+  out->writesDeferred = gDeferred;
+}
+
+// ==================== CSV EXPORT ====================
+
+static const char* recModeName(uint8_t mode) {
+  switch (mode) {
+    case MODE_ERG: return "ERG";
+    case MODE_SIM: return "SIM";
+    default:       return "IDLE";
+  }
+}
+
+static void exportFile(const char* path, RecorderEmitFn emit, void* ctx, char* text, size_t textSize) {
+  File f = SPIFFS.open(path, FILE_READ);
+  if (!f) return;
+
+  RecorderRecord recs[32];
+  size_t n = 0;
+  for (;;) {
+    const size_t got = f.read((uint8_t*)recs, sizeof(recs)) / sizeof(RecorderRecord);
+    if (got == 0) break;
+
+    for (size_t i = 0; i < got; i++) {
+      const RecorderRecord& r = recs[i];
+      int w = snprintf(text + n, textSize - n, "%lu,%u,%.2f,%.2f,%d,%d,%d,%s,%d,%u\n",
+                       (unsigned long)r.ms, (unsigned)r.hallUs, r.speed * 0.01f, r.accel * 0.01f,
+                       r.powerW, r.pos, r.target, recModeName(r.mode), r.setpoint, (unsigned)r.flags);
+      if (w > 0) n += (size_t)w;
+      if (n > textSize - 96) {
+        emit(text, n, ctx);
+        n = 0;
+      }
+    }
+  }
+  f.close();
+  if (n) emit(text, n, ctx);
+}
+
+static const char CSV_HEADER[] = "ms,hall_us,speed_mph,accel_mph_s,power_w,pos,target,mode,setpoint,flags\n";
+static char gCsvText[1024];
+
+void recorderExportCsv(RecorderEmitFn emit, void* ctx) {
+  emit(CSV_HEADER, sizeof(CSV_HEADER) - 1, ctx);
+  if (!gMounted) return;
+
+  exportFile(REC_OLD, emit, ctx, gCsvText, sizeof(gCsvText));
+  exportFile(REC_FILE, emit, ctx, gCsvText, sizeof(gCsvText));
+}
+
+void recorderExportFileCsv(const char* path, RecorderEmitFn emit, void* ctx) {
+  emit(CSV_HEADER, sizeof(CSV_HEADER) - 1, ctx);
+  if (gMounted) exportFile(path, emit, ctx, gCsvText, sizeof(gCsvText));
+}
@@ -0,0 +1,78 @@
+/*
+ * recorder.h - On-Device Ride Recorder
+ *
+ * The control task appends one RecorderRecord per sensor sample to a RAM
+ * double buffer. loop() writes each full buffer to SPIFFS in one sequential
+ * append, so flash I/O never runs on the control path. Recording pauses
+ * while the rollers are stopped and the stepper is idle.
+ *
+ * Files: /rec.bin (current) and /rec.old (previous); the CSV export reads
+ * them oldest first.
+ */
+
+#ifndef RECORDER_H
+#define RECORDER_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "trainer_state.h"
+
+// ==================== FILES ====================
+static const char* const RECORDER_FILE = "/rec.bin";
+static const char* const RECORDER_FILE_OLD = "/rec.old";
+
+// ==================== RECORD ====================
+// Flag bits in RecorderRecord::flags
+static constexpr uint8_t REC_FLAG_STEP_EN     = (1 << 0);
+static constexpr uint8_t REC_FLAG_MANUAL_HOLD = (1 << 1);
+static constexpr uint8_t REC_FLAG_HOMING      = (1 << 2);
+static constexpr uint8_t REC_FLAG_BLE         = (1 << 3);
+
+struct __attribute__((packed)) RecorderRecord {
+  uint32_t ms;          // millis()
+  uint16_t hallUs;      // Last Hall edge interval, us (saturated; 0 = stopped)
+  uint16_t speed;       // 0.01 mph
+  int16_t accel;        // 0.01 mph/s
+  int16_t powerW;
+  int16_t pos;          // logStepPos
+  int16_t target;       // logStepTarget
+  int16_t setpoint;     // ERG target W, SIM grade in 0.01 %, else 0
+  uint8_t mode;         // ControlMode
+  uint8_t flags;        // REC_FLAG_*
+};
+
+static_assert(sizeof(RecorderRecord) == 20, "RecorderRecord layout is the file format");
+
+struct RecorderStats {
+  bool mounted;
+  bool enabled;
+  bool active;          // Currently appending (moving or in the tail)
+  uint32_t records;     // Recorded since boot
+  uint32_t dropped;     // Lost because both buffers were full
+  uint32_t bytesStored; // In both files
+  uint32_t bytesMax;    // Retention limit (both files)
+  uint32_t writes;      // Buffer flushes to flash
+  uint32_t writeMaxUs;  // Slowest flush (runs in loop)
+  uint32_t writesDeferred;  // loop() passes that held a flush while the motor moved
+};
+
+// ==================== FUNCTIONS ====================
+void recorderInit();                     // Mount SPIFFS (formats it on first use)
+void recorderSample(const TrainerSnapshot& s, uint32_t hallIntervalUs);  // Control task; never blocks
+void recorderService();                  // loop(): write handed-over buffers (motor still)
+// loop(): get buffered records onto flash. Returns false if any are still
+// in RAM (the motor is moving, or the control task did not hand them over).
+bool recorderFlush();
+void recorderFillRecord(const TrainerSnapshot& s, uint32_t hallIntervalUs, RecorderRecord* out);
+void recorderSetEnabled(bool enabled);
+void recorderClear();                    // Delete both files
+void recorderGetStats(RecorderStats* out);
+
+// Calls emit() with CSV text (header line first, oldest record first) of
+// what is on flash; recorderFlush() first for the newest records. Runs in
+// loop context.
+typedef void (*RecorderEmitFn)(const char* text, size_t len, void* ctx);
+void recorderExportCsv(RecorderEmitFn emit, void* ctx);
+void recorderExportFileCsv(const char* path, RecorderEmitFn emit, void* ctx);  // One file of records
+
+#endif // RECORDER_H
@@ -0,0 +1,316 @@
+/*
+ * replay.cpp - Deterministic Replay Implementation
+ */
+
+#include "replay.h"
+#include "ble_trainer.h"
+#include "control.h"
+#include "sensors.h"
+#include "stepper_control.h"
+#include "erg_control.h"
+#include "sweep.h"
+#include "log.h"
+#include <SPIFFS.h>
+
+// ==================== ENGINE STATE ====================
+static constexpr float TARGET_DT_S = 0.05f;   // controlTask runs the target at 20 Hz
+static constexpr uint32_t START_US = 1000000; // Virtual clock origin (0 reads as "never")
+static const float MODEL_LOG_PER_S = DEFAULT_STEP_SPEED_SPS * LOGICAL_MAX / PHYS_MAX_STEPS;  // Logical steps/s
+
+static ReplayClockFn gClock = NULL;
+static bool gFirst = true;
+static uint32_t gLastMs = 0;        // Recorded time of the previous record
+static uint32_t gNowUs = 0;         // Virtual time of the previous record
+static uint32_t gNextEdgeUs = 0;    // Next injected edge (0 = roller stopped)
+static uint8_t gCmdMode = MODE_IDLE;
+static int16_t gCmdSetpoint = 0;
+static float gModelPos = 0.0f;
+
+static ReplayStats gStats = {};
+static double gSumSpeed2 = 0.0, gSumPower2 = 0.0, gSumTarget2 = 0.0, gSumErg2 = 0.0;
+
+// Control state replay takes over (web/BLE values before the replay)
+static struct {
+  ControlMode mode;
+  int16_t ergWatts;
+  float gradePercent;
+  bool manualHold;
+  int32_t manualTarget;
+} gSaved;
+
+// ==================== ENGINE ====================
+
+// The Control Point write a central would have sent to get the recorded
+// mode/setpoint (none while homing: the rehome forces IDLE by itself)
+static size_t commandFor(const RecorderRecord& in, uint8_t* cp) {
+  if (in.flags & REC_FLAG_HOMING) return 0;
+  const bool changed = (in.mode != gCmdMode || in.setpoint != gCmdSetpoint);
+
+  switch (in.mode) {
+    case MODE_ERG:
+      if (!changed) return 0;
+      cp[0] = FTMS_OP_SET_TARGET_POWER;
+      cp[1] = (uint8_t)(in.setpoint & 0xFF);
+      cp[2] = (uint8_t)((uint16_t)in.setpoint >> 8);
+      return 3;
+
+    case MODE_SIM:
+      if (!changed) return 0;
+      cp[0] = FTMS_OP_SET_SIMULATION;
+      cp[1] = cp[2] = 0;                       // Wind speed
+      cp[3] = (uint8_t)(in.setpoint & 0xFF);   // Grade, 0.01 %
+      cp[4] = (uint8_t)((uint16_t)in.setpoint >> 8);
+      cp[5] = cp[6] = 0;                       // Crr, Cw
+      return 7;
+
+    default:
+      if (gCmdMode == MODE_IDLE) return 0;
+      cp[0] = FTMS_OP_STOP_PAUSE;
+      cp[1] = 0x01;                            // Stop
+      return 2;
+  }
+}
+
+void replayEngineBegin(ReplayClockFn liveStepper) {
+  gSaved.mode = gMode;
+  gSaved.ergWatts = ergTargetWatts;
+  gSaved.gradePercent = simGradePercent;
+  gSaved.manualHold = gManualHoldActive;
+  gSaved.manualTarget = gManualHoldTarget;
+
+  gClock = liveStepper;
+  gFirst = true;
+  gNowUs = START_US;
+  gNextEdgeUs = 0;
+  gCmdMode = MODE_IDLE;
+  gCmdSetpoint = 0;
+
+  gMode = MODE_IDLE;
+  gManualHoldActive = false;
+  ergControlReset();
+  bleProcessCommands();   // Nothing queued from before may leak into the replay
+  sensorsReplayBegin(gNowUs);
+
+  const ReplayState state = gStats.state;
+  gStats = ReplayStats();
+  gStats.state = state;
+  gStats.modelStepper = (liveStepper == NULL);
+  gSumSpeed2 = gSumPower2 = gSumTarget2 = gSumErg2 = 0.0;
+}
+
+void replayEngineStep(const RecorderRecord& in, RecorderRecord* out) {
+  // Virtual time: recorded spacing, with pauses cut to REPLAY_GAP_MAX_MS
+  if (gFirst) {
+    gFirst = false;
+    gLastMs = in.ms;
+    gModelPos = in.pos;
+  }
+  const uint32_t dtUs = min(in.ms - gLastMs, REPLAY_GAP_MAX_MS) * 1000;
+  const uint32_t prevUs = gNowUs;
+  const uint32_t nowUs = prevUs + dtUs;
+  gLastMs = in.ms;
+  gNowUs = nowUs;
+  gStats.rideMs += dtUs / 1000;
+
+  // Hall edges up to this sample, spaced at the recorded interval
+  if (in.hallUs == 0) {
+    gNextEdgeUs = 0;
+  } else {
+    if (gNextEdgeUs == 0) gNextEdgeUs = prevUs + 1;
+    while ((int32_t)(nowUs - gNextEdgeUs) >= 0) {
+      if (gClock) gClock(gNextEdgeUs);
+      sensorsReplayEdge(gNextEdgeUs);
+      gNextEdgeUs += in.hallUs;
+      gStats.edges++;
+    }
+  }
+
+  // Commands go through the same parser and dispatcher as BLE writes
+  uint8_t cp[8];
+  const size_t cpLen = commandFor(in, cp);
+  if (cpLen) {
+    bleReplayControlPoint(cp, cpLen);
+    gCmdMode = in.mode;
+    gCmdSetpoint = in.setpoint;
+    gStats.commands++;
+  }
+  gManualHoldActive = (in.flags & REC_FLAG_MANUAL_HOLD) != 0;
+  gManualHoldTarget = in.target;
+
+  // The control tick: sensors, then target
+  if (gClock) gClock(nowUs);
+  sensorsReplaySetTime(nowUs);
+  if (!gClock) sensorsReplaySetPosition(gModelPos);
+  sensorsUpdate();
+  const int32_t target = constrain(controlTargetUpdate(TARGET_DT_S), LOGICAL_MIN, LOGICAL_MAX);
+
+  int32_t pos;
+  if (gClock) {
+    pos = logStepPos;
+    stepperSetTarget(target);
+  } else {
+    pos = (int32_t)lroundf(gModelPos);
+    const float maxMove = MODEL_LOG_PER_S * dtUs * 1e-6f;
+    gModelPos += constrain(target - gModelPos, -maxMove, maxMove);
+  }
+
+  TrainerSnapshot s = {};
+  s.ms = in.ms;
+  s.speedMph = currentSpeedMph;
+  s.accelMphS = currentAccelMphS;
+  s.rpm = currentRPM;
+  s.powerWatts = currentPowerWatts;
+  s.logPos = pos;
+  s.logTarget = target;
+  s.mode = gMode;
+  s.ergTargetWatts = ergTargetWatts;
+  s.simGradePercent = simGradePercent;
+  s.manualHold = gManualHoldActive;
+  recorderFillRecord(s, hallLastIntervalUs(), out);
+  out->flags = in.flags;   // Motor/BLE state is the recording's, not simulated
+
+  // Differences against the recording
+  const float dSpeed = (out->speed - in.speed) * 0.01f;
+  const float dPower = (float)(out->powerW - in.powerW);
+  const float dTarget = (float)(out->target - in.target);
+  gSumSpeed2 += dSpeed * dSpeed;
+  gSumPower2 += dPower * dPower;
+  gSumTarget2 += dTarget * dTarget;
+  gStats.speedMaxMph = max(gStats.speedMaxMph, fabsf(dSpeed));
+  gStats.powerMaxW = max(gStats.powerMaxW, fabsf(dPower));
+  gStats.targetMax = max(gStats.targetMax, fabsf(dTarget));
+  gStats.records++;
+  gStats.speedRmsMph = sqrtf(gSumSpeed2 / gStats.records);
+  gStats.powerRmsW = sqrtf(gSumPower2 / gStats.records);
+  gStats.targetRms = sqrtf(gSumTarget2 / gStats.records);
+
+  if (out->mode == MODE_ERG && out->speed * 0.01f >= ERG_PI_MIN_SPEED_MPH && !(in.flags & REC_FLAG_HOMING)) {
+    const float dErg = (float)(out->powerW - out->setpoint);
+    gSumErg2 += dErg * dErg;
+    gStats.ergMaxW = max(gStats.ergMaxW, fabsf(dErg));
+    gStats.ergRecords++;
+    gStats.ergRmsW = sqrtf(gSumErg2 / gStats.ergRecords);
+  }
+}
+
+void replayEngineEnd() {
+  sensorsReplayEnd();
+  ergControlReset();
+
+  gMode = gSaved.mode;
+  ergTargetWatts = gSaved.ergWatts;
+  simGradePercent = gSaved.gradePercent;
+  gManualHoldActive = gSaved.manualHold;
+  gManualHoldTarget = gSaved.manualTarget;
+  gClock = NULL;
+}
+
+// ==================== REPLAY JOB ====================
+static volatile bool gJobActive = false;
+static File gIn;
+static File gOut;
+static bool gInIsOld = false;
+static RecorderRecord gInBuf[REPLAY_SLICE_RECORDS];
+static RecorderRecord gOutBuf[REPLAY_SLICE_RECORDS];
+
+static bool replayFail(const char* why) {
+  gStats.state = REPLAY_FAILED;
+  gStats.error = why;
+  LOG_W("REPLAY", "Not started: %s", why);
+  return false;
+}
+
+bool replayStart(ReplayClockFn liveStepper) {
+  if (gJobActive) return false;
+
+  RecorderStats rec;
+  recorderGetStats(&rec);
+  if (!rec.mounted) return replayFail("no filesystem");
+  if (deviceConnected) return replayFail("BLE central connected");
+  if (currentSpeedMph > 0.0f || gIsHoming) return replayFail("trainer busy");
+  if (sweepActive()) return replayFail("calibration sweep running");
+
+  // Needs the control task still sampling; the end of the ride may be held
+  // in RAM until the carriage settles
+  if (!recorderFlush()) return replayFail("recording not on flash yet, motor still moving");
+  gInIsOld = SPIFFS.exists(RECORDER_FILE_OLD);
+  gIn = SPIFFS.open(gInIsOld ? RECORDER_FILE_OLD : RECORDER_FILE, FILE_READ);
+  if (!gIn) return replayFail("no recording");
+  SPIFFS.remove(REPLAY_FILE);
+  gOut = SPIFFS.open(REPLAY_FILE, FILE_WRITE);
+  if (!gOut) {
+    gIn.close();
+    return replayFail("cannot create output");
+  }
+
+  // The control task skips the pipeline from its next tick on. Single core:
+  // loop() only runs while that task is blocked, never in the middle of a tick.
+  gJobActive = true;
+  replayEngineBegin(liveStepper);
+  gStats.state = REPLAY_RUNNING;
+  LOG_I("REPLAY", "Started (%s stepper)", liveStepper ? "live" : "modelled");
+  return true;
+}
+
+static void replayFinish() {
+  gIn.close();
+  gOut.close();
+  replayEngineEnd();
+  gStats.state = REPLAY_DONE;
+  gJobActive = false;
+  LOG_I("REPLAY", "Done: %lu records, %lu s of ride in %lu ms; speed rms %.2f mph, power rms %.1f W, target rms %.1f",
+        (unsigned long)gStats.records, (unsigned long)(gStats.rideMs / 1000),
+        (unsigned long)(gStats.cpuUs / 1000), gStats.speedRmsMph, gStats.powerRmsW, gStats.targetRms);
+}
+
+void replayService() {
+  if (!gJobActive) return;
+  const uint32_t start = micros();
+
+  size_t n = gIn.read((uint8_t*)gInBuf, sizeof(gInBuf)) / sizeof(RecorderRecord);
+  if (n == 0 && gInIsOld) {
+    // Previous file done, continue with the current one
+    gIn.close();
+    gInIsOld = false;
+    gIn = SPIFFS.open(RECORDER_FILE, FILE_READ);
+    if (gIn) n = gIn.read((uint8_t*)gInBuf, sizeof(gInBuf)) / sizeof(RecorderRecord);
+  }
+  if (n == 0) {
+    replayFinish();
+    return;
+  }
+
+  for (size_t i = 0; i < n; i++) replayEngineStep(gInBuf[i], &gOutBuf[i]);
+
+  // Keep flash for the recorder: stop writing output (not replaying) when full
+  const size_t len = n * sizeof(RecorderRecord);
+  if (!gStats.truncated && SPIFFS.totalBytes() - SPIFFS.usedBytes() < len + REPLAY_FREE_MARGIN_BYTES) {
+    gStats.truncated = true;
+    LOG_W("REPLAY", "Flash nearly full, output truncated at %lu records",
+          (unsigned long)(gStats.records - n));
+  }
+  if (!gStats.truncated) gOut.write((const uint8_t*)gOutBuf, len);
+
+  gStats.cpuUs += micros() - start;
+}
+
+bool replayActive() {
+  return gJobActive;
+}
+
+void replayGetStats(ReplayStats* out) {
+  *out = gStats;
+}
+
+const char* replayStateName(ReplayState state) {
+  switch (state) {
+    case REPLAY_RUNNING: return "running";
+    case REPLAY_DONE:    return "done";
+    case REPLAY_FAILED:  return "failed";
+    default:             return "idle";
+  }
+}
+
+void replayExportCsv(RecorderEmitFn emit, void* ctx) {
+  recorderExportFileCsv(REPLAY_FILE, emit, ctx);
+}
@@ -0,0 +1,80 @@
+/*
+ * replay.h - Deterministic Replay of Recorded Rides
+ *
+ * Feeds a recording back through the control pipeline on a virtual clock,
+ * as fast as the CPU allows: Hall edges go through the ISR's edge path
+ * (sensorsReplayEdge) and mode/setpoint changes become FTMS Control Point
+ * writes, applied directly (bleReplayControlPoint: no queue, no response;
+ * real BLE writes are refused meanwhile). sensorsUpdate() and
+ * controlTargetUpdate() then run at the recorded 20 Hz sample times. The output has one
+ * RecorderRecord per input record, plus error statistics against the
+ * recording.
+ *
+ * The inputs are rebuilt from the samples. The recorder keeps the newest
+ * edge interval per 50 ms sample, so the edges between two samples are
+ * evenly spaced at that interval.
+ *
+ * Stepper: on the device the motor is left alone and the position follows
+ * the target at the run speed (a model). On the host, a clock callback
+ * advances the simulated step timer, so the real planner moves.
+ */
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "recorder.h"
+
+// ==================== FILES ====================
+static const char* const REPLAY_FILE = "/replay.bin";   // Output, RecorderRecord format
+
+// ==================== ENGINE ====================
+// Live stepper: called with each virtual time the pipeline reaches, so the
+// caller can run the step timer (and stepperUpdate) up to it. NULL = model.
+typedef void (*ReplayClockFn)(uint32_t nowUs);
+
+void replayEngineBegin(ReplayClockFn liveStepper);   // Saves and resets control state
+void replayEngineStep(const RecorderRecord& in, RecorderRecord* out);
+void replayEngineEnd();                              // Restores control state, live sensors
+
+// ==================== REPLAY JOB ====================
+enum ReplayState : uint8_t {
+  REPLAY_IDLE = 0,
+  REPLAY_RUNNING,
+  REPLAY_DONE,
+  REPLAY_FAILED
+};
+
+struct ReplayStats {
+  ReplayState state;
+  const char* error;      // Why the last start failed (NULL if it did not)
+  bool modelStepper;      // Position modelled (device) vs. real planner (host)
+  bool truncated;         // Output stopped early: flash nearly full
+  uint32_t records;
+  uint32_t edges;         // Hall edges injected
+  uint32_t commands;      // Control Point writes injected
+  uint32_t rideMs;        // Recorded time covered (gaps capped at REPLAY_GAP_MAX_MS)
+  uint32_t cpuUs;         // Time spent replaying
+  // Replayed minus recorded
+  float speedRmsMph, speedMaxMph;
+  float powerRmsW, powerMaxW;
+  float targetRms, targetMax;   // Logical steps
+  // ERG tracking: replayed power minus the ERG setpoint (ERG records at or
+  // above ERG_PI_MIN_SPEED_MPH, not homing)
+  uint32_t ergRecords;
+  float ergRmsW, ergMaxW;
+};
+
+// loop() context. Refuses unless the trainer is idle: no BLE central, rollers
+// stopped, not homing, no calibration sweep, and the whole recording on
+// flash (recorderFlush()). While active the control task leaves sensors, target
+// and recorder alone and the motor holds position.
+bool replayStart(ReplayClockFn liveStepper);
+void replayService();                  // loop(): runs one slice of records
+bool replayActive();
+void replayGetStats(ReplayStats* out);
+const char* replayStateName(ReplayState state);
+void replayExportCsv(RecorderEmitFn emit, void* ctx);   // Output as CSV (recorder columns)
+
+#endif // REPLAY_H
@@ -5,28 +5,63 @@
 #include "sensors.h"
 #include "stepper_control.h"
 #include "ble_trainer.h"  // For deviceConnected status
+#include "lut2d.h"
+#include "log.h"
+#include "calibration.h"
+#include "power.h"
 
 // ==================== GLOBAL SENSOR DATA ====================
 float currentRPM = 0.0f;
 float currentSpeedMph = 0.0f;
+float currentAccelMphS = 0.0f;
 float currentPowerWatts = 0.0f;
+float currentInertiaWatts = 0.0f;
 
 // ==================== HALL SENSOR STATE ====================
-static volatile uint32_t gLastHallUs = 0;
-static volatile uint32_t gHallIntervalUs = 0;
-static volatile uint32_t gHallEdges = 0;
+// Single-producer ring of accepted edge timestamps. The ISR writes the slot
+// first and then publishes it by bumping gHallEdges; the reader copies what
+// it needs and re-checks gHallEdges to detect an overwrite.
+static volatile uint32_t gHallRing[HALL_RING_SIZE];
+static volatile uint32_t gHallEdges = 0;        // Total accepted edges
+static volatile uint32_t gHallRunStart = 0;     // Edge index that started the current run
 static volatile uint32_t gLastAcceptedHallUs = 0;
 
 // Hall sensor configuration (using values from config.h)
-static const uint32_t HALL_MIN_DT_US = 1500;       // Reject pulses faster than this
-static const uint32_t HALL_HOLDOFF_US = 3000;      // Anti-chatter holdoff (3ms)
+static const uint32_t HALL_HOLDOFF_US = 3000;      // Anti-chatter holdoff (3ms), also rejects bounce
 static const uint32_t HALL_TIMEOUT_US = 500000;    // Consider stopped after 500ms without pulse
 static const float MIN_VALID_RPM = 15.0f;          // Below this RPM, treat as stopped (~0.5 mph)
 
-// RPM filtering
-static float gRpmFiltered = 0.0f;
-static const float RPM_FILTER_TAU_S = 0.60f;       // Time constant for smoothing
-static uint32_t gLastRpmFilterMs = 0;
+// Replay: a virtual clock and injected edges stand in for micros() and the
+// Hall input; a position >= 0 stands in for logStepPos
+static volatile bool gReplayActive = false;
+static volatile uint32_t gReplayNowUs = 0;
+static float gReplayPos = -1.0f;
+
+static inline uint32_t IRAM_ATTR sensorsNowUs() {
+  return gReplayActive ? gReplayNowUs : micros();
+}
+
+// Speed estimator: constant-acceleration Kalman filter on (rpm, rpm/s).
+// Tuning lives in config.h (SPEED_KF_*); see speedEstimatorUpdate().
+struct SpeedEstimator {
+  float rpm;         // State: speed
+  float accel;       // State: d(rpm)/dt
+  float p00, p01, p11;  // Covariance (symmetric)
+  uint32_t lastUs;
+  bool valid;
+};
+static SpeedEstimator gSpeedKf = {};
+
+// Inertia compensation / coast-down
+static constexpr float RPM_TO_RAD_S = 2.0f * PI / 60.0f;
+static float gInertiaAccelFiltered = 0.0f;   // rpm/s
+static uint32_t gLastPowerUs = 0;            // Previous sensorsUpdate(), for dt
+static volatile CoastDownState gCoastState = COAST_IDLE;
+static uint32_t gCoastArmedMs = 0;
+static uint16_t gCoastSamples = 0;
+static float gCoastSumXY = 0.0f;
+static float gCoastSumXX = 0.0f;
+static float gCoastResult = 0.0f;
 
 // Speed conversion constants (using ROLLER_DIAMETER_IN from config.h)
 static constexpr float INCHES_PER_MILE = 63360.0f;
@@ -42,6 +77,8 @@ double gPowerPosAxis[5] = { 0, 250, 500, 750, 1000 };
 static const int Xcount = 7;
 static const int Ycount = 5;
 
+static Lut2D<Xcount, Ycount> gPowerLut;
+
 // Power calibration table [speed][position] = watts
 // Default values - can be modified via web UI and saved to NVS
 double gPowerTable[7][5] = {
@@ -56,49 +93,105 @@ double gPowerTable[7][5] = {
 
 // ==================== HALL SENSOR ISR ====================
 
-void IRAM_ATTR hallISR() {
-  uint32_t now = micros();
+// Shared by the ISR and replay: holdoff, run detection, ring publish
+static inline void IRAM_ATTR hallAcceptEdge(uint32_t now) {
+  uint32_t last = gLastAcceptedHallUs;
+  uint32_t edges = gHallEdges;
   
   // Holdoff to suppress chatter
-  uint32_t sinceAccepted = now - gLastAcceptedHallUs;
-  if (gLastAcceptedHallUs != 0 && sinceAccepted < HALL_HOLDOFF_US) {
+  uint32_t dt = now - last;
+  if (edges != 0 && dt < HALL_HOLDOFF_US) {
     return;
   }
   
-  uint32_t dt = now - gLastHallUs;
-  
-  // Ignore very short intervals (bounce/noise)
-  if (gLastHallUs != 0 && dt < HALL_MIN_DT_US) {
-    return;
+  // A gap longer than the stop timeout starts a new run: don't span it
+  if (edges == 0 || dt > HALL_TIMEOUT_US) {
+    gHallRunStart = edges;
   }
   
   // Accept this edge
-  gLastHallUs = now;
-  gHallIntervalUs = dt;
-  gHallEdges++;
+  gHallRing[edges & (HALL_RING_SIZE - 1)] = now;
+  gHallEdges = edges + 1;
   gLastAcceptedHallUs = now;
 }
 
+void IRAM_ATTR hallISR() {
+  if (gReplayActive) return;  // The real sensor is ignored during replay
+  hallAcceptEdge(micros());
+  if (gPowerIdle) powerWakeFromISR();  // The first edge of a ride ends idle at once
+}
+
 // ==================== HELPER FUNCTIONS ====================
 
+// Copy the newest `count` edge timestamps (oldest first). Returns false if
+// the ISR lapped the ring while copying (cannot happen at sane speeds).
+static bool hallCopyEdges(uint32_t newest, uint32_t count, uint32_t* out) {
+  for (uint32_t i = 0; i < count; i++) {
+    out[i] = gHallRing[(newest - (count - 1) + i) & (HALL_RING_SIZE - 1)];
+  }
+  return (gHallEdges - 1) - newest <= HALL_RING_SIZE - count;
+}
+
+uint32_t hallEdgeCount() {
+  return gHallEdges;
+}
+
+// Interval between the two newest edges of the current run (0 = stopped)
+uint32_t hallLastIntervalUs() {
+  const uint32_t edges = gHallEdges;
+  if (edges < 2 || edges - 1 == gHallRunStart) return 0;
+  if (sensorsNowUs() - gLastAcceptedHallUs > HALL_TIMEOUT_US) return 0;
+
+  uint32_t t[2];
+  if (!hallCopyEdges(edges - 1, 2, t)) return 0;
+  return t[1] - t[0];
+}
+
 static float readRPM() {
-  noInterrupts();
-  uint32_t dt = gHallIntervalUs;
-  uint32_t last = gLastHallUs;
-  interrupts();
+  uint32_t edges = gHallEdges;
+  uint32_t runStart = gHallRunStart;
+  uint32_t last = gLastAcceptedHallUs;
 
   // Check for valid data
-  if (last == 0) return 0.0f;
+  if (edges == 0) return 0.0f;
 
   // Use shorter timeout to detect stopped state faster
-  uint32_t timeSincePulse = micros() - last;
+  uint32_t now = sensorsNowUs();
+  uint32_t timeSincePulse = now - last;
   if (timeSincePulse > HALL_TIMEOUT_US) return 0.0f;  // Stopped
 
-  if (dt == 0) return 0.0f;
+  const uint32_t newest = edges - 1;
+  uint32_t intervals = newest - runStart;              // Intervals in this run
+  if (intervals == 0) return 0.0f;
+  if (intervals > HALL_RING_SIZE - 1) intervals = HALL_RING_SIZE - 1;
+
+  uint32_t t[HALL_RING_SIZE];
+  if (!hallCopyEdges(newest, intervals + 1, t)) return 0.0f;
+
+  // Whole revolutions only: magnet spacing errors cancel over a full turn.
+  // Take as many revolutions as fit in the window (at least one). Until the
+  // first revolution completes, fall back to the partial span.
+  uint32_t n = intervals;
+  if (n >= HALL_PULSES_PER_REV) {
+    n = HALL_PULSES_PER_REV;
+    while (n + HALL_PULSES_PER_REV <= intervals &&
+           t[intervals] - t[intervals - n - HALL_PULSES_PER_REV] <= HALL_SPEED_WINDOW_US) {
+      n += HALL_PULSES_PER_REV;
+    }
+  }
+
+  uint32_t spanUs = t[intervals] - t[intervals - n];
+
+  // Decelerating: if the next edge is already overdue, the true speed is at
+  // most "one more edge right now". Using that bound decays smoothly to zero
+  // instead of holding the last reading until the timeout.
+  uint32_t overdueSpanUs = now - t[intervals - n + 1];
+  if (overdueSpanUs > spanUs) spanUs = overdueSpanUs;
+
+  if (spanUs == 0) return 0.0f;
 
   // Calculate RPM
-  float pps = 1e6f / (float)dt;                    // Pulses per second
-  float rps = pps / (float)HALL_PULSES_PER_REV;    // Revolutions per second
+  float rps = ((float)n * 1e6f) / ((float)spanUs * (float)HALL_PULSES_PER_REV);
   float rpm = rps * 60.0f;                         // RPM
 
   // Reject very low RPM as noise (below ~0.5 mph)
@@ -107,30 +200,55 @@ static float readRPM() {
   return rpm;
 }
 
-static float filterRPM(float rawRpm) {
-  uint32_t now = millis();
+static void speedEstimatorReset(float rpm, uint32_t nowUs) {
+  const float r = SPEED_KF_MEAS_NOISE_RPM;
+  gSpeedKf.rpm = rpm;
+  gSpeedKf.accel = 0.0f;
+  gSpeedKf.p00 = r * r;
+  gSpeedKf.p01 = 0.0f;
+  gSpeedKf.p11 = SPEED_KF_INIT_ACCEL_RPM_S * SPEED_KF_INIT_ACCEL_RPM_S;
+  gSpeedKf.lastUs = nowUs;
+  gSpeedKf.valid = (rpm > 0.0f);
+}
 
-  // If raw RPM is zero, quickly reset filtered value to zero
-  if (rawRpm == 0.0f) {
-    gRpmFiltered = 0.0f;
-    gLastRpmFilterMs = now;
-    return 0.0f;
-  }
+// Predict with constant acceleration driven by white jerk noise, then
+// correct with the revolution-averaged measurement. A zero reading means
+// stopped (timeout or below MIN_VALID_RPM) and snaps the state to rest.
+static void speedEstimatorUpdate(float measuredRpm) {
+  const uint32_t now = sensorsNowUs();
 
-  if (gLastRpmFilterMs == 0) {
-    gLastRpmFilterMs = now;
-    gRpmFiltered = rawRpm;
-    return rawRpm;
+  if (measuredRpm == 0.0f || !gSpeedKf.valid) {
+    speedEstimatorReset(measuredRpm, now);
+    return;
   }
 
-  float dt = (now - gLastRpmFilterMs) / 1000.0f;  // seconds
-  gLastRpmFilterMs = now;
-
-  // Exponential moving average
-  float alpha = dt / (RPM_FILTER_TAU_S + dt);
-  gRpmFiltered = alpha * rawRpm + (1.0f - alpha) * gRpmFiltered;
-
-  return gRpmFiltered;
+  float dt = (now - gSpeedKf.lastUs) * 1e-6f;
+  gSpeedKf.lastUs = now;
+  if (dt <= 0.0f) return;
+  if (dt > 0.5f) dt = 0.5f;
+
+  // Predict: x = F x, P = F P F' + Q
+  SpeedEstimator& k = gSpeedKf;
+  const float q = SPEED_KF_JERK_NOISE * SPEED_KF_JERK_NOISE;
+  const float dt2 = dt * dt;
+  k.rpm += k.accel * dt;
+  const float p00 = k.p00 + 2.0f * dt * k.p01 + dt2 * k.p11 + q * dt2 * dt / 3.0f;
+  const float p01 = k.p01 + dt * k.p11 + q * dt2 / 2.0f;
+  const float p11 = k.p11 + q * dt;
+
+  // Correct: scalar measurement of speed
+  const float r = SPEED_KF_MEAS_NOISE_RPM * SPEED_KF_MEAS_NOISE_RPM;
+  const float s = p00 + r;
+  const float k0 = p00 / s;
+  const float k1 = p01 / s;
+  const float innovation = measuredRpm - k.rpm;
+  k.rpm += k0 * innovation;
+  k.accel += k1 * innovation;
+  k.p00 = (1.0f - k0) * p00;
+  k.p01 = (1.0f - k0) * p01;
+  k.p11 = p11 - k1 * p01;
+
+  if (k.rpm < 0.0f) k.rpm = 0.0f;
 }
 
 // ==================== CONVERSION FUNCTIONS ====================
@@ -147,15 +265,208 @@ float mphToRpm(float mph) {
 
 // ==================== POWER CALCULATION ====================
 
-double powerFromSpeedPos(double speedMph, double posLogical) {
+float powerFromSpeedPos(float speedMph, float posLogical) {
+  const q16_t x = lutToQ16(speedMph);
+  const q16_t y = lutToQ16(posLogical);
+
+  // Bounds check
+  if (!gPowerLut.xAxis().inRange(x)) {
+    LOG_D("POWER", "Speed out of range");
+    return 0;
+  }
+
+  if (!gPowerLut.yAxis().inRange(y)) {
+    LOG_D("POWER", "Position out of range");
+    return 0;
+  }
+
+  return lutFromQ16(gPowerLut.lookupQ16(x, y));
+}
+
+// ==================== ERG MODE: STEP FROM POWER/SPEED ====================
+
+// ERG mode calibration: Speed grid (mph) - FIXED AXIS
+double gErgSpeedAxis[7] = { 0, 5, 10, 15, 20, 25, 50 };
+// ERG mode calibration: Power grid (watts) - FIXED AXIS
+double gErgPowerAxis[9] = { 0, 100, 150, 200, 250, 300, 400, 600, 1000 };
+
+static const int Xcountw = 7;
+static const int Ycountw = 9;
+
+static Lut2D<Xcountw, Ycountw> gErgLut;
+
+// ERG mode table: [speed][power] = position
+// Default values - can be modified via web UI and saved to NVS
+double gErgTable[7][9] = {
+  {   0,    0,    0,    0,    0,    0,    0,    0,    0 },  // 0 mph
+  {   0,  739, 1000, 1000, 1000, 1000, 1000, 1000, 1000 },  // 5 mph
+  {   0,    0,  212,  442,  651,  841, 1000, 1000, 1000 },  // 10 mph
+  {   0,    0,    0,   70,  198,  322,  560,  996, 1000 },  // 15 mph
+  {   0,    0,    0,    0,    0,   79,  238,  552, 1000 },  // 20 mph
+  {   0,    0,    0,    0,    0,    0,   67,  285,  745 },  // 25 mph
+  {   0,    0,    0,    0,    0,    0,    0,    0,   26 }   // 50 mph
+};
+
+// ERG from the power table: dense inverse, rebuilt with the power table
+static LutGrid<ERG_INV_SPEED_POINTS, ERG_INV_WATT_POINTS> gErgInv;
+
+float stepFromPowerSpeed(float speedMph, float targetWatts) {
+  const q16_t x = lutToQ16(speedMph);
+  const q16_t y = lutToQ16(targetWatts);
+
+  if (gErgFromPower) {
+    if (!gPowerLut.xAxis().inRange(x)) {
+      LOG_D("ERG", "Speed out of range");
+      return 0;
+    }
+    return lutFromQ16(gErgInv.lookupQ16(x, y));   // Watts clamped to the grid
+  }
+
+  // Bounds check
+  if (!gErgLut.xAxis().inRange(x)) {
+    LOG_D("ERG", "Speed out of range");
+    return 0;
+  }
+
+  if (!gErgLut.yAxis().inRange(y)) {
+    LOG_D("ERG", "Power out of range");
+    return 0;
+  }
+
+  return lutFromQ16(gErgLut.lookupQ16(x, y));
+}
+
+// ==================== SIM MODE: STEP FROM GRADE/SPEED ====================
+
+// SIM mode calibration: Speed grid (mph) - FIXED AXIS
+double gSimSpeedAxis[8] = { 0, 5, 10, 15, 20, 25, 30, 50 };
+// SIM mode calibration: Grade grid (percent) - FIXED AXIS
+double gSimGradeAxis[7] = { -4, 0, 2, 4, 6, 8, 10 };
+
+static const int Xcountstep = 8;
+static const int Ycountstep = 7;
+
+static Lut2D<Xcountstep, Ycountstep> gSimLut;
+
+// SIM mode table: [speed][grade] = position
+// Default values - can be modified via web UI and saved to NVS
+double gSimTable[8][7] = {
+  {   0,  167,  333,  500,  667,  833, 1000 },  // 0 mph
+  {   0,  167,  333,  500,  667,  833, 1000 },  // 5 mph
+  {   0,  167,  333,  500,  667,  833, 1000 },  // 10 mph
+  {   0,  167,  333,  500,  667,  833, 1000 },  // 15 mph
+  {   0,  167,  333,  500,  667,  833, 1000 },  // 20 mph
+  { 167,  333,  500,  677,  834, 1000, 1000 },  // 25 mph
+  { 333,  500,  677,  834, 1000, 1000, 1000 },  // 30 mph
+  { 500,  500,  677,  834, 1000, 1000, 1000 }   // 50 mph
+};
+
+float gradeToSteps(float speedMph, float gradePercent) {
+  const q16_t x = lutToQ16(speedMph);
+  const q16_t y = lutToQ16(gradePercent);
+
+  // Bounds check
+  if (!gSimLut.xAxis().inRange(x)) {
+    LOG_D("SIM", "Speed out of range");
+    return 500;  // Default to mid position
+  }
+
+  if (!gSimLut.yAxis().inRange(y)) {
+    LOG_D("SIM", "Grade out of range");
+    // Clamped by the lookup instead of returning 0
+  }
+
+  return lutFromQ16(gSimLut.lookupQ16(x, y));
+}
+
+// ==================== LOOKUP TABLE ENGINE ====================
+
+// One speed row of the ERG inverse: the power table row at that speed (same
+// interpolation as powerFromSpeedPos), made monotone - more resistance never
+// gives less power - then solved for the lowest position reaching each watt
+// column. Above the row's maximum power it holds the position of the maximum.
+static void ergInverseBuildRow(int i) {
+  const double speed = gErgInv.xAt(i);
+  int k = 0;
+  while (k < Xcount - 2 && speed > gPowerSpeedAxis[k + 1]) k++;
+  const double t = (speed - gPowerSpeedAxis[k]) / (gPowerSpeedAxis[k + 1] - gPowerSpeedAxis[k]);
+
+  double w[Ycount];
+  int firstMax = 0;
+  for (int c = 0; c < Ycount; c++) {
+    w[c] = gPowerTable[k][c] + (gPowerTable[k + 1][c] - gPowerTable[k][c]) * t;
+    if (c > 0 && w[c] < w[c - 1]) w[c] = w[c - 1];
+    if (w[c] > w[firstMax]) firstMax = c;
+  }
+
+  int c = 0;
+  for (int j = 0; j < ERG_INV_WATT_POINTS; j++) {
+    const double watts = gErgInv.yAt(j);
+    while (c < Ycount && w[c] < watts) c++;   // First breakpoint at or above
+
+    double pos;
+    if (c == 0) {
+      pos = gPowerPosAxis[0];
+    } else if (c == Ycount) {
+      pos = gPowerPosAxis[firstMax];
+    } else {
+      pos = gPowerPosAxis[c - 1] +
+            (watts - w[c - 1]) / (w[c] - w[c - 1]) * (gPowerPosAxis[c] - gPowerPosAxis[c - 1]);
+    }
+    gErgInv.set(i, j, (float)pos);
+  }
+}
+
+static void ergInverseBuild() {
+  const float span = (float)(gPowerSpeedAxis[Xcount - 1] - gPowerSpeedAxis[0]);
+  gErgInv.setAxes((float)gPowerSpeedAxis[0], span / (ERG_INV_SPEED_POINTS - 1), 0.0f, ERG_INV_WATT_STEP);
+  for (int i = 0; i < ERG_INV_SPEED_POINTS; i++) ergInverseBuildRow(i);
+}
+
+// Power table point (row, col) changed: only speeds up to the neighbouring rows move
+static void ergInverseUpdateRow(int row) {
+  const double lo = gPowerSpeedAxis[max(row - 1, 0)];
+  const double hi = gPowerSpeedAxis[min(row + 1, Xcount - 1)];
+  for (int i = 0; i < ERG_INV_SPEED_POINTS; i++) {
+    const double speed = gErgInv.xAt(i);
+    if (speed >= lo && speed <= hi) ergInverseBuildRow(i);
+  }
+}
+
+void lutRebuild(CalTable table) {
+  switch (table) {
+    case CAL_TABLE_POWER:
+      gPowerLut.build(gPowerSpeedAxis, gPowerPosAxis, gPowerTable);
+      ergInverseBuild();
+      break;
+    case CAL_TABLE_ERG:   gErgLut.build(gErgSpeedAxis, gErgPowerAxis, gErgTable); break;
+    case CAL_TABLE_SIM:   gSimLut.build(gSimSpeedAxis, gSimGradeAxis, gSimTable); break;
+  }
+}
+
+void lutUpdatePoint(CalTable table, int row, int col) {
+  switch (table) {
+    case CAL_TABLE_POWER:
+      gPowerLut.updatePoint(gPowerTable, row, col);
+      ergInverseUpdateRow(row);
+      break;
+    case CAL_TABLE_ERG:   gErgLut.updatePoint(gErgTable, row, col); break;
+    case CAL_TABLE_SIM:   gSimLut.updatePoint(gSimTable, row, col); break;
+  }
+}
+
+#if ENABLE_LUT_BENCHMARK
+// ==================== LOOKUP BENCHMARK ====================
+// Original double-precision scan implementations, kept only to compare
+// cycle counts and results against the fixed-point engine.
+
+static double legacyPowerFromSpeedPos(double speedMph, double posLogical) {
   // Bounds check
   if ((speedMph < gPowerSpeedAxis[0]) || (speedMph > gPowerSpeedAxis[Xcount - 1])) {
-    Serial.println("[POWER] Speed out of range");
     return 0;
   }
 
   if ((posLogical < gPowerPosAxis[0]) || (posLogical > gPowerPosAxis[Ycount - 1])) {
-    Serial.println("[POWER] Position out of range");
     return 0;
   }
 
@@ -197,37 +508,13 @@ double powerFromSpeedPos(double speedMph, double posLogical) {
   return power;
 }
 
-// ==================== ERG MODE: STEP FROM POWER/SPEED ====================
-
-// ERG mode calibration: Speed grid (mph) - FIXED AXIS
-double gErgSpeedAxis[7] = { 0, 5, 10, 15, 20, 25, 50 };
-// ERG mode calibration: Power grid (watts) - FIXED AXIS
-double gErgPowerAxis[9] = { 0, 100, 150, 200, 250, 300, 400, 600, 1000 };
-
-static const int Xcountw = 7;
-static const int Ycountw = 9;
-
-// ERG mode table: [speed][power] = position
-// Default values - can be modified via web UI and saved to NVS
-double gErgTable[7][9] = {
-  {   0,    0,    0,    0,    0,    0,    0,    0,    0 },  // 0 mph
-  {   0,  739, 1000, 1000, 1000, 1000, 1000, 1000, 1000 },  // 5 mph
-  {   0,    0,  212,  442,  651,  841, 1000, 1000, 1000 },  // 10 mph
-  {   0,    0,    0,   70,  198,  322,  560,  996, 1000 },  // 15 mph
-  {   0,    0,    0,    0,    0,   79,  238,  552, 1000 },  // 20 mph
-  {   0,    0,    0,    0,    0,    0,   67,  285,  745 },  // 25 mph
-  {   0,    0,    0,    0,    0,    0,    0,    0,   26 }   // 50 mph
-};
-
-double stepFromPowerSpeed(double speedMph, double targetWatts) {
+static double legacyStepFromPowerSpeed(double speedMph, double targetWatts) {
   // Bounds check
   if ((speedMph < gErgSpeedAxis[0]) || (speedMph > gErgSpeedAxis[Xcountw - 1])) {
-    Serial.println("[ERG] Speed out of range");
     return 0;
   }
 
   if ((targetWatts < gErgPowerAxis[0]) || (targetWatts > gErgPowerAxis[Ycountw - 1])) {
-    Serial.println("[ERG] Power out of range");
     return 0;
   }
 
@@ -267,38 +554,13 @@ double stepFromPowerSpeed(double speedMph, double targetWatts) {
   return position;
 }
 
-// ==================== SIM MODE: STEP FROM GRADE/SPEED ====================
-
-// SIM mode calibration: Speed grid (mph) - FIXED AXIS
-double gSimSpeedAxis[8] = { 0, 5, 10, 15, 20, 25, 30, 50 };
-// SIM mode calibration: Grade grid (percent) - FIXED AXIS
-double gSimGradeAxis[7] = { -4, 0, 2, 4, 6, 8, 10 };
-
-static const int Xcountstep = 8;
-static const int Ycountstep = 7;
-
-// SIM mode table: [speed][grade] = position
-// Default values - can be modified via web UI and saved to NVS
-double gSimTable[8][7] = {
-  {   0,  167,  333,  500,  667,  833, 1000 },  // 0 mph
-  {   0,  167,  333,  500,  667,  833, 1000 },  // 5 mph
-  {   0,  167,  333,  500,  667,  833, 1000 },  // 10 mph
-  {   0,  167,  333,  500,  667,  833, 1000 },  // 15 mph
-  {   0,  167,  333,  500,  667,  833, 1000 },  // 20 mph
-  { 167,  333,  500,  677,  834, 1000, 1000 },  // 25 mph
-  { 333,  500,  677,  834, 1000, 1000, 1000 },  // 30 mph
-  { 500,  500,  677,  834, 1000, 1000, 1000 }   // 50 mph
-};
-
-double gradeToSteps(double speedMph, double gradePercent) {
+static double legacyGradeToSteps(double speedMph, double gradePercent) {
   // Bounds check
   if ((speedMph < gSimSpeedAxis[0]) || (speedMph > gSimSpeedAxis[Xcountstep - 1])) {
-    Serial.println("[SIM] Speed out of range");
     return 500;  // Default to mid position
   }
 
   if ((gradePercent < gSimGradeAxis[0]) || (gradePercent > gSimGradeAxis[Ycountstep - 1])) {
-    Serial.println("[SIM] Grade out of range");
     // Clamp instead of returning 0
     gradePercent = constrain(gradePercent, gSimGradeAxis[0], gSimGradeAxis[Ycountstep - 1]);
   }
@@ -339,34 +601,244 @@ double gradeToSteps(double speedMph, double gradePercent) {
   return position;
 }
 
+static volatile float gBenchSink = 0;
+
+void sensorsBenchmarkLookups() {
+  static const int N = 1000;
+  uint32_t t0, legacyCycles, lutCycles;
+  float maxErr;
+
+  Serial.println("[BENCH] Lookup cycles/call (legacy double vs fixed-point):");
+
+  // Power: speed 0..50 mph x position 0..1000
+  maxErr = 0;
+  t0 = ESP.getCycleCount();
+  for (int i = 0; i < N; i++) gBenchSink = (float)legacyPowerFromSpeedPos((i % 500) * 0.1, (i * 7) % 1001);
+  legacyCycles = ESP.getCycleCount() - t0;
+  t0 = ESP.getCycleCount();
+  for (int i = 0; i < N; i++) gBenchSink = powerFromSpeedPos((i % 500) * 0.1f, (float)((i * 7) % 1001));
+  lutCycles = ESP.getCycleCount() - t0;
+  for (int i = 0; i < N; i++) {
+    float d = fabsf((float)legacyPowerFromSpeedPos((i % 500) * 0.1, (i * 7) % 1001) -
+                    powerFromSpeedPos((i % 500) * 0.1f, (float)((i * 7) % 1001)));
+    if (d > maxErr) maxErr = d;
+  }
+  Serial.printf("  powerFromSpeedPos:  %lu vs %lu  (max diff %.3f W)\n",
+                (unsigned long)(legacyCycles / N), (unsigned long)(lutCycles / N), maxErr);
+
+  // ERG: speed 0..50 mph x watts 0..1000
+  maxErr = 0;
+  t0 = ESP.getCycleCount();
+  for (int i = 0; i < N; i++) gBenchSink = (float)legacyStepFromPowerSpeed((i % 500) * 0.1, (i * 13) % 1001);
+  legacyCycles = ESP.getCycleCount() - t0;
+  t0 = ESP.getCycleCount();
+  for (int i = 0; i < N; i++) gBenchSink = stepFromPowerSpeed((i % 500) * 0.1f, (float)((i * 13) % 1001));
+  lutCycles = ESP.getCycleCount() - t0;
+  for (int i = 0; i < N; i++) {
+    float d = fabsf((float)legacyStepFromPowerSpeed((i % 500) * 0.1, (i * 13) % 1001) -
+                    stepFromPowerSpeed((i % 500) * 0.1f, (float)((i * 13) % 1001)));
+    if (d > maxErr) maxErr = d;
+  }
+  Serial.printf("  stepFromPowerSpeed: %lu vs %lu  (max diff %.3f)\n",
+                (unsigned long)(legacyCycles / N), (unsigned long)(lutCycles / N), maxErr);
+
+  // SIM: speed 0..50 mph x grade -4..10 %
+  maxErr = 0;
+  t0 = ESP.getCycleCount();
+  for (int i = 0; i < N; i++) gBenchSink = (float)legacyGradeToSteps((i % 500) * 0.1, -4.0 + (i % 141) * 0.1);
+  legacyCycles = ESP.getCycleCount() - t0;
+  t0 = ESP.getCycleCount();
+  for (int i = 0; i < N; i++) gBenchSink = gradeToSteps((i % 500) * 0.1f, -4.0f + (i % 141) * 0.1f);
+  lutCycles = ESP.getCycleCount() - t0;
+  for (int i = 0; i < N; i++) {
+    float d = fabsf((float)legacyGradeToSteps((i % 500) * 0.1, -4.0 + (i % 141) * 0.1) -
+                    gradeToSteps((i % 500) * 0.1f, -4.0f + (i % 141) * 0.1f));
+    if (d > maxErr) maxErr = d;
+  }
+  Serial.printf("  gradeToSteps:       %lu vs %lu  (max diff %.3f)\n",
+                (unsigned long)(legacyCycles / N), (unsigned long)(lutCycles / N), maxErr);
+}
+#endif // ENABLE_LUT_BENCHMARK
+
+// ==================== INERTIA COMPENSATION ====================
+
+// I * w * dw/dt in watts. Acceleration gets its own light smoothing here so
+// estimator noise is not multiplied by w into the reported power.
+static float inertiaPowerWatts(float rpm, float accelRpmS, float dtS) {
+  if (rpm <= 0.0f) {
+    gInertiaAccelFiltered = 0.0f;
+    return 0.0f;
+  }
+  gInertiaAccelFiltered += (dtS / (POWER_INERTIA_ACCEL_TAU_S + dtS)) * (accelRpmS - gInertiaAccelFiltered);
+
+  if (!gPowerInertiaEnabled) return 0.0f;
+  return gPowerInertia * (rpm * RPM_TO_RAD_S) * (gInertiaAccelFiltered * RPM_TO_RAD_S);
+}
+
+// Least-squares fit through the origin of tablePower = I * (-w * dw/dt)
+static void coastDownUpdate(float speedMph, float accelMphS, float rpm, float accelRpmS, float tableWatts) {
+  switch (gCoastState) {
+    case COAST_ARMED:
+      if (millis() - gCoastArmedMs > COAST_ARM_TIMEOUT_MS) {
+        gCoastState = COAST_FAILED;
+        LOG_W("COAST", "Timed out waiting for coast-down");
+      } else if (speedMph >= COAST_START_MPH && accelMphS <= -COAST_MIN_DECEL_MPH_S) {
+        gCoastSamples = 0;
+        gCoastSumXY = 0.0f;
+        gCoastSumXX = 0.0f;
+        gCoastState = COAST_RUNNING;
+        LOG_I("COAST", "Coast-down started at %.1f mph", speedMph);
+      }
+      break;
+
+    case COAST_RUNNING: {
+      if (accelMphS >= COAST_ABORT_ACCEL_MPH_S) {
+        gCoastState = COAST_FAILED;
+        LOG_W("COAST", "Aborted: pedaling detected");
+        break;
+      }
+      if (speedMph < COAST_END_MPH) {
+        float inertia = (gCoastSumXX > 0.0f) ? gCoastSumXY / gCoastSumXX : 0.0f;
+        if (gCoastSamples >= COAST_MIN_SAMPLES && inertia > 0.0f && inertia <= POWER_INERTIA_MAX) {
+          gCoastResult = inertia;
+          gCoastState = COAST_DONE;
+          LOG_I("COAST", "Done: I=%.4f kg*m^2 from %u samples", inertia, (unsigned)gCoastSamples);
+        } else {
+          gCoastState = COAST_FAILED;
+          LOG_W("COAST", "Fit rejected: I=%.4f from %u samples", inertia, (unsigned)gCoastSamples);
+        }
+        break;
+      }
+      const float x = -(rpm * RPM_TO_RAD_S) * (accelRpmS * RPM_TO_RAD_S);
+      if (x > 0.0f) {
+        gCoastSumXY += x * tableWatts;
+        gCoastSumXX += x * x;
+        gCoastSamples++;
+      }
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
+void coastDownStart() {
+  gCoastArmedMs = millis();
+  gCoastSamples = 0;
+  gCoastResult = 0.0f;
+  gCoastState = COAST_ARMED;
+  LOG_I("COAST", "Armed: spin up past %.0f mph, then stop pedaling", COAST_START_MPH);
+}
+
+void coastDownCancel() {
+  gCoastState = COAST_IDLE;
+}
+
+CoastDownState coastDownState() { return gCoastState; }
+uint16_t coastDownSamples() { return gCoastSamples; }
+float coastDownResult() { return gCoastResult; }
+
+const char* coastDownStateName(CoastDownState s) {
+  switch (s) {
+    case COAST_ARMED:   return "armed";
+    case COAST_RUNNING: return "running";
+    case COAST_DONE:    return "done";
+    case COAST_FAILED:  return "failed";
+    default:            return "idle";
+  }
+}
+
 // ==================== PUBLIC FUNCTIONS ====================
 
 void sensorsInit() {
+  // Build the fixed-point lookup engines (calibration may already have done this)
+  lutRebuild(CAL_TABLE_POWER);
+  lutRebuild(CAL_TABLE_ERG);
+  lutRebuild(CAL_TABLE_SIM);
+
   pinMode(HALL_PIN, INPUT_PULLUP);
   attachInterrupt(digitalPinToInterrupt(HALL_PIN), hallISR, FALLING);
   
   Serial.println("✓ Hall sensor initialized");
   Serial.printf("  Pulses per rev: %d\n", HALL_PULSES_PER_REV);
   Serial.printf("  Roller diameter: %.2f inches\n", ROLLER_DIAMETER_IN);
+
+#if ENABLE_LUT_BENCHMARK
+  sensorsBenchmarkLookups();
+#endif
 }
 
 void sensorsUpdate() {
-  // Read and filter RPM
+  // Read RPM and update the speed/acceleration estimate
   float rawRpm = readRPM();
-  currentRPM = filterRPM(rawRpm);
+  speedEstimatorUpdate(rawRpm);
+  currentRPM = gSpeedKf.rpm;
   
   // Convert to speed
   currentSpeedMph = rpmToMph(currentRPM);
+  currentAccelMphS = gSpeedKf.accel * RPM_TO_MPH;   // Signed: rpmToMph() clamps at 0
   
-  // Calculate power from speed and current stepper position
-  currentPowerWatts = powerFromSpeedPos(currentSpeedMph, (double)logStepPos);
+  // Calculate power from speed and current stepper position, plus the
+  // power going into (or coming back out of) the spinning rollers
+  const uint32_t nowUs = sensorsNowUs();
+  const float dtS = gLastPowerUs ? (nowUs - gLastPowerUs) * 1e-6f : 0.0f;
+  gLastPowerUs = nowUs;
+
+  const float posLogical = (gReplayActive && gReplayPos >= 0.0f) ? gReplayPos : (float)logStepPos;
+  float tableWatts = powerFromSpeedPos(currentSpeedMph, posLogical);
+  currentInertiaWatts = inertiaPowerWatts(currentRPM, gSpeedKf.accel, dtS);
+  currentPowerWatts = tableWatts + currentInertiaWatts;
+  if (currentPowerWatts < 0.0f) currentPowerWatts = 0.0f;
+
+  coastDownUpdate(currentSpeedMph, currentAccelMphS, currentRPM, gSpeedKf.accel, tableWatts);
   
   // Debug output (less frequent to avoid blocking web server)
   static uint32_t lastDebugMs = 0;
   if (millis() - lastDebugMs > 10000) {  // Changed from 5000 to 10000 (10 seconds)
     lastDebugMs = millis();
-    Serial.printf("[SENSORS] RPM: %.1f  Speed: %.1f mph  Power: %.0f W  Pos: %ld\n",
-                  currentRPM, currentSpeedMph, currentPowerWatts, logStepPos);
-    Serial.printf("[STATUS] BLE Connected: %s\n", deviceConnected ? "YES" : "NO");
+    LOG_I("SENSORS", "RPM: %.1f  Speed: %.1f mph  Power: %.0f W  Pos: %ld",
+          currentRPM, currentSpeedMph, currentPowerWatts, (long)logStepPos);
+    LOG_I("STATUS", "BLE Connected: %s", deviceConnected ? "YES" : "NO");
   }
 }
+
+// ==================== REPLAY ====================
+
+// Back to a standing start: no edges, filter and power history cleared
+static void sensorsResetState() {
+  gHallEdges = 0;
+  gHallRunStart = 0;
+  gLastAcceptedHallUs = 0;
+  speedEstimatorReset(0.0f, 0);
+  gInertiaAccelFiltered = 0.0f;
+  gLastPowerUs = 0;
+  currentRPM = currentSpeedMph = currentAccelMphS = 0.0f;
+  currentPowerWatts = currentInertiaWatts = 0.0f;
+}
+
+void sensorsReplayBegin(uint32_t nowUs) {
+  gReplayNowUs = nowUs;
+  gReplayPos = -1.0f;
+  gReplayActive = true;  // From here on hallISR() drops real edges
+  sensorsResetState();
+}
+
+void sensorsReplayEnd() {
+  sensorsResetState();
+  gReplayPos = -1.0f;
+  gReplayActive = false;
+}
+
+void sensorsReplaySetTime(uint32_t nowUs) {
+  gReplayNowUs = nowUs;
+}
+
+void sensorsReplayEdge(uint32_t edgeUs) {
+  gReplayNowUs = edgeUs;
+  hallAcceptEdge(edgeUs);
+}
+
+void sensorsReplaySetPosition(float posLogical) {
+  gReplayPos = posLogical;
+}
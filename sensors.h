@@ -11,7 +11,9 @@
 // ==================== SENSOR DATA ====================
 extern float currentRPM;
 extern float currentSpeedMph;
+extern float currentAccelMphS;   // Estimated d(speed)/dt from the speed estimator
 extern float currentPowerWatts;
+extern float currentInertiaWatts;  // Inertia term included in currentPowerWatts
 
 // ==================== FUNCTIONS ====================
 void sensorsInit();
@@ -19,19 +21,65 @@ void sensorsUpdate();
 
 // Hall sensor ISR (must be public for attachInterrupt)
 void IRAM_ATTR hallISR();
+uint32_t hallLastIntervalUs();  // Newest raw edge interval, us (0 = stopped)
+uint32_t hallEdgeCount();       // Accepted edges since boot (or replay reset)
 
 // Conversion functions
 float rpmToMph(float rpm);
 float mphToRpm(float mph);
 
 // Power calculation from speed and position
-double powerFromSpeedPos(double speedMph, double posLogical);
+float powerFromSpeedPos(float speedMph, float posLogical);
 
 // ERG mode: Calculate position from target power and current speed
-double stepFromPowerSpeed(double speedMph, double targetWatts);
+float stepFromPowerSpeed(float speedMph, float targetWatts);
 
 // SIM mode: Calculate position from grade and current speed
-double gradeToSteps(double speedMph, double gradePercent);
+float gradeToSteps(float speedMph, float gradePercent);
+
+// ==================== COAST-DOWN ====================
+// Measures gPowerInertia: with the rider coasting, table power is exactly
+// the power the spinning mass gives back, P = -I * w * dw/dt.
+enum CoastDownState : uint8_t {
+  COAST_IDLE = 0,
+  COAST_ARMED,       // Waiting for speed >= COAST_START_MPH and deceleration
+  COAST_RUNNING,     // Collecting samples
+  COAST_DONE,        // Result available (not applied until saved)
+  COAST_FAILED
+};
+
+void coastDownStart();
+void coastDownCancel();
+CoastDownState coastDownState();
+uint16_t coastDownSamples();
+float coastDownResult();          // Fitted inertia, kg*m^2 (valid when DONE)
+const char* coastDownStateName(CoastDownState s);
+
+// ==================== REPLAY ====================
+// Runs sensorsUpdate() on recorded input: while active, time comes from a
+// virtual clock, hallISR() ignores the real sensor and edges arrive through
+// sensorsReplayEdge(). Begin and end both reset to a standing start.
+void sensorsReplayBegin(uint32_t nowUs);
+void sensorsReplayEnd();
+void sensorsReplaySetTime(uint32_t nowUs);
+void sensorsReplayEdge(uint32_t edgeUs);           // Sets the clock to edgeUs
+void sensorsReplaySetPosition(float posLogical);   // Power at this position (< 0: logStepPos)
+
+// ==================== LOOKUP TABLE ENGINE ====================
+// The lookup functions above run on fixed-point copies of the tables below.
+// Rebuild after a whole table changes; update a point after a single edit.
+enum CalTable : uint8_t {
+  CAL_TABLE_POWER = 0,
+  CAL_TABLE_ERG,
+  CAL_TABLE_SIM
+};
+
+void lutRebuild(CalTable table);
+void lutUpdatePoint(CalTable table, int row, int col);
+
+#if ENABLE_LUT_BENCHMARK
+void sensorsBenchmarkLookups();   // Prints legacy vs fixed-point cycles/call
+#endif
 
 // ==================== CALIBRATION TABLE ACCESS ====================
 // These provide direct access to the calibration tables for the web UI
@@ -3,6 +3,11 @@
  */
 
 #include "stepper_control.h"
+#include "log.h"
+#include <driver/gpio.h>
+#include <esp_rom_sys.h>
+#include <esp_timer.h>
+#include <esp_system.h>
 
 // ==================== GLOBAL STATE ====================
 volatile ControlMode gMode = MODE_IDLE;
@@ -11,33 +16,63 @@ volatile int32_t logStepTarget = 0;
 volatile int32_t physStepPos = 0;
 volatile int32_t physStepTarget = 0;
 volatile bool gIsHoming = false;
+volatile HomingPhase gHomingPhase = HOME_IDLE;
 volatile bool gRehomeRequested = false;
 volatile bool gManualHoldActive = false;
 volatile int32_t gManualHoldTarget = 0;
 
 // ==================== STEPPER MOTION STATE ====================
-static float stepSpeedSps = DEFAULT_STEP_SPEED_SPS;
-static uint32_t stepIntervalUs = 400;  // will be updated
-static uint32_t lastStepUs = 0;
-
-// Direction tracking
-static int8_t gLastDir = 0;  // -1, 0, +1
-static bool gDirJustChanged = false;
-
-// Soft ramp parameters
+// S-curve profile parameters
 static float runSpeedSps = DEFAULT_STEP_SPEED_SPS;
 static float jogSpeedSps = HOMING_SPEED_SPS;
-static float rampStartSps = 900.0f;
-static float rampAccelSps2 = 6000.0f;
-static uint32_t rampLastUs = 0;
-static float rampCurSps = 900.0f;
-static int32_t slowZoneSteps = 200;
-static float slowZoneSps = 1000.0f;
+static float rampStartSps = 900.0f;     // Start/stop speed (no ramp needed below this)
+static float rampAccelSps2 = 6000.0f;   // Max acceleration/deceleration
+static float rampJerkSps3 = 200000.0f;  // Max jerk (accel ramps 0 -> max in 30 ms)
+
+// ==================== STEP TIMER ENGINE ====================
+// Step pulses are generated by a hardware timer ISR, so the configured speed
+// and ramp hold no matter how long loop() spends in the web server or BLE.
+// The alarm auto-reloads, so each alarm value is the interval to the NEXT step.
+// Speed is tracked as v^2 (steps^2/s^2): each step at constant acceleration
+// adds exactly 2*a to v^2, which keeps the ISR in integer math.
+//
+// The planner re-plans every step against the live physStepTarget, so a
+// target that moves mid-move just changes the remaining distance and the
+// profile blends without restarting. Acceleration itself is slewed by the
+// jerk limit (S-curve). Each step compares the remaining distance with the
+// jerk-limited stopping distance and picks accelerate, cruise or brake. A
+// reversal first brakes to the start speed, then turns around.
+static const uint32_t STEP_TIMER_HZ = 1000000;     // 1 us resolution
+static const uint32_t STEP_IDLE_TICK_US = 1000;    // Poll rate while not moving
+static const uint32_t STEP_PULSE_US = 2;           // DRV8825 needs >= 1.9 us high
+static const uint32_t STEP_DIR_SETUP_US = 1;       // DRV8825 needs >= 650 ns
+
+static hw_timer_t* gStepTimer = NULL;
+static portMUX_TYPE gStepMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Profile (written by stepperApplyProfile, read by ISR)
+static volatile uint32_t gEngRunSps2 = 0;
+static volatile uint32_t gEngStartSps2 = 0;
+static volatile int32_t gEngAccelMax = 0;          // 2*a_max: max change of v^2 per step
+static volatile uint32_t gEngJerk2 = 0;            // 2*j_max (steps/s^3)
+static volatile uint32_t gEngJerkTimeUs = 0;       // a_max / j_max
+static volatile uint32_t gEngJogUs = 1250;         // Homing step interval
+
+// ISR motion state
+static volatile int8_t gEngDir = 0;                // -1, 0, +1 (0 = restart ramp)
+static volatile uint32_t gEngSps2 = 0;             // Current speed squared
+static volatile int32_t gEngAccel = 0;             // Current 2*a (signed change of v^2 per step)
+static volatile uint32_t gEngLastUs = STEP_IDLE_TICK_US;  // Interval that just elapsed
+
+// Pulse timing instrumentation
+volatile uint32_t gStepGapMaxUs = 0;
+volatile uint32_t gStepLateMaxUs = 0;
+static volatile uint32_t gPulseLastUs = 0;
+static volatile bool gPulseRun = false;            // Previous tick also stepped
 
 // Enable/disable state
 static const bool STEPPER_DIR_INVERT = false;
 volatile bool gStepEn = false;  // Non-static so web_server can access it
-static bool gStepperAutoDisabled = false;
 
 // Speed-based disable
 static const float SPEED_DISABLE_MPH = 2.0f;
@@ -61,12 +96,63 @@ static uint32_t gLimitLastChangeMs = 0;
 static uint32_t gLastLimitTripMs = 0;
 static const uint32_t REHOME_COOLDOWN_MS = 2000;
 
+// Homing phase limits (step counts keep timeouts independent of loop load)
+static const uint32_t HOME_SETTLE_US = 60000;          // Debounce settle before deciding
+static const uint32_t HOME_BACKOFF_MAX_STEPS = 1600;   // ~2 s at HOMING_SPEED_SPS
+static const uint32_t HOME_SEEK_MAX_STEPS = 8000;      // ~10 s at HOMING_SPEED_SPS
+static const uint32_t HOME_RELEASE_STEPS = 100;        // Final back-off from the switch
+
+// Homing phase state (ISR-owned while gHomingPhase != HOME_IDLE)
+static volatile uint32_t gHomePhaseUs = 0;
+static volatile uint32_t gHomePhaseSteps = 0;
+static volatile uint32_t gHomeStableUs = 0;
+static volatile uint8_t gHomeLimitRaw = 1;
+static volatile uint8_t gHomeLimitStable = 1;
+static HomingPhase gHomeLoggedPhase = HOME_IDLE;
+static volatile uint32_t gHomeBackoffSteps = 0;        // Steps taken in BACKOFF / SEEK,
+static volatile uint32_t gHomeSeekSteps = 0;           // for the warm-boot verify
+
+// ==================== WARM BOOT RECORD ====================
+// RTC memory keeps its contents across every reset but a power cycle. The
+// record is valid only while the position is known and the motor is not
+// stepping: the ISR clears it when a move starts, stepperUpdate() rewrites
+// it once motion stops. That costs a few RAM writes, no flash wear.
+struct WarmBootRecord {
+  uint32_t magic;
+  int32_t physPos;
+  uint32_t check;   // magic ^ physPos ^ WARM_CHECK_XOR
+};
+static RTC_NOINIT_ATTR WarmBootRecord gWarmRecord;
+static const uint32_t WARM_MAGIC = 0x574D4231;       // "WMB1"
+static const uint32_t WARM_CHECK_XOR = 0xA5C3965A;
+
+static bool gPositionKnown = false;       // Homed, or restored from the record
+static StepperBootInfo gBoot = {};
+static bool gVerifyActive = false;        // Current homing is the warm-boot touch
+static int32_t gVerifyFromPos = 0;
+
 // ==================== HELPER FUNCTIONS ====================
 
 static inline int32_t iabs32(int32_t v) {
   return (v < 0) ? -v : v;
 }
 
+static inline uint32_t IRAM_ATTR isqrt32(uint32_t v) {
+  uint32_t res = 0;
+  uint32_t bit = 1UL << 30;
+  while (bit > v) bit >>= 2;
+  while (bit != 0) {
+    if (v >= res + bit) {
+      v -= res + bit;
+      res = (res >> 1) + bit;
+    } else {
+      res >>= 1;
+    }
+    bit >>= 2;
+  }
+  return res;
+}
+
 static inline uint32_t spsToIntervalUs(float sps) {
   if (sps < 50.0f) sps = 50.0f;
   if (sps > 5000.0f) sps = 5000.0f;
@@ -93,36 +179,302 @@ static inline bool limitPressed() {
 // Speed-based enable state
 static bool gSpeedBasedDisabled = false;
 
-static inline void stepperPulseOnce() {
-  digitalWrite(STEP_PIN, HIGH);
-  delayMicroseconds(2);
-  digitalWrite(STEP_PIN, LOW);
-  delayMicroseconds(stepIntervalUs);
-}
-
-static inline void stepperSetDir(bool forward) {
+static inline void IRAM_ATTR stepperSetDir(bool forward) {
   bool pinLevel = forward;
   if (STEPPER_DIR_INVERT) pinLevel = !pinLevel;
-  digitalWrite(DIR_PIN, pinLevel ? HIGH : LOW);
+  gpio_set_level((gpio_num_t)DIR_PIN, pinLevel ? 1 : 0);
 }
 
-static void stepperSetSpeed(float sps) {
-  if (sps < 50) sps = 50;
-  if (sps > 4000) sps = 4000;
-  
-  runSpeedSps = sps;
-  stepSpeedSps = sps;
-  stepIntervalUs = spsToIntervalUs(sps);
-  
-  Serial.printf("[STEP] speed=%.1f sps interval=%lu us\n", runSpeedSps, (unsigned long)stepIntervalUs);
+static inline void IRAM_ATTR stepperPulse() {
+  gpio_set_level((gpio_num_t)STEP_PIN, 1);
+  esp_rom_delay_us(STEP_PULSE_US);
+  gpio_set_level((gpio_num_t)STEP_PIN, 0);
 }
 
-static void stepperSetJogSpeed() {
-  stepperSetSpeed(jogSpeedSps);
+// Push the float ramp parameters into the integer form the ISR uses
+static void stepperApplyProfile() {
+  float run = constrain(runSpeedSps, 50.0f, 4000.0f);
+  float start = constrain(rampStartSps, 50.0f, run);
+  float accel = constrain(rampAccelSps2, 100.0f, 100000.0f);
+  float jerk = constrain(rampJerkSps3, accel, 1000000.0f);
+
+  portENTER_CRITICAL(&gStepMux);
+  gEngRunSps2 = (uint32_t)(run * run);
+  gEngStartSps2 = (uint32_t)(start * start);
+  gEngAccelMax = (int32_t)(2.0f * accel);
+  gEngJerk2 = (uint32_t)(2.0f * jerk);
+  gEngJerkTimeUs = (uint32_t)(1e6f * accel / jerk);
+  gEngJogUs = spsToIntervalUs(jogSpeedSps);
+  gEngDir = 0;
+  gEngAccel = 0;
+  portEXIT_CRITICAL(&gStepMux);
+
+  Serial.printf("[STEP] profile: run=%.0f start=%.0f sps accel=%.0f jerk=%.0f, jog=%.0f sps\n",
+                run, start, accel, jerk, jogSpeedSps);
 }
 
-static void stepperSetRunSpeed() {
-  stepperSetSpeed(runSpeedSps);
+// ==================== STEP TIMER ISR ====================
+
+// Steps needed to get from the current state down to the start speed with
+// jerk-limited braking. While a positive acceleration slews back to zero
+// (n = v*a/(2j) steps) the motor keeps speeding up, adding about n*a/2 to
+// v^2; braking from there is the v^2 term at full decel plus v*Tj/2 for the
+// slew from 0 to -a_max. One step of margin covers integer rounding.
+static inline uint32_t IRAM_ATTR plannerStopSteps(uint32_t v2, uint32_t sps) {
+  uint32_t steps = 1;
+  if (gEngAccel > 0) {
+    const uint32_t a = (uint32_t)gEngAccel;
+    const uint32_t n = (sps * a) / gEngJerk2;
+    v2 += n * (a / 2);
+    steps += n;
+  }
+  if (v2 > gEngStartSps2) steps += (v2 - gEngStartSps2) / (uint32_t)gEngAccelMax;
+  steps += (sps * gEngJerkTimeUs) / 2000000;
+  return steps;
+}
+
+// Normal motion: returns the interval until the next tick
+static inline uint32_t IRAM_ATTR motionTick() {
+  const int32_t err = physStepTarget - physStepPos;
+
+  if (!gStepEn || (err == 0 && gEngSps2 <= gEngStartSps2)) {
+    gEngDir = 0;
+    gEngAccel = 0;
+    gPulseRun = false;
+    return STEP_IDLE_TICK_US;
+  }
+
+  int8_t dir = (err > 0) ? 1 : (err < 0) ? -1 : gEngDir;
+
+  // Reversal (or target reached) while still fast: keep going and brake first
+  const bool braking = (gEngDir != 0 && dir != gEngDir);
+  if (braking) {
+    if (gEngSps2 <= gEngStartSps2) {
+      dir = (err > 0) ? 1 : -1;
+      gEngDir = 0;                        // Slow enough: turn around below
+    } else {
+      dir = gEngDir;
+    }
+  }
+
+  // Start or reversal: restart the profile from rampStartSps
+  if (dir != gEngDir) {
+    if (err == 0) {
+      gEngDir = 0;
+      gEngAccel = 0;
+      gPulseRun = false;
+      return STEP_IDLE_TICK_US;
+    }
+    gWarmRecord.magic = 0;              // Moving: the record is stale until we stop
+    stepperSetDir(dir > 0);
+    esp_rom_delay_us(STEP_DIR_SETUP_US);
+    gEngDir = dir;
+    gEngSps2 = gEngStartSps2;
+    gEngAccel = 0;
+  }
+
+  stepperPulse();
+
+  // Gap since the previous pulse vs. the interval we programmed for it
+  const uint32_t nowUs = (uint32_t)esp_timer_get_time();
+  if (gPulseRun) {
+    const uint32_t gap = nowUs - gPulseLastUs;
+    if (gap > gStepGapMaxUs) gStepGapMaxUs = gap;
+    if (gap > gEngLastUs && gap - gEngLastUs > gStepLateMaxUs) gStepLateMaxUs = gap - gEngLastUs;
+  }
+  gPulseLastUs = nowUs;
+  gPulseRun = true;
+
+  int32_t pos = physStepPos + dir;
+  if (pos < PHYS_MIN_STEPS) pos = PHYS_MIN_STEPS;
+  if (pos > PHYS_MAX_STEPS) pos = PHYS_MAX_STEPS;
+  physStepPos = pos;
+  logStepPos = (int32_t)((int64_t)pos * LOGICAL_MAX / PHYS_MAX_STEPS);
+
+  // Plan the next step against the (possibly new) target
+  uint32_t v2 = gEngSps2;
+  uint32_t sps = isqrt32(v2);
+  if (sps == 0) sps = 1;
+  const int32_t remaining = braking ? -1 : (int32_t)dir * (physStepTarget - pos);
+  const uint32_t stopSteps = plannerStopSteps(v2, sps);
+  const uint32_t slewSteps = (sps * gEngJerkTimeUs) / 2000000;
+
+  int32_t accelGoal;
+  if (remaining <= (int32_t)stopSteps) {
+    accelGoal = -gEngAccelMax;                       // Brake
+  } else if (v2 >= gEngRunSps2 || remaining <= (int32_t)(stopSteps + slewSteps)) {
+    accelGoal = 0;                                   // Cruise
+  } else {
+    accelGoal = gEngAccelMax;                        // Speed up
+  }
+
+  // Jerk limit: per step, 2*a may change by 2*j*dt = 2*j/v
+  const int32_t jerkInc = (int32_t)(gEngJerk2 / sps);
+  int32_t accel = gEngAccel;
+  if (accel < accelGoal) {
+    accel = (accelGoal - accel > jerkInc) ? accel + jerkInc : accelGoal;
+  } else if (accel > accelGoal) {
+    accel = (accel - accelGoal > jerkInc) ? accel - jerkInc : accelGoal;
+  }
+
+  int64_t nv2 = (int64_t)v2 + accel;
+  if (nv2 >= (int64_t)gEngRunSps2) {
+    nv2 = gEngRunSps2;
+    if (accel > 0) accel = 0;
+  }
+  if (nv2 <= (int64_t)gEngStartSps2) {
+    nv2 = gEngStartSps2;
+    if (accel < 0) accel = 0;
+  }
+  gEngAccel = accel;
+  gEngSps2 = (uint32_t)nv2;
+
+  sps = isqrt32(gEngSps2);
+  return (sps > 0) ? (STEP_TIMER_HZ / sps) : STEP_IDLE_TICK_US;
+}
+
+static inline void IRAM_ATTR homeEnterPhase(HomingPhase phase) {
+  gHomingPhase = phase;
+  gHomePhaseUs = 0;
+  gHomePhaseSteps = 0;
+  if (phase == HOME_BACKOFF || phase == HOME_RELEASE) stepperSetDir(true);   // Away from switch
+  if (phase == HOME_SEEK) stepperSetDir(false);                              // Toward switch
+}
+
+// Homing: one phase-machine step per tick, returns the interval until the next tick
+static inline uint32_t IRAM_ATTR homingTick() {
+  const uint32_t elapsedUs = gEngLastUs;
+
+  // Debounce the limit input on the same clock that drives the pulses
+  uint8_t raw = (uint8_t)gpio_get_level((gpio_num_t)LIMIT_PIN);
+  if (raw != gHomeLimitRaw) {
+    gHomeLimitRaw = raw;
+    gHomeStableUs = 0;
+  } else if (gHomeStableUs < LIMIT_DEBOUNCE_MS * 1000) {
+    gHomeStableUs += elapsedUs;
+  } else {
+    gHomeLimitStable = raw;
+  }
+  const bool pressed = (gHomeLimitStable == 0);
+
+  switch (gHomingPhase) {
+    case HOME_SETTLE:
+      gHomePhaseUs += elapsedUs;
+      if (gHomePhaseUs >= HOME_SETTLE_US) {
+        homeEnterPhase(pressed ? HOME_BACKOFF : HOME_SEEK);
+      }
+      return STEP_IDLE_TICK_US;
+
+    case HOME_BACKOFF:
+      if (!pressed || gHomePhaseSteps >= HOME_BACKOFF_MAX_STEPS) {
+        gHomeBackoffSteps = gHomePhaseSteps;
+        homeEnterPhase(HOME_SEEK);
+        return STEP_IDLE_TICK_US;
+      }
+      stepperPulse();
+      gHomePhaseSteps++;
+      return gEngJogUs;
+
+    case HOME_SEEK:
+      if (pressed) {
+        gHomeSeekSteps = gHomePhaseSteps;
+        homeEnterPhase(HOME_RELEASE);
+        return STEP_IDLE_TICK_US;
+      }
+      if (gHomePhaseSteps >= HOME_SEEK_MAX_STEPS) {
+        gHomingPhase = HOME_FAILED;
+        return STEP_IDLE_TICK_US;
+      }
+      stepperPulse();
+      gHomePhaseSteps++;
+      return gEngJogUs;
+
+    case HOME_RELEASE:
+      if (gHomePhaseSteps >= HOME_RELEASE_STEPS) {
+        // Set zero position
+        physStepPos = PHYS_MIN_STEPS;
+        physStepTarget = PHYS_MIN_STEPS;
+        logStepPos = (int32_t)((int64_t)PHYS_MIN_STEPS * LOGICAL_MAX / PHYS_MAX_STEPS);
+        logStepTarget = logStepPos;
+        gEngDir = 0;
+        gHomingPhase = HOME_DONE;
+        return STEP_IDLE_TICK_US;
+      }
+      stepperPulse();
+      gHomePhaseSteps++;
+      return gEngJogUs;
+
+    default:
+      // HOME_DONE / HOME_FAILED: wait for stepperUpdate() to finish up
+      return STEP_IDLE_TICK_US;
+  }
+}
+
+static void IRAM_ATTR stepTimerISR() {
+  portENTER_CRITICAL_ISR(&gStepMux);
+  uint32_t nextUs;
+  if (gHomingPhase != HOME_IDLE) {
+    gPulseRun = false;  // Jog pulses are not part of the gap statistics
+    nextUs = homingTick();
+  } else {
+    nextUs = motionTick();
+  }
+  gEngLastUs = nextUs;
+  portEXIT_CRITICAL_ISR(&gStepMux);
+
+  timerAlarm(gStepTimer, nextUs, true, 0);
+}
+
+// Logs homing progress and finalizes DONE/FAILED (task context)
+static void stepperHomeService() {
+  const HomingPhase phase = gHomingPhase;
+  if (phase == gHomeLoggedPhase) return;
+  gHomeLoggedPhase = phase;
+
+  switch (phase) {
+    case HOME_BACKOFF:
+      LOG_I("HOME", "Switch active; backing off...");
+      break;
+    case HOME_SEEK:
+      LOG_I("HOME", "Seeking switch...");
+      break;
+    case HOME_RELEASE:
+      LOG_I("HOME", "Backing off from switch...");
+      break;
+    case HOME_DONE:
+    case HOME_FAILED:
+      // Resync the task-side debounce so the released switch isn't seen as a new trip
+      gLimitRawLast = gHomeLimitRaw;
+      gLimitStable = gHomeLimitRaw;
+      gLimitLastChangeMs = millis();
+
+      gHomingPhase = HOME_IDLE;
+      gHomeLoggedPhase = HOME_IDLE;
+      gIsHoming = false;
+
+      if (phase == HOME_FAILED) {
+        gPositionKnown = false;
+        LOG_E("HOME", "FAILED - timeout");
+      } else {
+        gRehomeRequested = false;
+        gPositionKnown = true;
+        if (gBoot.homedMs == 0) gBoot.homedMs = millis() ? millis() : 1;
+        LOG_I("HOME", "Complete (phys=%ld log=%ld)", (long)physStepPos, (long)logStepPos);
+
+        if (gVerifyActive) {
+          // The switch closes HOME_RELEASE_STEPS below zero; where the restored
+          // position put that point is the error it carried
+          const int32_t found = gVerifyFromPos + (int32_t)gHomeBackoffSteps - (int32_t)gHomeSeekSteps;
+          gBoot.verified = true;
+          gBoot.verifyErrorSteps = found - (PHYS_MIN_STEPS - (int32_t)HOME_RELEASE_STEPS);
+          LOG_I("HOME", "Warm-boot position verified, error %ld steps", (long)gBoot.verifyErrorSteps);
+        }
+      }
+      gVerifyActive = false;
+      break;
+    default:
+      break;
+  }
 }
 
 static void updateStepperEnableFromError() {
@@ -158,6 +510,41 @@ static void updateStepperEnableFromError() {
   }
 }
 
+// Keeps the warm-boot record in step with the position (task context)
+static void warmRecordUpdate() {
+  if (!gPositionKnown || gIsHoming) return;
+
+  portENTER_CRITICAL(&gStepMux);
+  const int32_t pos = physStepPos;
+  if (gEngDir == 0 && gHomingPhase == HOME_IDLE &&
+      (gWarmRecord.magic != WARM_MAGIC || gWarmRecord.physPos != pos)) {
+    gWarmRecord.physPos = pos;
+    gWarmRecord.check = WARM_MAGIC ^ (uint32_t)pos ^ WARM_CHECK_XOR;
+    gWarmRecord.magic = WARM_MAGIC;
+  }
+  portEXIT_CRITICAL(&gStepMux);
+}
+
+// Touches the switch after a crash/brownout boot once the carriage is parked
+// near it anyway, so the check costs a fraction of a second of travel
+static void warmVerifyService() {
+  if (!gBoot.verifyPending || gIsHoming || gRehomeRequested || gManualHoldActive) return;
+  if (gEngDir != 0 || physStepPos > WARM_VERIFY_MAX_STEPS) return;
+
+  gBoot.verifyPending = false;
+  gVerifyActive = true;
+  gVerifyFromPos = physStepPos;
+  LOG_I("HOME", "Verifying warm-boot position (phys=%ld)", (long)gVerifyFromPos);
+  stepperHomeStart();
+}
+
+static bool warmRecordValid() {
+  const WarmBootRecord r = gWarmRecord;
+  return r.magic == WARM_MAGIC &&
+         r.check == (WARM_MAGIC ^ (uint32_t)r.physPos ^ WARM_CHECK_XOR) &&
+         r.physPos >= PHYS_MIN_STEPS && r.physPos <= PHYS_MAX_STEPS;
+}
+
 // ==================== PUBLIC FUNCTIONS ====================
 
 void stepperInit() {
@@ -170,7 +557,16 @@ void stepperInit() {
   digitalWrite(DIR_PIN, LOW);
   digitalWrite(ENABLE_PIN, HIGH);  // Disabled
   
-  stepperSetRunSpeed();
+  stepperApplyProfile();
+
+  // Start the step timer (idles at STEP_IDLE_TICK_US until there is work)
+  gStepTimer = timerBegin(STEP_TIMER_HZ);
+  if (gStepTimer == NULL) {
+    Serial.println("[STEP] ERROR: step timer allocation failed");
+  } else {
+    timerAttachInterrupt(gStepTimer, &stepTimerISR);
+    timerAlarm(gStepTimer, STEP_IDLE_TICK_US, true, 0);
+  }
   
   Serial.println("✓ Stepper initialized");
 }
@@ -180,86 +576,28 @@ void stepperEnable(bool en) {
   digitalWrite(ENABLE_PIN, en ? LOW : HIGH);
   
   if (en) {
-    // Reset ramp timing for gentle start
-    gLastDir = 0;
-    rampCurSps = min(rampStartSps, runSpeedSps);
-    rampLastUs = micros();
-    lastStepUs = 0;
+    // Restart the ISR ramp for a gentle start
+    gEngDir = 0;
+    gEngAccel = 0;
   }
   
-  Serial.printf("[STEP] enable=%s\n", en ? "ON" : "OFF");
+  LOG_I("STEP", "enable=%s", en ? "ON" : "OFF");
+}
+
+void stepperResetPulseStats() {
+  portENTER_CRITICAL(&gStepMux);
+  gStepGapMaxUs = 0;
+  gStepLateMaxUs = 0;
+  portEXIT_CRITICAL(&gStepMux);
 }
 
 void stepperUpdate() {
+  // Housekeeping only - pulses and homing moves come from stepTimerISR()
   updateLimitDebounce();
+  stepperHomeService();
+  warmVerifyService();
   updateStepperEnableFromError();
-  
-  if (!gStepEn) return;
-  
-  // Calculate error
-  int32_t err = logStepTarget - logStepPos;
-  if (err == 0) return;
-  
-  // Determine direction
-  int8_t curDir = (err > 0) ? 1 : -1;
-  
-  // Check for direction change
-  if (curDir != gLastDir && gLastDir != 0) {
-    gDirJustChanged = true;
-    rampCurSps = rampStartSps;
-    rampLastUs = micros();
-  }
-  gLastDir = curDir;
-  
-  // Set direction
-  stepperSetDir(curDir > 0);
-  
-  // Determine speed (with ramp and slow zone)
-  float targetSps = runSpeedSps;
-  
-  // Slow down near target
-  int32_t absErr = iabs32(err);
-  if (absErr <= slowZoneSteps) {
-    targetSps = slowZoneSps;
-  }
-  
-  // Soft ramp after direction change
-  if (gDirJustChanged || rampCurSps < targetSps) {
-    uint32_t now = micros();
-    float dt = (now - rampLastUs) / 1000000.0f;
-    rampLastUs = now;
-    
-    rampCurSps += rampAccelSps2 * dt;
-    if (rampCurSps >= targetSps) {
-      rampCurSps = targetSps;
-      gDirJustChanged = false;
-    }
-    
-    stepIntervalUs = spsToIntervalUs(rampCurSps);
-  }
-  
-  // Step if interval elapsed
-  uint32_t nowUs = micros();
-  if (lastStepUs == 0 || (nowUs - lastStepUs) >= stepIntervalUs) {
-    lastStepUs = nowUs;
-    
-    // Take one step (non-blocking - just pulse)
-    digitalWrite(STEP_PIN, HIGH);
-    // Don't use delayMicroseconds here - let it pulse naturally
-    digitalWrite(STEP_PIN, LOW);
-    
-    // Update position
-    if (curDir > 0) {
-      physStepPos++;
-    } else {
-      physStepPos--;
-    }
-    logStepPos = stepsToLogical(physStepPos);
-    
-    // Constrain to limits
-    if (physStepPos < PHYS_MIN_STEPS) physStepPos = PHYS_MIN_STEPS;
-    if (physStepPos > PHYS_MAX_STEPS) physStepPos = PHYS_MAX_STEPS;
-  }
+  warmRecordUpdate();
 }
 
 void stepperSetTarget(int32_t logicalTarget) {
@@ -271,65 +609,93 @@ void stepperSetTarget(int32_t logicalTarget) {
   physStepTarget = logicalToSteps(logicalTarget);
 }
 
-void stepperHome() {
-  Serial.println("[HOME] Starting homing...");
+// The step engine drives on the physical target: stepperSetTarget(logStepPos)
+// can land a step off (both conversions truncate) and is not atomic with the ISR
+void stepperHold() {
+  portENTER_CRITICAL(&gStepMux);
+  physStepTarget = physStepPos;
+  logStepTarget = logStepPos;
+  portEXIT_CRITICAL(&gStepMux);
+}
+
+void stepperHomeStart() {
+  if (gIsHoming) return;
+
+  LOG_I("HOME", "Starting homing...");
   gIsHoming = true;
   stepperEnable(true);
-  stepperSetJogSpeed();
-  
-  // Settle debounce
-  for (int i = 0; i < 30; i++) {
-    updateLimitDebounce();
-    delay(2);
-  }
-  
-  // If switch already pressed, back off
-  if (limitPressed()) {
-    Serial.println("[HOME] Switch active; backing off...");
-    stepperSetDir(true);  // Move away from switch
-    uint32_t t0 = millis();
-    while (limitPressed() && (millis() - t0) < 2000) {
-      stepperPulseOnce();
-      updateLimitDebounce();
-      delay(1);
-    }
-  }
-  
-  // Seek switch
-  Serial.println("[HOME] Seeking switch...");
-  stepperSetDir(false);  // Move toward switch
-  uint32_t t0 = millis();
-  while (!limitPressed() && (millis() - t0) < 10000) {
-    stepperPulseOnce();
-    updateLimitDebounce();
-    delay(1);
-  }
-  
-  if (!limitPressed()) {
-    Serial.println("[HOME] FAILED - timeout");
-    gIsHoming = false;
+
+  portENTER_CRITICAL(&gStepMux);
+  gWarmRecord.magic = 0;
+  gHomeBackoffSteps = 0;
+  gHomeSeekSteps = 0;
+  gHomeLimitRaw = (uint8_t)digitalRead(LIMIT_PIN);
+  gHomeLimitStable = gHomeLimitRaw;
+  gHomeStableUs = 0;
+  homeEnterPhase(HOME_SETTLE);
+  portEXIT_CRITICAL(&gStepMux);
+}
+
+void stepperBootHome() {
+  const esp_reset_reason_t reason = esp_reset_reason();
+  gBoot = StepperBootInfo();
+  gBoot.resetReason = (uint8_t)reason;
+  gVerifyActive = false;
+
+  // Resets that leave the motor where the record says. After a crash or a
+  // brownout the position is still trusted, but touched once to confirm.
+  const bool verify = (reason == ESP_RST_PANIC || reason == ESP_RST_INT_WDT ||
+                       reason == ESP_RST_TASK_WDT || reason == ESP_RST_WDT ||
+                       reason == ESP_RST_BROWNOUT);
+  const bool warm = verify || reason == ESP_RST_SW || reason == ESP_RST_DEEPSLEEP;
+  const bool valid = warmRecordValid();
+  const bool pressed = digitalRead(LIMIT_PIN) == LOW;
+
+  if (warm && valid && !pressed) {
+    const int32_t pos = gWarmRecord.physPos;
+    portENTER_CRITICAL(&gStepMux);
+    physStepPos = pos;
+    physStepTarget = pos;
+    logStepPos = stepsToLogical(pos);
+    logStepTarget = logStepPos;
+    gEngDir = 0;
+    portEXIT_CRITICAL(&gStepMux);
+
+    gPositionKnown = true;
+    gBoot.homing = BOOT_HOME_TRUSTED;
+    gBoot.restoredPos = pos;
+    gBoot.homedMs = millis() ? millis() : 1;
+    gBoot.verifyPending = verify;
+    Serial.printf("✓ Warm boot (%s): position restored (phys=%ld log=%ld)%s\n",
+                  stepperResetReasonName(reason), (long)pos, (long)logStepPos,
+                  verify ? ", switch touch when parked" : "");
     return;
   }
-  
-  // Back off slightly
-  Serial.println("[HOME] Backing off from switch...");
-  stepperSetDir(true);
-  for (int i = 0; i < 100; i++) {
-    stepperPulseOnce();
+
+  gPositionKnown = false;
+  gBoot.homing = BOOT_HOME_FULL;
+  Serial.printf("[HOME] Homing in the background (%s%s)\n", stepperResetReasonName(reason),
+                !warm ? "" : !valid ? ", no saved position" : ", switch pressed");
+  stepperHomeStart();
+}
+
+void stepperGetBootInfo(StepperBootInfo* out) {
+  *out = gBoot;
+}
+
+const char* stepperResetReasonName(uint8_t reason) {
+  switch (reason) {
+    case ESP_RST_POWERON:   return "power-on";
+    case ESP_RST_EXT:       return "external";
+    case ESP_RST_SW:        return "software";
+    case ESP_RST_PANIC:     return "panic";
+    case ESP_RST_INT_WDT:   return "interrupt watchdog";
+    case ESP_RST_TASK_WDT:  return "task watchdog";
+    case ESP_RST_WDT:       return "watchdog";
+    case ESP_RST_DEEPSLEEP: return "deep sleep";
+    case ESP_RST_BROWNOUT:  return "brownout";
+    default:                return "unknown";
   }
-  
-  // Set zero position
-  physStepPos = PHYS_MIN_STEPS;
-  logStepPos = stepsToLogical(physStepPos);
-  logStepTarget = logStepPos;
-  physStepTarget = physStepPos;
-  
-  stepperSetRunSpeed();
-  gIsHoming = false;
-  gRehomeRequested = false;
-  
-  Serial.println("[HOME] Complete");
-  Serial.printf("  Position: phys=%ld log=%ld\n", physStepPos, logStepPos);
 }
 
 // ==================== CONVERSION FUNCTIONS ====================
@@ -357,15 +723,17 @@ bool stepperLimitPressed() {
 void stepperRequestRehome(const char* reason) {
   uint32_t now = millis();
   if (gIsHoming) return;
+
+  // Freeze motion immediately (prevents driving into the switch), also
+  // inside the cooldown when no new homing starts
+  stepperHold();
+
   if (now - gLastLimitTripMs < REHOME_COOLDOWN_MS) return;
 
   gLastLimitTripMs = now;
   gRehomeRequested = true;
 
-  // Freeze motion immediately (prevents driving into the switch)
-  logStepTarget = logStepPos;
-
-  Serial.printf("[SAFETY] Limit hit -> rehome requested (%s)\n", reason);
+  LOG_W("SAFETY", "Limit hit -> rehome requested (%s)", reason);
 }
 
 void stepperUpdateSpeedBasedEnable(float speedMph) {
@@ -385,14 +753,14 @@ void stepperUpdateSpeedBasedEnable(float speedMph) {
       if (!gSpeedBasedDisabled) {
         gSpeedBasedDisabled = true;
         stepperEnable(false);
-        Serial.println("[STEP] Speed-based disable (below 2 mph)");
+        LOG_I("STEP", "Speed-based disable (below 2 mph)");
       }
     }
   } else if (speedMph > SPEED_ENABLE_MPH) {
     if (gSpeedBasedDisabled) {
       gSpeedBasedDisabled = false;
       stepperEnable(true);
-      Serial.println("[STEP] Speed-based enable (above 2.3 mph)");
+      LOG_I("STEP", "Speed-based enable (above 2.3 mph)");
     }
     gBelowSpeedSinceMs = 0;
   }
@@ -17,6 +17,41 @@ enum ControlMode : uint8_t {
 
 extern volatile ControlMode gMode;
 
+// ==================== HOMING PHASES ====================
+// Homing runs incrementally inside the step timer tick; gIsHoming is true
+// from stepperHomeStart() until the phase machine returns to HOME_IDLE.
+enum HomingPhase : uint8_t {
+  HOME_IDLE = 0,
+  HOME_SETTLE,     // Let the limit input debounce before deciding
+  HOME_BACKOFF,    // Switch already pressed: move away until released
+  HOME_SEEK,       // Move toward the switch until pressed
+  HOME_RELEASE,    // Back off a fixed distance, then set zero
+  HOME_DONE,       // Finished (stepperUpdate() finalizes)
+  HOME_FAILED      // Seek timed out (stepperUpdate() finalizes)
+};
+
+extern volatile HomingPhase gHomingPhase;
+
+// ==================== WARM BOOT ====================
+// The position is kept in RTC memory while the motor is settled. A warm
+// reset (software, watchdog, panic, brownout) restores it instead of homing;
+// after a crash or brownout the switch is touched once the carriage is next
+// parked near it (within WARM_VERIFY_MAX_STEPS).
+enum BootHoming : uint8_t {
+  BOOT_HOME_FULL = 0,   // Power-on, reset button, no valid record or switch pressed
+  BOOT_HOME_TRUSTED     // Position restored from the warm-boot record
+};
+
+struct StepperBootInfo {
+  BootHoming homing;
+  uint8_t resetReason;        // esp_reset_reason_t
+  int32_t restoredPos;        // Physical steps (trusted boot)
+  uint32_t homedMs;           // millis() when the position became known (0 = not yet)
+  bool verifyPending;         // Trusted, switch touch still to come
+  bool verified;              // Switch touch done
+  int32_t verifyErrorSteps;   // Restored minus found position at the touch
+};
+
 // ==================== STEPPER STATE ====================
 extern volatile int32_t logStepPos;
 extern volatile int32_t logStepTarget;
@@ -29,12 +64,21 @@ extern volatile bool gRehomeRequested;
 extern volatile bool gManualHoldActive;
 extern volatile int32_t gManualHoldTarget;
 
+// Pulse timing (measured in the step ISR during continuous motion)
+extern volatile uint32_t gStepGapMaxUs;    // Worst time between consecutive pulses
+extern volatile uint32_t gStepLateMaxUs;   // Worst gap beyond the programmed interval
+
 // ==================== FUNCTIONS ====================
 void stepperInit();
 void stepperUpdate();
 void stepperSetTarget(int32_t logicalTarget);
-void stepperHome();
+void stepperHold();        // Stop where it is (both targets to the current step)
+void stepperHomeStart();   // Non-blocking: progress is driven by the step timer
+void stepperBootHome();    // Boot: restore the warm-boot position, or start homing
+void stepperGetBootInfo(StepperBootInfo* out);
+const char* stepperResetReasonName(uint8_t reason);
 void stepperEnable(bool enable);
+void stepperResetPulseStats();
 
 // Safety functions
 void stepperRequestRehome(const char* reason);
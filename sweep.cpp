@@ -0,0 +1,281 @@
+/*
+ * sweep.cpp - Guided Power-Table Calibration Sweep Implementation
+ */
+
+#include "sweep.h"
+#include "power_meter.h"
+#include "calibration.h"
+#include "stepper_control.h"
+#include "trainer_state.h"
+#include "replay.h"
+#include "log.h"
+
+// ==================== STATE ====================
+static SweepStatus gStatus = {};
+static uint8_t gRows[POWER_TABLE_ROWS];   // Power-table rows swept, slowest first
+static uint8_t gRowCount = 0;
+static uint32_t gStateMs = 0;             // Entered the current state / settle restarted
+static uint32_t gCellStartMs = 0;
+static uint32_t gLastSampleMs = 0;
+
+// Current window
+static uint32_t gWinStartMs = 0;
+static float gWinSpeedSum = 0.0f;
+static uint16_t gWinSamples = 0;
+
+// Windows of the current cell: mean speed, mean meter power
+static float gPtSpeed[SWEEP_WINDOWS_PER_CELL];
+static float gPtWatts[SWEEP_WINDOWS_PER_CELL];
+
+static float gResult[POWER_TABLE_ROWS][POWER_TABLE_COLS];
+static bool gHasResult[POWER_TABLE_ROWS][POWER_TABLE_COLS];
+
+// ==================== SWEEP STEPS ====================
+
+static void releaseHold() {
+  gManualHoldActive = false;
+}
+
+static void fail(const char* why) {
+  gStatus.state = SWEEP_FAILED;
+  gStatus.error = why;
+  releaseHold();
+  LOG_W("SWEEP", "Stopped: %s", why);
+}
+
+static void startWindow(uint32_t now) {
+  gWinStartMs = now;
+  gWinSpeedSum = 0.0f;
+  gWinSamples = 0;
+  meterWindowReset();
+}
+
+static void beginCell(uint8_t cell, uint32_t now) {
+  gStatus.cell = cell;
+  gStatus.row = gRows[cell / POWER_TABLE_COLS];
+  gStatus.col = cell % POWER_TABLE_COLS;
+  gStatus.windows = 0;
+  gStatus.bandMph = (float)powerSpeedAxis(gStatus.row);
+  gStatus.position = constrain((int32_t)lround(powerPosAxis(gStatus.col)), LOGICAL_MIN, LOGICAL_MAX);
+
+  gManualHoldTarget = gStatus.position;
+  gManualHoldActive = true;
+  gStatus.state = SWEEP_SETTLE;
+  gStateMs = gCellStartMs = now;
+}
+
+static void nextCell(uint32_t now) {
+  if (gStatus.cell + 1 < gStatus.cells) {
+    beginCell(gStatus.cell + 1, now);
+    return;
+  }
+  gStatus.cell = gStatus.cells;
+  gStatus.state = SWEEP_DONE;
+  releaseHold();
+  LOG_I("SWEEP", "Done: %u cells fitted, %u skipped", (unsigned)gStatus.fitted, (unsigned)gStatus.skipped);
+}
+
+// Least-squares line through the windows, evaluated at the band speed. With
+// too little speed spread for a slope, scale the mean instead (at a fixed
+// magnet position the drag force changes slowly, so P ~ v near the band).
+static void fitCell() {
+  const int n = SWEEP_WINDOWS_PER_CELL;
+  const float band = gStatus.bandMph;
+  float meanV = 0.0f, meanP = 0.0f, minV = gPtSpeed[0], maxV = gPtSpeed[0];
+  for (int i = 0; i < n; i++) {
+    meanV += gPtSpeed[i];
+    meanP += gPtWatts[i];
+    minV = min(minV, gPtSpeed[i]);
+    maxV = max(maxV, gPtSpeed[i]);
+  }
+  meanV /= n;
+  meanP /= n;
+
+  float watts;
+  if (maxV - minV >= SWEEP_FIT_MIN_SPREAD_MPH) {
+    float sxy = 0.0f, sxx = 0.0f;
+    for (int i = 0; i < n; i++) {
+      sxy += (gPtSpeed[i] - meanV) * (gPtWatts[i] - meanP);
+      sxx += (gPtSpeed[i] - meanV) * (gPtSpeed[i] - meanV);
+    }
+    watts = meanP + (sxy / sxx) * (band - meanV);
+  } else {
+    watts = meanP * band / meanV;
+  }
+  watts = max(watts, 0.0f);
+
+  gResult[gStatus.row][gStatus.col] = watts;
+  gHasResult[gStatus.row][gStatus.col] = true;
+  gStatus.fitted++;
+  LOG_I("SWEEP", "%.0f mph @ %ld: %.0f W (%.1f-%.1f mph)", band, (long)gStatus.position,
+        watts, minV, maxV);
+}
+
+static bool cellTimedOut(uint32_t now) {
+  if (now - gCellStartMs < SWEEP_CELL_TIMEOUT_MS) return false;
+  gStatus.skipped++;
+  LOG_W("SWEEP", "%.0f mph @ %ld skipped: never steady", gStatus.bandMph, (long)gStatus.position);
+  nextCell(now);
+  return true;
+}
+
+static void measure(const TrainerSnapshot& s, uint32_t now) {
+  const bool steady = fabsf(s.speedMph - gStatus.bandMph) <= SWEEP_SPEED_TOL_MPH &&
+                      fabsf(s.accelMphS) <= SWEEP_ACCEL_MAX_MPH_S &&
+                      s.logPos == gStatus.position && s.logTarget == gStatus.position &&
+                      meterFresh();
+  if (!steady) {
+    startWindow(now);
+    return;
+  }
+
+  gWinSpeedSum += s.speedMph;
+  gWinSamples++;
+  if (now - gWinStartMs < SWEEP_WINDOW_MS) return;
+
+  float watts;
+  const uint16_t readings = meterWindowTake(&watts);
+  if (readings >= SWEEP_MIN_METER_SAMPLES) {
+    gPtSpeed[gStatus.windows] = gWinSpeedSum / gWinSamples;
+    gPtWatts[gStatus.windows] = watts;
+    gStatus.windows++;
+  }
+  startWindow(now);
+
+  if (gStatus.windows == SWEEP_WINDOWS_PER_CELL) {
+    fitCell();
+    nextCell(now);
+  }
+}
+
+// ==================== PUBLIC FUNCTIONS ====================
+
+bool sweepStart(const uint8_t* meterPeer) {
+  gStatus.error = NULL;
+  if (sweepActive()) return true;
+  if (replayActive()) {
+    gStatus.error = "replay running";
+    return false;
+  }
+  if (gIsHoming) {
+    gStatus.error = "homing";
+    return false;
+  }
+
+  gRowCount = 0;
+  for (int r = 0; r < POWER_TABLE_ROWS; r++) {
+    if (sweepBand(r)) gRows[gRowCount++] = (uint8_t)r;
+  }
+  memset(gHasResult, 0, sizeof(gHasResult));
+
+  const SweepState prev = gStatus.state;
+  gStatus = SweepStatus();
+  gStatus.state = prev;
+  gStatus.cells = (uint8_t)(gRowCount * POWER_TABLE_COLS);
+  if (gStatus.cells == 0) {
+    fail("no speed bands");
+    return false;
+  }
+
+  if (meterPeer != NULL || !meterFresh()) meterConnect(meterPeer);
+  gStatus.state = SWEEP_WAIT_METER;
+  gStateMs = millis();
+  LOG_I("SWEEP", "Started: %u cells, %.0f-%.0f mph", (unsigned)gStatus.cells,
+        powerSpeedAxis(gRows[0]), powerSpeedAxis(gRows[gRowCount - 1]));
+  return true;
+}
+
+void sweepCancel() {
+  if (!sweepActive()) return;
+  gStatus.state = SWEEP_IDLE;
+  releaseHold();
+  LOG_I("SWEEP", "Cancelled (%u cells fitted)", (unsigned)gStatus.fitted);
+}
+
+void sweepService() {
+  if (!sweepActive()) return;
+
+  TrainerSnapshot s;
+  trainerStateRead(&s);
+  if (s.ms == gLastSampleMs) return;
+  gLastSampleMs = s.ms;
+  const uint32_t now = s.ms;
+
+  if (gStatus.state == SWEEP_WAIT_METER) {
+    if (meterFresh()) {
+      LOG_I("SWEEP", "Meter reporting, first band %.0f mph", powerSpeedAxis(gRows[0]));
+      beginCell(0, now);
+    } else if (now - gStateMs > SWEEP_METER_WAIT_MS) {
+      fail("no power meter readings");
+    }
+    return;
+  }
+
+  if (!gManualHoldActive || gManualHoldTarget != gStatus.position) {
+    fail("manual hold taken over");
+    return;
+  }
+  gStatus.cellMs = now - gCellStartMs;
+  if (cellTimedOut(now)) return;
+
+  if (gStatus.state == SWEEP_SETTLE) {
+    if (s.logPos != gStatus.position || s.logTarget != gStatus.position || s.homing) {
+      gStateMs = now;   // Settle time counts from arrival
+    } else if (now - gStateMs >= SWEEP_SETTLE_MS) {
+      gStatus.state = SWEEP_MEASURE;
+      startWindow(now);
+    }
+    return;
+  }
+
+  measure(s, now);
+}
+
+bool sweepActive() {
+  return gStatus.state == SWEEP_WAIT_METER || gStatus.state == SWEEP_SETTLE ||
+         gStatus.state == SWEEP_MEASURE;
+}
+
+bool sweepBand(int row) {
+  const double mph = powerSpeedAxis(row);
+  return mph > 0.0 && mph <= SWEEP_MAX_MPH;
+}
+
+void sweepGetStatus(SweepStatus* out) {
+  *out = gStatus;
+}
+
+bool sweepResult(int row, int col, float* watts) {
+  if (row < 0 || row >= POWER_TABLE_ROWS || col < 0 || col >= POWER_TABLE_COLS) return false;
+  if (!gHasResult[row][col]) return false;
+  *watts = gResult[row][col];
+  return true;
+}
+
+int sweepApply() {
+  if (sweepActive()) return 0;
+  int applied = 0;
+  for (int r = 0; r < POWER_TABLE_ROWS; r++) {
+    for (int c = 0; c < POWER_TABLE_COLS; c++) {
+      if (!gHasResult[r][c]) continue;
+      powerTableSet(r, c, roundf(gResult[r][c]));
+      applied++;
+    }
+  }
+  if (applied) {
+    powerTableSave();
+    LOG_I("SWEEP", "Applied %d cells to the power table", applied);
+  }
+  return applied;
+}
+
+const char* sweepStateName(SweepState state) {
+  switch (state) {
+    case SWEEP_WAIT_METER: return "wait_meter";
+    case SWEEP_SETTLE:     return "settle";
+    case SWEEP_MEASURE:    return "measure";
+    case SWEEP_DONE:       return "done";
+    case SWEEP_FAILED:     return "failed";
+    default:               return "idle";
+  }
+}
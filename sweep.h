@@ -0,0 +1,59 @@
+/*
+ * sweep.h - Guided Power-Table Calibration Sweep
+ *
+ * Fills gPowerTable against a BLE Cycling Power meter in one ride. For each
+ * speed band (the power-table rows between 0 mph and SWEEP_MAX_MPH) the
+ * stepper is held at every position-axis point while the rider keeps the
+ * band speed. A window counts when it stays steady for SWEEP_WINDOW_MS:
+ * speed within SWEEP_SPEED_TOL_MPH of the band, no acceleration, stepper at
+ * its target and the meter reporting. Each cell is fitted from
+ * SWEEP_WINDOWS_PER_CELL windows (watts vs. speed, evaluated at the band).
+ *
+ * The sweep owns the manual hold while it runs; releasing the hold (or
+ * holding elsewhere) stops it. Results are not applied until sweepApply(),
+ * and cells that never settled keep their current table value.
+ */
+
+#ifndef SWEEP_H
+#define SWEEP_H
+
+#include <Arduino.h>
+#include "config.h"
+
+enum SweepState : uint8_t {
+  SWEEP_IDLE = 0,
+  SWEEP_WAIT_METER,     // Connecting / waiting for the first meter reading
+  SWEEP_SETTLE,         // Stepper moving to the cell position, then meter lag
+  SWEEP_MEASURE,        // Collecting steady windows
+  SWEEP_DONE,           // All cells visited (results not applied until sweepApply)
+  SWEEP_FAILED
+};
+
+struct SweepStatus {
+  SweepState state;
+  const char* error;    // Why it failed (NULL if it did not)
+  uint8_t cell;         // Current cell, band-major; == cells when finished
+  uint8_t cells;
+  uint8_t row, col;     // Power-table indices of the current cell
+  uint8_t windows;      // Steady windows collected for the current cell
+  uint8_t fitted;       // Cells with a result
+  uint8_t skipped;      // Cells that timed out
+  float bandMph;        // Speed to hold
+  int32_t position;     // Stepper position held
+  uint32_t cellMs;      // Time spent on the current cell
+};
+
+// ==================== FUNCTIONS ====================
+// loop() context. meterPeer NULL = keep the connected meter or use the first
+// one found. Refuses (false, status error set) during a replay or homing.
+bool sweepStart(const uint8_t* meterPeer);
+void sweepCancel();                     // Releases the hold, keeps fitted cells
+void sweepService();                    // loop(): advances on each new snapshot
+bool sweepActive();
+bool sweepBand(int row);                // Power-table row swept as a speed band
+void sweepGetStatus(SweepStatus* out);
+bool sweepResult(int row, int col, float* watts);   // false = no fit for this cell
+int sweepApply();                       // Fitted cells -> power table (saved); count
+const char* sweepStateName(SweepState state);
+
+#endif // SWEEP_H
@@ -0,0 +1,196 @@
+/*
+ * telemetry.cpp - Diagnostics Telemetry Serializer Implementation
+ */
+
+#include "telemetry.h"
+#include "stepper_control.h"
+#include "web_server.h"
+#include "ble_trainer.h"
+#include "erg_control.h"
+#include "log.h"
+#include "perf.h"
+#include "trainer_state.h"
+#include "sweep.h"
+#include "power_meter.h"
+#include "json_stream.h"
+
+// ==================== FIELD TABLE ====================
+enum TelemetryKind : uint8_t {
+  TK_BOOL,
+  TK_INT,
+  TK_FIXED,    // Decimal with `decimals` places
+  TK_MODE,     // ControlMode rendered as a string in JSON
+  TK_SWEEP     // SweepState rendered as a string in JSON
+};
+
+struct TelemetryFieldDef {
+  const char* name;
+  uint8_t kind;
+  uint8_t decimals;
+  uint8_t width;       // Bytes in binary frames (1, 2 or 4)
+};
+
+static const TelemetryFieldDef FIELDS[TF_COUNT] = {
+  {"ble",           TK_BOOL,  0, 1},
+  {"ble_cmd_drops", TK_INT,   0, 4},
+  {"log_drops",     TK_INT,   0, 4},
+  {"pos",           TK_INT,   0, 2},
+  {"target",        TK_INT,   0, 2},
+  {"mode",          TK_MODE,  0, 1},
+  {"manual_hold",   TK_BOOL,  0, 1},
+  {"enabled",       TK_BOOL,  0, 1},
+  {"speed",         TK_FIXED, 2, 2},
+  {"power",         TK_FIXED, 1, 4},
+  {"erg_watts",     TK_INT,   0, 2},
+  {"erg_ff",        TK_INT,   0, 2},
+  {"erg_corr",      TK_FIXED, 1, 2},
+  {"sim_grade",     TK_FIXED, 2, 2},
+  {"wifi_client",   TK_BOOL,  0, 1},
+  {"loop_max_us",   TK_INT,   0, 4},
+  {"step_gap_max_us", TK_INT, 0, 4},
+  {"heap_free",     TK_INT,   0, 4},
+  {"heap_largest",  TK_INT,   0, 4},
+  {"accel",         TK_FIXED, 2, 2},
+  {"sweep_state",   TK_SWEEP, 0, 1},
+  {"sweep_cell",    TK_INT,   0, 1},
+  {"sweep_windows", TK_INT,   0, 1},
+  {"meter",         TK_BOOL,  0, 1},
+  {"meter_power",   TK_INT,   0, 2},
+};
+
+static const int32_t POW10[] = {1, 10, 100, 1000};
+
+static inline int32_t quantize(float v, uint8_t decimals) {
+  return (int32_t)lroundf(v * (float)POW10[decimals]);
+}
+
+static const char* modeName(int32_t mode) {
+  switch (mode) {
+    case MODE_ERG: return "ERG";
+    case MODE_SIM: return "SIM";
+    default:       return "IDLE";
+  }
+}
+
+// ==================== PUBLIC FUNCTIONS ====================
+
+void telemetryCapture(TelemetryFrame* f) {
+  TrainerSnapshot snap;
+  trainerStateRead(&snap);
+
+  f->v[TF_BLE]           = deviceConnected ? 1 : 0;
+  f->v[TF_BLE_CMD_DROPS] = (int32_t)bleCommandsDropped();
+  f->v[TF_LOG_DROPS]     = (int32_t)logDroppedBytes();
+  f->v[TF_POS]           = snap.logPos;
+  f->v[TF_TARGET]        = snap.logTarget;
+  f->v[TF_MODE]          = (int32_t)snap.mode;
+  f->v[TF_MANUAL_HOLD]   = snap.manualHold ? 1 : 0;
+  f->v[TF_ENABLED]       = snap.stepEn ? 1 : 0;
+  f->v[TF_SPEED]         = quantize(snap.speedMph, FIELDS[TF_SPEED].decimals);
+  f->v[TF_POWER]         = quantize(snap.powerWatts, FIELDS[TF_POWER].decimals);
+  f->v[TF_ERG_WATTS]     = snap.ergTargetWatts;
+  f->v[TF_ERG_FF]        = (int32_t)lroundf(snap.ergFeedForward);
+  f->v[TF_ERG_CORR]      = quantize(snap.ergCorrection, FIELDS[TF_ERG_CORR].decimals);
+  f->v[TF_SIM_GRADE]     = quantize(snap.simGradePercent, FIELDS[TF_SIM_GRADE].decimals);
+  f->v[TF_WIFI_CLIENT]   = gWifiClientMode ? 1 : 0;
+  f->v[TF_LOOP_MAX_US]   = (int32_t)perfLoopPeriod().windowMax;
+  f->v[TF_STEP_GAP_MAX_US] = (int32_t)gStepGapMaxUs;
+  f->v[TF_HEAP_FREE]     = (int32_t)perfHeapFree();
+  f->v[TF_HEAP_LARGEST]  = (int32_t)perfHeapLargest();
+  f->v[TF_ACCEL]         = quantize(snap.accelMphS, FIELDS[TF_ACCEL].decimals);
+
+  SweepStatus sweep;
+  sweepGetStatus(&sweep);
+  MeterInfo meter;
+  meterGetInfo(&meter);
+  f->v[TF_SWEEP_STATE]   = (int32_t)sweep.state;
+  f->v[TF_SWEEP_CELL]    = sweep.cell;
+  f->v[TF_SWEEP_WINDOWS] = sweep.windows;
+  f->v[TF_METER]         = meterFresh() ? 1 : 0;
+  f->v[TF_METER_POWER]   = meter.watts;
+}
+
+size_t telemetryEncodeJson(const TelemetryFrame& cur, const TelemetryFrame* prev, char* out, size_t outSize) {
+  if (outSize < 3) return 0;
+
+  size_t n = 0;
+  out[n++] = '{';
+
+  for (int i = 0; i < TF_COUNT; i++) {
+    if (prev && prev->v[i] == cur.v[i]) continue;
+
+    const TelemetryFieldDef& fd = FIELDS[i];
+    const int32_t v = cur.v[i];
+    const char* sep = (n > 1) ? "," : "";
+    int w;
+
+    switch (fd.kind) {
+      case TK_BOOL:
+        w = snprintf(out + n, outSize - n, "%s\"%s\":%s", sep, fd.name, v ? "true" : "false");
+        break;
+      case TK_MODE:
+        w = snprintf(out + n, outSize - n, "%s\"%s\":\"%s\"", sep, fd.name, modeName(v));
+        break;
+      case TK_SWEEP:
+        w = snprintf(out + n, outSize - n, "%s\"%s\":\"%s\"", sep, fd.name, sweepStateName((SweepState)v));
+        break;
+      case TK_FIXED: {
+        const int32_t scale = POW10[fd.decimals];
+        const uint32_t mag = (uint32_t)(v < 0 ? -(int64_t)v : v);
+        w = snprintf(out + n, outSize - n, "%s\"%s\":%s%lu.%0*lu", sep, fd.name, v < 0 ? "-" : "",
+                     (unsigned long)(mag / scale), (int)fd.decimals, (unsigned long)(mag % scale));
+        break;
+      }
+      default:
+        w = snprintf(out + n, outSize - n, "%s\"%s\":%ld", sep, fd.name, (long)v);
+        break;
+    }
+
+    if (w < 0 || (size_t)w >= outSize - n - 1) return 0;  // Buffer too small
+    n += w;
+  }
+
+  if (n == 1) return 0;  // Nothing changed
+  out[n++] = '}';
+  out[n] = '\0';
+  return n;
+}
+
+void telemetryWriteJson(const TelemetryFrame& cur, JsonStreamWriter& json) {
+  for (int i = 0; i < TF_COUNT; i++) {
+    const TelemetryFieldDef& fd = FIELDS[i];
+    const int32_t v = cur.v[i];
+    switch (fd.kind) {
+      case TK_BOOL:  json.field(fd.name, v != 0); break;
+      case TK_MODE:  json.field(fd.name, modeName(v)); break;
+      case TK_SWEEP: json.field(fd.name, sweepStateName((SweepState)v)); break;
+      case TK_FIXED: json.field(fd.name, (float)v / (float)POW10[fd.decimals], fd.decimals); break;
+      default:       json.field(fd.name, (long)v); break;
+    }
+  }
+}
+
+size_t telemetryEncodeBinary(const TelemetryFrame& cur, const TelemetryFrame* prev, uint8_t seq,
+                             uint8_t* out, size_t outSize) {
+  if (outSize < TELEMETRY_BIN_MAX) return 0;
+
+  uint32_t mask = 0;
+  size_t n = 6;
+  for (int i = 0; i < TF_COUNT; i++) {
+    if (prev && prev->v[i] == cur.v[i]) continue;
+    mask |= (1UL << i);
+
+    const uint32_t v = (uint32_t)cur.v[i];
+    for (uint8_t b = 0; b < FIELDS[i].width; b++) {
+      out[n++] = (uint8_t)(v >> (8 * b));
+    }
+  }
+
+  if (mask == 0) return 0;
+  out[0] = TELEMETRY_BIN_MAGIC;
+  out[1] = seq;
+  for (uint8_t b = 0; b < 4; b++) {
+    out[2 + b] = (uint8_t)(mask >> (8 * b));
+  }
+  return n;
+}
@@ -0,0 +1,72 @@
+/*
+ * telemetry.h - Diagnostics Telemetry Serializer
+ *
+ * Captures the dashboard fields into a fixed array of quantized integers and
+ * encodes full or delta frames into caller-owned buffers (no heap traffic).
+ *
+ * JSON frame:   {"pos":412,"target":430}   (only fields that changed)
+ * Binary frame: [0xA5][seq][mask, 4 bytes LE] then, for each set mask bit in
+ *               field order, the value little-endian in the field's width.
+ *               Scaled fields are sent as value * 10^decimals.
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ==================== FIELDS ====================
+// Order is the wire order for binary frames - append only
+enum TelemetryField : uint8_t {
+  TF_BLE = 0,
+  TF_BLE_CMD_DROPS,
+  TF_LOG_DROPS,
+  TF_POS,
+  TF_TARGET,
+  TF_MODE,
+  TF_MANUAL_HOLD,
+  TF_ENABLED,
+  TF_SPEED,
+  TF_POWER,
+  TF_ERG_WATTS,
+  TF_ERG_FF,
+  TF_ERG_CORR,
+  TF_SIM_GRADE,
+  TF_WIFI_CLIENT,
+  TF_LOOP_MAX_US,       // Worst loop period in the last second
+  TF_STEP_GAP_MAX_US,   // Worst step-pulse gap since the last /perf.json reset
+  TF_HEAP_FREE,
+  TF_HEAP_LARGEST,
+  TF_ACCEL,             // Speed estimator acceleration, mph/s
+  TF_SWEEP_STATE,       // Calibration sweep (SweepState; name in JSON)
+  TF_SWEEP_CELL,        // Cell being measured, band-major
+  TF_SWEEP_WINDOWS,     // Steady windows collected for it
+  TF_METER,             // Power meter reporting
+  TF_METER_POWER,       // Last power meter reading, W
+  TF_COUNT
+};
+
+static_assert(TF_COUNT <= 32, "binary frame mask is 32 bits");
+
+static constexpr uint8_t TELEMETRY_BIN_MAGIC = 0xA5;
+static constexpr size_t TELEMETRY_JSON_MAX = 640;   // Full JSON frame fits
+static constexpr size_t TELEMETRY_BIN_MAX = 6 + TF_COUNT * 4;
+
+struct TelemetryFrame {
+  int32_t v[TF_COUNT];
+};
+
+class JsonStreamWriter;
+
+// ==================== FUNCTIONS ====================
+void telemetryCapture(TelemetryFrame* frame);
+
+// prev == NULL encodes every field. Returns bytes written (0 = nothing changed).
+size_t telemetryEncodeJson(const TelemetryFrame& cur, const TelemetryFrame* prev, char* out, size_t outSize);
+// Every field as members of the writer's open object (same names and values)
+void telemetryWriteJson(const TelemetryFrame& cur, JsonStreamWriter& json);
+size_t telemetryEncodeBinary(const TelemetryFrame& cur, const TelemetryFrame* prev, uint8_t seq,
+                             uint8_t* out, size_t outSize);
+
+#endif // TELEMETRY_H
@@ -0,0 +1,56 @@
+/*
+ * trainer_state.cpp - Published Trainer State Snapshot Implementation
+ */
+
+#include "trainer_state.h"
+#include "sensors.h"
+#include "erg_control.h"
+
+extern volatile int16_t ergTargetWatts;
+extern volatile float simGradePercent;
+
+// ==================== SEQUENCE LOCK ====================
+// Odd sequence = write in progress. Single writer (control task); readers
+// retry if the sequence moved while they copied.
+static TrainerSnapshot gSnapshot;
+static volatile uint32_t gSnapshotSeq = 0;
+
+void trainerStatePublish() {
+  TrainerSnapshot s;
+  s.ms = millis();
+  s.speedMph = currentSpeedMph;
+  s.accelMphS = currentAccelMphS;
+  s.rpm = currentRPM;
+  s.powerWatts = currentPowerWatts;
+  s.logPos = logStepPos;
+  s.logTarget = logStepTarget;
+  s.mode = gMode;
+  s.ergTargetWatts = ergTargetWatts;
+  s.simGradePercent = simGradePercent;
+  s.ergFeedForward = gErgFeedForward;
+  s.ergCorrection = gErgCorrection;
+  s.manualHold = gManualHoldActive;
+  s.stepEn = gStepEn;
+  s.homing = gIsHoming;
+  s.rehomeRequested = gRehomeRequested;
+
+  gSnapshotSeq = gSnapshotSeq + 1;
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  memcpy(&gSnapshot, &s, sizeof(s));
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  gSnapshotSeq = gSnapshotSeq + 1;
+}
+
+void trainerStateRead(TrainerSnapshot* out) {
+  uint32_t seq;
+  do {
+    seq = gSnapshotSeq;
+    if (seq & 1) {
+      taskYIELD();
+      continue;
+    }
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    memcpy(out, &gSnapshot, sizeof(*out));
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  } while ((seq & 1) || seq != gSnapshotSeq);
+}
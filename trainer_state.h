@@ -0,0 +1,40 @@
+/*
+ * trainer_state.h - Published Trainer State Snapshot
+ *
+ * The control task owns speed, power, position and mode. Once per control
+ * tick it publishes them as one TrainerSnapshot behind a sequence lock, so
+ * the web, BLE and LED tasks always read a consistent set of values instead
+ * of individually sampling volatile globals mid-update.
+ */
+
+#ifndef TRAINER_STATE_H
+#define TRAINER_STATE_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "stepper_control.h"  // ControlMode
+
+struct TrainerSnapshot {
+  uint32_t ms;                // millis() at publish
+  float speedMph;
+  float accelMphS;
+  float rpm;
+  float powerWatts;
+  int32_t logPos;
+  int32_t logTarget;
+  ControlMode mode;
+  int16_t ergTargetWatts;
+  float simGradePercent;
+  float ergFeedForward;
+  float ergCorrection;
+  bool manualHold;
+  bool stepEn;
+  bool homing;
+  bool rehomeRequested;
+};
+
+// ==================== FUNCTIONS ====================
+void trainerStatePublish();                   // Control task only: capture + publish
+void trainerStateRead(TrainerSnapshot* out);  // Any task: consistent copy
+
+#endif // TRAINER_STATE_H
@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+"""
+build_assets.py - Bundle web/*.html into web_assets.h
+
+Each page is gzip-compressed (deterministic: mtime=0) and emitted as a
+flash-resident byte array with its length and a content-hash ETag.
+Run after editing anything in web/ and commit the regenerated header:
+
+    python3 web/build_assets.py
+"""
+
+import gzip
+import hashlib
+import os
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+OUT = os.path.join(HERE, "..", "web_assets.h")
+
+# (source file, symbol, content type)
+ASSETS = [
+    ("index.html", "WEB_INDEX_HTML", "text/html"),
+    ("tables.html", "WEB_TABLES_HTML", "text/html"),
+]
+
+
+def c_bytes(data, indent="  ", per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        chunk = data[i:i + per_line]
+        lines.append(indent + ", ".join("0x%02x" % b for b in chunk) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    out = []
+    out.append("/*")
+    out.append(" * web_assets.h - Pre-gzipped Web UI Pages")
+    out.append(" *")
+    out.append(" * GENERATED by web/build_assets.py from the pages in web/ - do not edit by hand.")
+    out.append(" */")
+    out.append("")
+    out.append("#ifndef WEB_ASSETS_H")
+    out.append("#define WEB_ASSETS_H")
+    out.append("")
+    out.append("#include <Arduino.h>")
+    out.append("")
+    out.append("struct WebAsset {")
+    out.append("  const uint8_t* data;     // gzip body (flash)")
+    out.append("  size_t length;")
+    out.append("  const char* contentType;")
+    out.append("  const char* etag;        // Quoted, per HTTP")
+    out.append("};")
+
+    for src, sym, ctype in ASSETS:
+        with open(os.path.join(HERE, src), "rb") as f:
+            raw = f.read()
+        gz = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = hashlib.sha1(raw).hexdigest()[:16]
+        out.append("")
+        out.append("// %s: %d bytes -> %d gzip" % (src, len(raw), len(gz)))
+        out.append("static const uint8_t %s_GZ[] PROGMEM = {" % sym)
+        out.append(c_bytes(gz))
+        out.append("};")
+        out.append("static const WebAsset %s = {%s_GZ, sizeof(%s_GZ), \"%s\", \"\\\"%s\\\"\"};"
+                   % (sym, sym, sym, ctype, etag))
+
+    out.append("")
+    out.append("#endif // WEB_ASSETS_H")
+    out.append("")
+
+    with open(OUT, "w", newline="\n") as f:
+        f.write("\n".join(out))
+    print("wrote %s" % os.path.normpath(OUT))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,716 @@
+/*
+ * web_assets.h - Pre-gzipped Web UI Pages
+ *
+ * GENERATED by web/build_assets.py from the pages in web/ - do not edit by hand.
+ */
+
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+struct WebAsset {
+  const uint8_t* data;     // gzip body (flash)
+  size_t length;
+  const char* contentType;
+  const char* etag;        // Quoted, per HTTP
+};
+
+// index.html: 21706 bytes -> 5389 gzip
+static const uint8_t WEB_INDEX_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe5, 0x5c, 0x5b, 0x8f, 0x1b, 0xc9,
+  0x75, 0x7e, 0xd7, 0xaf, 0x28, 0x73, 0xa1, 0x25, 0x09, 0x93, 0x4d, 0x72, 0x2e, 0xd2, 0x78, 0x6e,
+  0xc2, 0x5c, 0xe5, 0xc9, 0x4a, 0x9a, 0x81, 0x66, 0x64, 0x25, 0xb0, 0x8d, 0x41, 0xb3, 0xbb, 0x48,
+  0xb6, 0xd5, 0xec, 0x6e, 0x74, 0x17, 0x87, 0x9a, 0xd5, 0xce, 0x9b, 0x91, 0x87, 0x3c, 0x24, 0x88,
+  0x1d, 0x24, 0xc8, 0xc2, 0x80, 0xf3, 0x90, 0x97, 0xbc, 0xe4, 0x29, 0x30, 0x92, 0x97, 0xfc, 0x18,
+  0xfd, 0x81, 0xf8, 0x27, 0xe4, 0x9c, 0xba, 0x74, 0x57, 0x55, 0x77, 0x93, 0x9c, 0xd1, 0x0e, 0x6c,
+  0xc0, 0xd2, 0x4a, 0xcb, 0xe9, 0xae, 0x3a, 0x75, 0x6e, 0xf5, 0x9d, 0x4b, 0x15, 0xb5, 0xfb, 0xa3,
+  0xe3, 0xf3, 0xa3, 0xab, 0xbf, 0xb9, 0x38, 0x21, 0x13, 0x36, 0x0d, 0xf7, 0x9f, 0xec, 0xaa, 0xff,
+  0x51, 0xd7, 0xdf, 0x7f, 0x42, 0xc8, 0xee, 0x94, 0x32, 0x97, 0x78, 0x13, 0x37, 0xcd, 0x28, 0xdb,
+  0x6b, 0xbc, 0xbb, 0x3a, 0xed, 0x6e, 0x35, 0x8a, 0x17, 0x91, 0x3b, 0xa5, 0x7b, 0x8d, 0x9b, 0x80,
+  0xce, 0x93, 0x38, 0x65, 0x0d, 0xe2, 0xc5, 0x11, 0xa3, 0x11, 0x0c, 0x9c, 0x07, 0x3e, 0x9b, 0xec,
+  0xf9, 0xf4, 0x26, 0xf0, 0x68, 0x97, 0xff, 0xd0, 0x21, 0x41, 0x14, 0xb0, 0xc0, 0x0d, 0xbb, 0x99,
+  0xe7, 0x86, 0x74, 0x6f, 0xe0, 0xf4, 0x05, 0x21, 0x16, 0xb0, 0x90, 0xee, 0x9f, 0x45, 0x59, 0xe0,
+  0xd3, 0xb7, 0xf0, 0x87, 0x5c, 0xa5, 0x6e, 0x10, 0xd1, 0x94, 0x1c, 0x01, 0xb1, 0x34, 0x0e, 0x77,
+  0x7b, 0x62, 0x04, 0x8e, 0xcd, 0xd8, 0xad, 0xf8, 0x44, 0xc8, 0x30, 0xf6, 0x6f, 0xc9, 0x27, 0xfe,
+  0x91, 0x90, 0x11, 0x0c, 0xed, 0x8e, 0xdc, 0x69, 0x10, 0xde, 0x6e, 0x93, 0x83, 0x14, 0x56, 0xe9,
+  0x90, 0xcc, 0x8d, 0xb2, 0x6e, 0x46, 0xd3, 0x60, 0xb4, 0x23, 0x47, 0x4d, 0xdd, 0x8f, 0x82, 0x97,
+  0x6d, 0xb2, 0xd5, 0xef, 0x27, 0x1f, 0x8b, 0xe7, 0xe9, 0x38, 0x88, 0xb6, 0xc9, 0x1a, 0x3c, 0x23,
+  0xee, 0x8c, 0xc5, 0xea, 0x45, 0xe2, 0xfa, 0x7e, 0x10, 0x8d, 0xc5, 0x1b, 0xf5, 0x70, 0xe8, 0x7a,
+  0x1f, 0xc6, 0x69, 0x3c, 0x8b, 0xfc, 0x6d, 0xf2, 0xd5, 0xa8, 0x8f, 0xbf, 0xc5, 0xab, 0x3b, 0xfe,
+  0xb7, 0x83, 0x3a, 0x10, 0x02, 0x7c, 0xaa, 0x98, 0x31, 0x9f, 0x04, 0x8c, 0x2e, 0xa6, 0x1f, 0xa7,
+  0x3e, 0x4d, 0xbb, 0xa9, 0xeb, 0x07, 0xb3, 0x0c, 0x38, 0xd5, 0xdf, 0x7c, 0xec, 0x66, 0x13, 0xd7,
+  0x8f, 0xe7, 0xdb, 0xa4, 0x4f, 0xd6, 0x80, 0xd9, 0x0d, 0xf8, 0x93, 0x8e, 0x87, 0x6e, 0xab, 0xdf,
+  0xe1, 0xbf, 0x9d, 0x41, 0xdb, 0x14, 0xaa, 0x3b, 0x8c, 0x19, 0x8b, 0xa7, 0xfa, 0x0a, 0x82, 0xcd,
+  0xc9, 0x20, 0x67, 0xcf, 0x8b, 0xc3, 0x38, 0x05, 0x59, 0xd6, 0xd7, 0xd7, 0xad, 0xc9, 0x2c, 0x4e,
+  0x60, 0x25, 0x63, 0xda, 0x5a, 0x69, 0xda, 0xb3, 0x67, 0xcf, 0x2c, 0xd6, 0xf3, 0x35, 0x81, 0xbb,
+  0x2c, 0x0e, 0x03, 0x9f, 0x7c, 0xd5, 0xef, 0x3f, 0x1f, 0x8e, 0x46, 0x96, 0xdc, 0xf9, 0xc0, 0x4d,
+  0x93, 0x37, 0x27, 0x63, 0x2e, 0x9b, 0x65, 0xdd, 0x71, 0x0a, 0x53, 0xd5, 0x72, 0x7e, 0x90, 0x25,
+  0xa1, 0x0b, 0xe6, 0xc5, 0xa7, 0x8a, 0x10, 0x7e, 0xee, 0x32, 0x3a, 0x85, 0x37, 0x8c, 0x76, 0x81,
+  0xa3, 0xd9, 0x34, 0x02, 0x9d, 0x0d, 0x46, 0x29, 0xfe, 0xc9, 0x47, 0xb9, 0x20, 0xc6, 0xa0, 0xc2,
+  0xe0, 0x03, 0x58, 0xd8, 0x94, 0x4f, 0x2d, 0x0d, 0x46, 0x9a, 0xe6, 0x4b, 0xe7, 0x66, 0x1a, 0xd4,
+  0xba, 0xc1, 0xd6, 0xe8, 0x27, 0x23, 0xb7, 0xc6, 0x82, 0x1b, 0x25, 0xdb, 0x86, 0x74, 0xc4, 0xb6,
+  0xc9, 0x7a, 0xb5, 0x7a, 0x4c, 0x46, 0x42, 0x77, 0x48, 0x43, 0xd3, 0xcf, 0xb3, 0xe0, 0x5b, 0x0a,
+  0xbc, 0xac, 0x15, 0x64, 0x2b, 0x4c, 0xc1, 0xe8, 0x47, 0xd6, 0x65, 0x29, 0xec, 0x81, 0x51, 0x9c,
+  0x82, 0x8a, 0x67, 0x49, 0x42, 0x53, 0xcf, 0xcd, 0x68, 0xd5, 0x22, 0x37, 0x6e, 0x38, 0xa3, 0x55,
+  0x8b, 0xac, 0x69, 0xbc, 0xf3, 0xc7, 0x73, 0x1a, 0x8c, 0x27, 0xc0, 0xfb, 0x30, 0x0e, 0xfd, 0x9d,
+  0xd5, 0xfc, 0xc7, 0x36, 0xae, 0x27, 0xb6, 0x75, 0x17, 0x95, 0x97, 0xe4, 0x8b, 0x56, 0x99, 0x44,
+  0xd7, 0xfc, 0xe6, 0x17, 0x69, 0x5e, 0x2e, 0x1d, 0x44, 0xc9, 0x8c, 0x59, 0x0b, 0xe7, 0x7e, 0x35,
+  0x0a, 0xe9, 0xc7, 0x5a, 0x8f, 0x71, 0xc3, 0x60, 0x1c, 0x71, 0xaf, 0x00, 0xb2, 0x1e, 0x40, 0x1c,
+  0x4d, 0x4b, 0xce, 0xd4, 0xb7, 0x9d, 0x89, 0x2f, 0xf7, 0x73, 0x76, 0x9b, 0x00, 0x46, 0x46, 0xb3,
+  0xe9, 0x90, 0xa6, 0x8d, 0x5f, 0x16, 0x5a, 0x86, 0xe5, 0x60, 0xd2, 0xce, 0x22, 0x1f, 0xd3, 0xcd,
+  0xfd, 0xcc, 0xf6, 0x22, 0x63, 0x7f, 0xf9, 0xbe, 0xbf, 0x9a, 0x0e, 0x86, 0x33, 0xd8, 0x72, 0x51,
+  0xb5, 0x6b, 0x1b, 0x30, 0xb4, 0x64, 0xed, 0x28, 0x8e, 0xe8, 0x72, 0x7f, 0xf7, 0x66, 0x69, 0x86,
+  0xbe, 0x91, 0xc4, 0x81, 0xae, 0x32, 0xee, 0x97, 0x10, 0x0c, 0x62, 0x50, 0x5b, 0x61, 0x4d, 0xd2,
+  0x77, 0xd6, 0x33, 0xc3, 0x5e, 0x43, 0x16, 0x75, 0x93, 0x34, 0x00, 0x0d, 0xdf, 0x56, 0x82, 0xa9,
+  0x05, 0x2b, 0xd2, 0x11, 0x35, 0x88, 0x2d, 0xd3, 0xd9, 0x9e, 0xc4, 0x37, 0x35, 0xd0, 0x0c, 0xd4,
+  0x36, 0x9f, 0x0d, 0xd7, 0x4b, 0x33, 0xb3, 0x99, 0xe7, 0xd1, 0x2c, 0xab, 0x9e, 0xb3, 0xb6, 0xe5,
+  0x3e, 0xdf, 0xd8, 0x5c, 0x89, 0x03, 0x49, 0x67, 0x11, 0x07, 0x6b, 0x83, 0xad, 0xad, 0xf5, 0xad,
+  0xd2, 0xcc, 0xb9, 0x9b, 0x46, 0x60, 0xa5, 0xea, 0x39, 0xa3, 0x91, 0x37, 0xe8, 0x3f, 0xb7, 0x38,
+  0x18, 0x86, 0x30, 0xa4, 0x8e, 0xce, 0x22, 0x0e, 0x68, 0xdf, 0x85, 0xd8, 0x58, 0x9a, 0xe9, 0xbb,
+  0xd1, 0xb8, 0x6e, 0x8a, 0xef, 0xad, 0x6f, 0xae, 0xa8, 0x02, 0x41, 0x66, 0xd1, 0xfa, 0xde, 0xd6,
+  0x5a, 0x8e, 0x23, 0xba, 0xee, 0x28, 0xc0, 0x86, 0x5f, 0xeb, 0x07, 0xcf, 0xbc, 0xe7, 0x9b, 0xcf,
+  0xfd, 0xd5, 0xac, 0xa0, 0x28, 0x2d, 0xe2, 0x02, 0xe4, 0x19, 0x3e, 0x5b, 0x2b, 0xcd, 0x1d, 0x86,
+  0xb1, 0xf7, 0x21, 0x9f, 0x21, 0x53, 0x89, 0x41, 0xbf, 0xff, 0xd4, 0xc6, 0x82, 0x72, 0x5c, 0x99,
+  0xc6, 0x3e, 0xed, 0x06, 0x91, 0x1f, 0x78, 0x2e, 0x8b, 0xd3, 0x32, 0xfa, 0x04, 0x51, 0x08, 0x39,
+  0x83, 0x58, 0xa1, 0x84, 0x09, 0x48, 0xce, 0x40, 0x40, 0x73, 0xc3, 0x95, 0xb6, 0x6d, 0x15, 0x4a,
+  0x4b, 0x48, 0x16, 0xa1, 0x67, 0x60, 0x65, 0x03, 0x92, 0x3d, 0x3f, 0x84, 0x28, 0x50, 0xa9, 0x59,
+  0x53, 0xa7, 0xc6, 0x2c, 0x9a, 0x8e, 0xed, 0x49, 0x72, 0x53, 0x2c, 0x98, 0x94, 0x05, 0x53, 0x7b,
+  0x92, 0xdc, 0xcb, 0x0b, 0x26, 0x4d, 0xdd, 0x68, 0xe6, 0x86, 0xf6, 0x3c, 0xe9, 0xff, 0xa6, 0xe7,
+  0xab, 0x79, 0x4b, 0x76, 0xce, 0x68, 0xdd, 0xf3, 0x6d, 0x64, 0x1b, 0x14, 0xa8, 0x6a, 0x6e, 0xad,
+  0xea, 0x34, 0xa0, 0x16, 0xfb, 0xea, 0xe2, 0xc2, 0x6e, 0x4f, 0x66, 0xb1, 0xbb, 0x3d, 0x91, 0x65,
+  0xef, 0x62, 0x2a, 0xcb, 0xd3, 0x5b, 0x3f, 0xb8, 0x21, 0x5e, 0xe8, 0x66, 0xd9, 0x5e, 0x23, 0xcf,
+  0x22, 0x1b, 0x22, 0xdd, 0xdd, 0x9d, 0x0c, 0xf6, 0xff, 0xf8, 0xfb, 0xef, 0xff, 0x8b, 0x94, 0x13,
+  0x65, 0xa0, 0x33, 0x90, 0x83, 0x80, 0xc0, 0xbe, 0x5c, 0x1e, 0x72, 0xe5, 0x34, 0x8e, 0xc6, 0xfb,
+  0xaf, 0x41, 0x73, 0xdb, 0xb8, 0x26, 0xff, 0x89, 0xe4, 0x6f, 0x13, 0x37, 0x22, 0x81, 0xbf, 0xd7,
+  0x40, 0xcd, 0x36, 0xd4, 0xaa, 0x96, 0x97, 0xe6, 0x5e, 0xd1, 0xd8, 0x3f, 0x3b, 0x7e, 0x75, 0x02,
+  0x54, 0x60, 0x96, 0x5c, 0xaa, 0x27, 0xd7, 0x92, 0x1f, 0x96, 0xb2, 0xbf, 0x06, 0xec, 0xff, 0xf6,
+  0xef, 0xc8, 0xab, 0xe0, 0x86, 0x92, 0xe3, 0xc0, 0x1d, 0x47, 0x71, 0xc6, 0x02, 0x2f, 0x03, 0xe6,
+  0xd7, 0x0a, 0xe6, 0xd5, 0x74, 0x2d, 0x01, 0x6c, 0xe4, 0x02, 0x95, 0xdf, 0x63, 0x3c, 0xce, 0xdf,
+  0x57, 0x8e, 0xe0, 0xe9, 0x53, 0x63, 0xff, 0x6d, 0x1c, 0x86, 0xb0, 0xd7, 0x2f, 0x13, 0x4a, 0xfd,
+  0x9c, 0xf3, 0xda, 0x49, 0x3c, 0x1d, 0x6a, 0x70, 0xed, 0x64, 0x38, 0xa3, 0xb1, 0xdf, 0x77, 0xfa,
+  0x64, 0x9a, 0x4c, 0x8c, 0xa9, 0xe6, 0x0f, 0x5f, 0xc0, 0xdc, 0x09, 0x28, 0x62, 0x0a, 0xf9, 0xab,
+  0x4f, 0x2e, 0xe2, 0x39, 0x9a, 0xf3, 0x1e, 0xfc, 0x25, 0x38, 0x03, 0xf8, 0x23, 0xef, 0x1f, 0x87,
+  0xb7, 0xa3, 0x59, 0x9a, 0x42, 0xb6, 0x03, 0x9c, 0x89, 0x78, 0x7d, 0x4f, 0xe6, 0xc4, 0x24, 0xe0,
+  0xef, 0x71, 0xb8, 0xbb, 0x82, 0x2d, 0x46, 0x1f, 0xc8, 0x1c, 0xe3, 0x73, 0x1f, 0x8d, 0xb5, 0x93,
+  0xb7, 0x2f, 0x89, 0x60, 0xef, 0x5e, 0x5c, 0x01, 0x98, 0x5e, 0x2b, 0xce, 0xba, 0xdd, 0xc7, 0xb2,
+  0xea, 0xe5, 0xd9, 0x6b, 0xf2, 0x12, 0x20, 0x8b, 0xde, 0x6f, 0x2f, 0x04, 0xd3, 0xeb, 0x31, 0xce,
+  0xe2, 0xac, 0x3d, 0x7d, 0x1c, 0xd6, 0x5e, 0xc7, 0x00, 0x3c, 0xf7, 0x62, 0x6b, 0x8a, 0x33, 0x1a,
+  0xfb, 0xe7, 0xa7, 0xa7, 0x8f, 0xc3, 0xd1, 0x21, 0x02, 0xdf, 0x3d, 0xf8, 0x19, 0x22, 0x5c, 0x1e,
+  0x07, 0x19, 0x40, 0x60, 0x44, 0x3d, 0x66, 0x01, 0x8e, 0xf6, 0x83, 0xfe, 0x11, 0x29, 0xf2, 0xb0,
+  0x00, 0xf2, 0x68, 0xb5, 0x13, 0x8f, 0x34, 0x56, 0xe0, 0xb1, 0xf2, 0xb5, 0xe7, 0xa3, 0x75, 0x8c,
+  0x9a, 0x4b, 0x2a, 0xcb, 0xaa, 0x38, 0x55, 0x20, 0x6b, 0x36, 0x75, 0xc3, 0x50, 0xad, 0xaf, 0x17,
+  0x93, 0x9a, 0x82, 0x3e, 0xff, 0xfa, 0x7f, 0xfe, 0xef, 0xbf, 0xff, 0x41, 0x0b, 0x2b, 0x18, 0x20,
+  0x0e, 0x66, 0x2c, 0xee, 0x9e, 0x44, 0x2e, 0xc8, 0xac, 0xc5, 0x18, 0xf1, 0x8e, 0xf2, 0xc7, 0x19,
+  0x71, 0x19, 0x59, 0x73, 0xd6, 0x11, 0x3e, 0x3b, 0x98, 0xee, 0x68, 0x0f, 0x39, 0xa6, 0xe6, 0x7a,
+  0xe1, 0x4c, 0x7c, 0x41, 0x70, 0xf9, 0xfb, 0xff, 0x24, 0xaf, 0x45, 0x82, 0x90, 0x37, 0x8e, 0x54,
+  0x68, 0x29, 0xc5, 0x17, 0xa3, 0x06, 0x2d, 0xf4, 0x20, 0x8a, 0x6d, 0x28, 0x98, 0xf7, 0x1a, 0x63,
+  0x90, 0xe1, 0x9a, 0x17, 0x70, 0x8d, 0x7d, 0x25, 0xf3, 0xcb, 0x98, 0x5c, 0xc5, 0x39, 0xda, 0x90,
+  0x56, 0xbf, 0x0b, 0xb9, 0x5f, 0xbf, 0x5d, 0x48, 0xbe, 0xdb, 0xe3, 0x14, 0xaa, 0xbc, 0x4e, 0x2b,
+  0x3d, 0x75, 0xaf, 0xe3, 0x8f, 0x89, 0x51, 0x22, 0x72, 0x27, 0xd2, 0x96, 0x27, 0xd3, 0x20, 0xda,
+  0x6b, 0xf4, 0x1b, 0xd8, 0xbe, 0xda, 0x6b, 0xe0, 0x8a, 0x0d, 0xc2, 0xdd, 0x6d, 0xaf, 0xb1, 0x89,
+  0x9f, 0x7b, 0x1a, 0x39, 0x59, 0xdd, 0xc9, 0x35, 0xb5, 0xb2, 0xa7, 0x41, 0xe2, 0xc8, 0x0b, 0x03,
+  0xef, 0x83, 0x20, 0xad, 0x64, 0x68, 0xb5, 0x1b, 0x42, 0xaa, 0xdd, 0x9e, 0x98, 0x5a, 0xbd, 0x7b,
+  0x16, 0xf8, 0xc7, 0x09, 0xd6, 0x75, 0xc4, 0x8d, 0x6e, 0x05, 0x4f, 0x64, 0x94, 0xc6, 0x53, 0xd2,
+  0x27, 0x2d, 0x60, 0x9a, 0xa4, 0x34, 0x0b, 0x60, 0x7f, 0x44, 0x1e, 0x6d, 0x13, 0x16, 0x63, 0xa2,
+  0x8c, 0x2f, 0xdc, 0x8f, 0xfa, 0x8b, 0x2a, 0xbb, 0x3f, 0xc4, 0x5c, 0x88, 0x4b, 0xd5, 0xf6, 0xe2,
+  0x40, 0x47, 0x5a, 0xdd, 0x8d, 0xa7, 0x82, 0x89, 0xa7, 0x8f, 0x63, 0x30, 0x8d, 0x01, 0x61, 0xb1,
+  0xee, 0x46, 0x6e, 0xb2, 0x06, 0xe8, 0x8e, 0x26, 0x60, 0x44, 0x67, 0x33, 0xb7, 0xdd, 0x03, 0x2d,
+  0xc7, 0xa5, 0x41, 0xb3, 0x5d, 0x42, 0xe0, 0x93, 0x18, 0xfe, 0x40, 0xd3, 0x5d, 0x06, 0xd3, 0x19,
+  0xf6, 0xcd, 0x32, 0x32, 0x09, 0x60, 0x0c, 0x97, 0x80, 0xcc, 0x32, 0x4c, 0x97, 0xd9, 0x84, 0x12,
+  0x0c, 0x12, 0x98, 0x00, 0x6a, 0xd6, 0xc2, 0x7a, 0xfe, 0x86, 0x2e, 0x36, 0x19, 0x87, 0x64, 0xbe,
+  0x0f, 0xaf, 0x65, 0xf2, 0x9d, 0x67, 0x97, 0xf9, 0xcf, 0x92, 0x1d, 0x55, 0xfc, 0xf0, 0x5e, 0x42,
+  0xae, 0xe4, 0xcf, 0xdf, 0xff, 0x1b, 0x02, 0x8d, 0xdc, 0xcb, 0x58, 0xa3, 0xa5, 0x98, 0xec, 0xba,
+  0x1e, 0xc3, 0xd4, 0xb1, 0x4b, 0x0e, 0x92, 0x84, 0x48, 0x87, 0x50, 0x78, 0xe2, 0x97, 0x59, 0x29,
+  0xeb, 0x53, 0x95, 0xf1, 0x79, 0x21, 0xa7, 0x69, 0x16, 0x44, 0x9c, 0x4d, 0x29, 0x50, 0x46, 0xcd,
+  0x2a, 0x3e, 0xfe, 0xf9, 0x0f, 0xc8, 0xc7, 0x5b, 0xfe, 0x8a, 0xaf, 0x2a, 0x71, 0x45, 0x2e, 0xa6,
+  0xb4, 0x7e, 0x2f, 0x98, 0xfa, 0xfc, 0xfd, 0xbf, 0x22, 0xd1, 0x23, 0x37, 0x0c, 0x86, 0xa9, 0x2b,
+  0x92, 0x96, 0xaa, 0x04, 0xb8, 0xc6, 0xe3, 0x13, 0x33, 0x48, 0x60, 0x1b, 0xb8, 0xaf, 0x5a, 0x66,
+  0xba, 0x97, 0xba, 0x64, 0x92, 0xd2, 0xd1, 0x5e, 0xa3, 0xc7, 0x38, 0xdc, 0x96, 0x34, 0x6e, 0x96,
+  0x9b, 0x5a, 0x80, 0x59, 0x53, 0x5d, 0xa0, 0x55, 0x6a, 0x33, 0xde, 0x63, 0xf4, 0xa1, 0x9e, 0x16,
+  0x92, 0xc8, 0xa6, 0x50, 0x55, 0xa8, 0xa9, 0x28, 0x4b, 0x35, 0x76, 0x09, 0xe1, 0xa5, 0xc1, 0x89,
+  0x1f, 0x30, 0x5d, 0x33, 0x90, 0x3f, 0xf1, 0x58, 0xd1, 0xe2, 0x69, 0x71, 0x87, 0x40, 0x4a, 0xd5,
+  0x41, 0xaf, 0xec, 0x10, 0x2c, 0x46, 0xda, 0x85, 0xb4, 0x3d, 0xb7, 0xf0, 0xfd, 0xa4, 0xac, 0x2b,
+  0xe5, 0xf5, 0x5b, 0x5b, 0x5b, 0x3b, 0x46, 0x5b, 0x6b, 0x1d, 0x39, 0xcb, 0x35, 0xa9, 0x73, 0x04,
+  0x96, 0x1e, 0x05, 0xe3, 0x59, 0x4a, 0xf9, 0x4e, 0x08, 0xe3, 0xf8, 0xc3, 0x2c, 0x21, 0x42, 0x97,
+  0xb0, 0x43, 0x20, 0x53, 0x07, 0xd0, 0x21, 0x3c, 0xf7, 0x26, 0x54, 0x64, 0xef, 0xc0, 0x2f, 0xe7,
+  0x90, 0x6f, 0x99, 0x4e, 0xbe, 0x79, 0x3a, 0x00, 0x8d, 0x3e, 0xe7, 0x57, 0xec, 0x1d, 0xe7, 0xcb,
+  0x19, 0x15, 0xf5, 0x24, 0xfe, 0xae, 0x36, 0x79, 0x18, 0x8f, 0x1d, 0xf6, 0x11, 0x60, 0x10, 0x94,
+  0xfa, 0x3b, 0xf2, 0xb3, 0x80, 0xce, 0x61, 0x07, 0x63, 0xcb, 0x12, 0xe4, 0x18, 0x57, 0xe9, 0xea,
+  0x61, 0xa5, 0xdc, 0x1f, 0xc8, 0xfb, 0xe0, 0x34, 0x20, 0x5f, 0x93, 0x63, 0x7e, 0xc8, 0x43, 0x00,
+  0x8f, 0x18, 0xf8, 0x50, 0x76, 0x2f, 0x7f, 0x9e, 0xac, 0x57, 0x65, 0x3d, 0xfd, 0xdc, 0xd1, 0xbe,
+  0xda, 0xd8, 0xd8, 0x00, 0x29, 0xe5, 0x12, 0x67, 0x3e, 0x48, 0x11, 0xb0, 0x5b, 0x58, 0x62, 0xbd,
+  0xac, 0xbd, 0x92, 0xc2, 0x74, 0xb4, 0x33, 0x3b, 0x33, 0xaa, 0x26, 0xd7, 0xf5, 0x27, 0x23, 0x82,
+  0x5a, 0xea, 0x58, 0xcb, 0x67, 0x8a, 0x62, 0x59, 0x1c, 0x68, 0x5d, 0x43, 0x55, 0x6a, 0xac, 0xaa,
+  0x4e, 0x9e, 0xa6, 0x31, 0x54, 0xb5, 0x89, 0xeb, 0x51, 0x3b, 0x49, 0xfb, 0x09, 0x18, 0x60, 0xa4,
+  0xed, 0x33, 0xdc, 0x66, 0xcf, 0xf8, 0x2e, 0x33, 0xf7, 0xca, 0x3a, 0x4f, 0xcb, 0xba, 0x5d, 0x59,
+  0x69, 0x93, 0xef, 0x4a, 0xfc, 0xfd, 0x14, 0xca, 0x66, 0x3c, 0x75, 0xab, 0x64, 0x6f, 0x22, 0x5f,
+  0x2e, 0xe3, 0x6e, 0xf1, 0x12, 0x07, 0x17, 0xe4, 0xf2, 0xb2, 0x46, 0x01, 0x6e, 0x72, 0x9d, 0x65,
+  0x58, 0x94, 0xe7, 0x04, 0x2a, 0x1c, 0xba, 0x9c, 0xcc, 0xaa, 0x83, 0x1e, 0x9e, 0xc0, 0xea, 0x5a,
+  0xd7, 0x42, 0xb8, 0xd4, 0x2d, 0xe7, 0x7f, 0xdf, 0x32, 0xc7, 0x1b, 0x78, 0x48, 0x5a, 0x71, 0x82,
+  0xdb, 0xcc, 0x0d, 0xeb, 0x03, 0xb8, 0x15, 0xa0, 0x11, 0xa0, 0x1a, 0xba, 0xe1, 0x84, 0x72, 0x00,
+  0x02, 0x3d, 0x3a, 0x01, 0x10, 0xa2, 0xb0, 0x2c, 0x75, 0xc6, 0x4e, 0x47, 0xb5, 0x52, 0x06, 0x1d,
+  0xf2, 0x2e, 0x81, 0x58, 0x17, 0xa4, 0x59, 0x87, 0xbc, 0x74, 0x53, 0x77, 0x4c, 0x79, 0x10, 0x0f,
+  0x69, 0x34, 0x66, 0x93, 0xbd, 0xc6, 0xda, 0x46, 0xae, 0x5a, 0xbd, 0xfb, 0x67, 0x67, 0xe8, 0x76,
+  0xef, 0xbc, 0xae, 0x63, 0x5f, 0x09, 0x95, 0xfc, 0x94, 0x2f, 0xf8, 0x96, 0x93, 0xcb, 0x0f, 0xd4,
+  0x4c, 0xad, 0x2d, 0x08, 0xea, 0x47, 0xb3, 0x0c, 0x34, 0xcd, 0x0f, 0x66, 0x39, 0x48, 0xb1, 0x49,
+  0x90, 0x11, 0x21, 0xbd, 0xc8, 0xbd, 0xd6, 0x36, 0xc4, 0x71, 0x6e, 0xdb, 0x21, 0xaf, 0xa8, 0x0b,
+  0x11, 0x75, 0x18, 0xba, 0xd1, 0x07, 0x4c, 0x8d, 0x00, 0xd8, 0xc8, 0xeb, 0x83, 0xa3, 0xee, 0xd0,
+  0x45, 0x84, 0xf3, 0xe9, 0xc8, 0x9d, 0x85, 0xcc, 0x31, 0xa2, 0x7d, 0x55, 0x59, 0x65, 0x87, 0x16,
+  0x7e, 0x8e, 0xa2, 0x9d, 0xa0, 0xf0, 0x07, 0xdd, 0x79, 0x8a, 0x0f, 0xf0, 0xef, 0x1d, 0xfb, 0x68,
+  0x92, 0x77, 0x36, 0x1b, 0xf7, 0xcc, 0x85, 0x32, 0x60, 0x5d, 0x38, 0x07, 0xfa, 0x06, 0x86, 0xed,
+  0x3f, 0xfe, 0xfe, 0x37, 0xff, 0x4b, 0x2e, 0x51, 0x22, 0x7c, 0x62, 0x67, 0x45, 0xd5, 0x29, 0x81,
+  0xea, 0x05, 0x6b, 0x84, 0xbd, 0x90, 0xba, 0xa9, 0x49, 0xf9, 0xf3, 0xdf, 0xfe, 0x07, 0x06, 0xed,
+  0x77, 0xa0, 0x9f, 0x63, 0xa1, 0x95, 0xc5, 0x39, 0x97, 0x4a, 0x83, 0xa4, 0xd3, 0x4d, 0xb3, 0x22,
+  0xe5, 0xa9, 0xda, 0x0f, 0x45, 0x13, 0x58, 0xc4, 0xcf, 0xdc, 0x99, 0xb6, 0x2a, 0x10, 0x42, 0x14,
+  0x6e, 0x7a, 0xaa, 0x63, 0xc0, 0xa8, 0x8e, 0x9b, 0x6a, 0xaa, 0xa8, 0x24, 0x2d, 0xcf, 0x53, 0x47,
+  0xb0, 0xe2, 0xa5, 0xb0, 0x00, 0x07, 0xf4, 0x37, 0x94, 0xcd, 0xe3, 0xf4, 0xc3, 0x63, 0x62, 0xec,
+  0x25, 0xaf, 0x99, 0x2b, 0xf1, 0x65, 0x1e, 0x8c, 0x82, 0x6b, 0x51, 0x53, 0x2f, 0x06, 0xa9, 0xb3,
+  0x8b, 0xfa, 0xf9, 0x41, 0xb2, 0x78, 0xee, 0x65, 0x30, 0x06, 0x14, 0xa9, 0x9f, 0x9f, 0x02, 0xc4,
+  0x3d, 0x06, 0xc2, 0x09, 0xe1, 0x38, 0x7c, 0x2a, 0x56, 0xa4, 0xb6, 0x49, 0x0b, 0x11, 0xf7, 0x01,
+  0xb8, 0x56, 0x90, 0x34, 0x51, 0xed, 0x0a, 0xc6, 0x91, 0xdb, 0x78, 0x96, 0x92, 0x48, 0xae, 0x60,
+  0xc4, 0x85, 0x3f, 0x19, 0x78, 0xd5, 0xc2, 0xc7, 0x7d, 0xd5, 0x98, 0xc0, 0x26, 0x2e, 0xd4, 0x78,
+  0x01, 0x3f, 0x81, 0x94, 0xfe, 0xaa, 0x0a, 0x4c, 0xe4, 0x78, 0x4d, 0x89, 0x9c, 0xa0, 0xa9, 0x44,
+  0x51, 0xdb, 0xf2, 0x5d, 0x51, 0x4c, 0xf8, 0xb3, 0xd5, 0xe0, 0xea, 0x00, 0xbc, 0x18, 0x6b, 0x65,
+  0x9d, 0x64, 0x61, 0xed, 0x7b, 0xd0, 0x91, 0x81, 0xb2, 0x2b, 0x01, 0x6c, 0x5e, 0xf1, 0xe9, 0x95,
+  0x16, 0x73, 0x53, 0x26, 0x00, 0x56, 0x10, 0xfc, 0xa7, 0x5f, 0x63, 0x91, 0x85, 0x4f, 0x57, 0xa2,
+  0x29, 0xce, 0x10, 0x6d, 0xc4, 0x2e, 0xf8, 0xfb, 0x97, 0x7f, 0xe4, 0x15, 0x16, 0x3e, 0x5c, 0x0d,
+  0xa6, 0xb9, 0xf9, 0x2b, 0x40, 0x5a, 0xeb, 0xc0, 0x3d, 0x18, 0xa1, 0x6b, 0x1d, 0xbd, 0xc0, 0x5d,
+  0xb3, 0xfa, 0xda, 0xa9, 0x3c, 0xa2, 0x5a, 0x70, 0x38, 0xb5, 0xb0, 0xb3, 0x57, 0x60, 0x9e, 0xac,
+  0xaa, 0xcf, 0xa6, 0x78, 0x51, 0xcb, 0x8d, 0x98, 0x86, 0x7e, 0x07, 0x23, 0x74, 0x73, 0xae, 0x4c,
+  0xac, 0xfd, 0xd1, 0xb8, 0x1d, 0xd8, 0x08, 0x14, 0xd2, 0x00, 0x32, 0x77, 0xa1, 0x26, 0xc3, 0xda,
+  0x27, 0x26, 0xcf, 0xfa, 0x44, 0xc4, 0xcb, 0xcc, 0xc9, 0xa9, 0x5f, 0x41, 0x75, 0x94, 0x40, 0x92,
+  0x04, 0xd0, 0x7f, 0x4b, 0x86, 0xf0, 0x16, 0xb2, 0x8e, 0x59, 0x04, 0x36, 0x4e, 0xe2, 0x28, 0x13,
+  0xe5, 0x3a, 0x4f, 0x40, 0xe0, 0xbf, 0x28, 0x4e, 0x21, 0x8f, 0x70, 0xc8, 0x71, 0x4c, 0xde, 0x9c,
+  0x5f, 0xc9, 0xe2, 0xc9, 0xbb, 0x05, 0xe3, 0xf1, 0x1a, 0x4b, 0xc4, 0xca, 0x82, 0xb2, 0x60, 0x0a,
+  0x3c, 0x0f, 0x58, 0xea, 0x08, 0xe6, 0x94, 0x97, 0x74, 0x70, 0x02, 0x76, 0x97, 0x64, 0x87, 0x15,
+  0x99, 0xe3, 0x50, 0x37, 0xc1, 0xe5, 0xf9, 0x76, 0xc5, 0xa2, 0x6b, 0x98, 0xc6, 0x73, 0x90, 0x80,
+  0xc5, 0x25, 0x5d, 0x4c, 0x18, 0x4b, 0xb6, 0x7b, 0xbd, 0x72, 0xde, 0x7c, 0x1d, 0xc5, 0x0c, 0x92,
+  0xcf, 0x80, 0x1f, 0xb1, 0x61, 0xd7, 0xa1, 0xfb, 0xd7, 0xf0, 0x4b, 0x86, 0x01, 0x07, 0x6a, 0x65,
+  0x37, 0x2c, 0xd4, 0xc6, 0x93, 0x2b, 0xa8, 0x14, 0x2e, 0x08, 0xd8, 0x2f, 0xc5, 0xce, 0x42, 0x36,
+  0x89, 0xe7, 0x40, 0x30, 0xd2, 0x04, 0xc2, 0x9a, 0x2b, 0x73, 0x16, 0xf4, 0x7e, 0xef, 0x53, 0x73,
+  0xc1, 0x46, 0x39, 0xbf, 0x3a, 0x20, 0xa7, 0x41, 0x3a, 0x85, 0x8d, 0x45, 0x21, 0x55, 0xf5, 0x5d,
+  0x46, 0xb5, 0x82, 0x6b, 0x79, 0x25, 0xb9, 0xa1, 0x57, 0x92, 0xaa, 0x6f, 0xa0, 0x0e, 0x79, 0x6e,
+  0x68, 0x9a, 0xf1, 0x3a, 0xbe, 0xd0, 0xcc, 0x68, 0x7e, 0x2d, 0x9f, 0x6a, 0x01, 0xb1, 0xa8, 0x1c,
+  0xd5, 0x16, 0x8a, 0x99, 0x7b, 0xcd, 0x7b, 0x09, 0xd4, 0x7f, 0x58, 0xb7, 0x47, 0x99, 0x06, 0xe5,
+  0x3b, 0x14, 0x84, 0x34, 0x0f, 0x2d, 0xba, 0xe9, 0xd8, 0x87, 0xe9, 0x1d, 0x42, 0x35, 0x3d, 0xa4,
+  0x10, 0x0b, 0xc0, 0xd9, 0x50, 0x05, 0xe8, 0xb5, 0x23, 0xa9, 0x94, 0x52, 0x67, 0x1d, 0xaf, 0x3f,
+  0x91, 0x29, 0x65, 0x93, 0x18, 0xf8, 0xbc, 0x38, 0xbf, 0xbc, 0x6a, 0xf0, 0x56, 0x52, 0x1c, 0x41,
+  0xa9, 0xcc, 0x67, 0x43, 0x54, 0xa4, 0x91, 0x27, 0xe2, 0xc2, 0x14, 0x72, 0xbb, 0x20, 0x01, 0x1f,
+  0xeb, 0xe1, 0x34, 0x80, 0x1a, 0xe6, 0x36, 0x72, 0x01, 0xf1, 0x51, 0x01, 0xc3, 0x7a, 0x38, 0x19,
+  0x05, 0x21, 0x50, 0x11, 0x97, 0x21, 0x15, 0x4d, 0x17, 0x50, 0x34, 0x61, 0x7b, 0x0d, 0x67, 0x18,
+  0x44, 0x1d, 0x67, 0xfc, 0x6d, 0xc3, 0x6e, 0xdd, 0xa8, 0xfc, 0xa8, 0xa0, 0x8f, 0x54, 0x72, 0xfa,
+  0x12, 0xf8, 0xc4, 0x02, 0xd9, 0x6c, 0x38, 0x0d, 0x58, 0xa3, 0x22, 0x25, 0xd6, 0xdb, 0x59, 0xb9,
+  0x25, 0x58, 0xc4, 0xab, 0xff, 0x7f, 0x07, 0x0f, 0x09, 0x63, 0xd7, 0xcf, 0x3d, 0xc6, 0xc4, 0xc3,
+  0x5d, 0x2e, 0xe4, 0x92, 0x03, 0x08, 0x1d, 0xa1, 0xf4, 0x47, 0x0b, 0x72, 0xcb, 0xc6, 0x17, 0xe5,
+  0x8d, 0x55, 0xe0, 0x75, 0x01, 0x16, 0x11, 0xd7, 0x85, 0xaa, 0x72, 0x36, 0x14, 0x39, 0x51, 0x23,
+  0x96, 0x64, 0x7e, 0x90, 0x59, 0xd2, 0x5a, 0x22, 0x98, 0x77, 0xd2, 0xc5, 0x89, 0xdf, 0xc3, 0x24,
+  0xca, 0x57, 0x00, 0xf3, 0x61, 0x7f, 0x5a, 0x23, 0x58, 0x1b, 0x33, 0x6d, 0xc3, 0xa6, 0x71, 0x18,
+  0x62, 0x68, 0xe0, 0xd6, 0xd5, 0xe2, 0xa9, 0x7c, 0xac, 0x4c, 0x0c, 0x31, 0x70, 0xf1, 0x86, 0x83,
+  0x2d, 0x27, 0xca, 0x99, 0xb7, 0x72, 0x26, 0xc2, 0xe7, 0x45, 0x0a, 0x68, 0x15, 0xcf, 0xb2, 0xdc,
+  0x53, 0x72, 0xd1, 0x4d, 0x87, 0x29, 0x83, 0x56, 0xe6, 0xa5, 0x41, 0xc2, 0xc4, 0xfb, 0xd1, 0x2c,
+  0xe2, 0x3b, 0x4b, 0xec, 0x4a, 0x8a, 0xa7, 0xfc, 0xad, 0x76, 0x71, 0xe1, 0x8d, 0x32, 0x6f, 0xd2,
+  0x6a, 0xc2, 0x54, 0x77, 0xec, 0xfc, 0x2a, 0x8b, 0xa3, 0x66, 0xd1, 0xc2, 0x73, 0x10, 0xd1, 0x5b,
+  0x29, 0xd9, 0xdb, 0x27, 0x29, 0x7f, 0xd7, 0x6a, 0xdb, 0x2f, 0x7d, 0x7c, 0xe9, 0x26, 0x49, 0x78,
+  0x8b, 0x74, 0x8f, 0x61, 0x67, 0xb6, 0x7c, 0x7d, 0x90, 0xe7, 0x22, 0x79, 0x8a, 0xa3, 0x00, 0x2b,
+  0xc0, 0x1d, 0xa9, 0x43, 0xd3, 0x34, 0x4e, 0x5b, 0x4d, 0x01, 0x93, 0x64, 0xe4, 0xc2, 0xfe, 0xf2,
+  0xb7, 0x9b, 0x1d, 0x42, 0xdb, 0x6d, 0x75, 0x1d, 0xc3, 0xe4, 0xdb, 0x3c, 0x1a, 0xc9, 0x39, 0x0f,
+  0x29, 0x83, 0x78, 0x95, 0x91, 0x3d, 0xe2, 0xc7, 0xde, 0x6c, 0x0a, 0x50, 0xe9, 0x8c, 0x29, 0x3b,
+  0x09, 0x29, 0x7e, 0x3c, 0xbc, 0x3d, 0xf3, 0x5b, 0xcd, 0xe2, 0xbc, 0xa6, 0xd9, 0x76, 0x78, 0x87,
+  0x7f, 0xc7, 0x12, 0x9b, 0x8f, 0xc0, 0xcc, 0xf2, 0x05, 0x90, 0xda, 0x6b, 0x92, 0x1f, 0x23, 0xc9,
+  0x1a, 0x0d, 0x60, 0x7e, 0x5f, 0xd6, 0x00, 0xa4, 0x28, 0xf8, 0xfa, 0x93, 0xd6, 0x37, 0x55, 0x92,
+  0x42, 0x94, 0xc1, 0xd7, 0xf9, 0xe5, 0x5f, 0xfc, 0xa5, 0x1b, 0xa1, 0x78, 0x7e, 0xb7, 0x40, 0x74,
+  0x79, 0xb6, 0x60, 0xc8, 0x2d, 0x4e, 0x05, 0x16, 0x49, 0x5e, 0x1c, 0x7c, 0xd4, 0x8a, 0xce, 0x87,
+  0x70, 0xd9, 0xf9, 0x47, 0x2e, 0x3d, 0xff, 0xf4, 0xe7, 0x23, 0xbf, 0x76, 0x02, 0x50, 0xf2, 0x58,
+  0xf1, 0xee, 0x1a, 0x9c, 0x0f, 0x9c, 0xe7, 0x93, 0x88, 0x25, 0xdb, 0xa4, 0x89, 0xc1, 0xa4, 0x79,
+  0xf7, 0x27, 0x15, 0x81, 0xff, 0xbf, 0xd7, 0x23, 0x7b, 0x15, 0xbf, 0xc8, 0xfb, 0x93, 0xc3, 0xcb,
+  0xf3, 0xa3, 0x6f, 0x4e, 0xae, 0xc8, 0xfb, 0xb3, 0xab, 0x9f, 0x92, 0xd3, 0x83, 0x57, 0xaf, 0x0e,
+  0x0f, 0x8e, 0xbe, 0xa9, 0x1c, 0xfc, 0x44, 0xd9, 0x7b, 0x8e, 0x6e, 0x1e, 0xcd, 0xc2, 0x70, 0x47,
+  0x7b, 0x74, 0xa4, 0x8e, 0xb2, 0xe1, 0xdd, 0xc8, 0x0d, 0xd5, 0x25, 0x62, 0xb1, 0x2f, 0xc2, 0xf0,
+  0x0c, 0xeb, 0x24, 0xb0, 0x7c, 0x69, 0x26, 0x6e, 0x75, 0x0e, 0xb9, 0xf0, 0xe6, 0xd3, 0xdd, 0x8e,
+  0xe0, 0xf5, 0x3d, 0x1d, 0x5e, 0x62, 0x80, 0x67, 0x64, 0x94, 0x42, 0xc4, 0xcc, 0x88, 0xe7, 0xa6,
+  0x10, 0xc7, 0xe2, 0x28, 0xbc, 0xc5, 0xce, 0x14, 0x24, 0xf7, 0x3e, 0x44, 0x73, 0x1a, 0xfa, 0x99,
+  0x65, 0x22, 0x7b, 0xf3, 0x17, 0x97, 0xe8, 0xea, 0x7c, 0x93, 0xdf, 0xde, 0x01, 0xaf, 0x44, 0x63,
+  0x1c, 0x89, 0xaf, 0x26, 0xa0, 0x2b, 0x3b, 0xfc, 0xb9, 0xc3, 0xe2, 0xd3, 0xe0, 0x23, 0xf5, 0x5b,
+  0x83, 0x36, 0xb8, 0x63, 0x13, 0xcf, 0xa2, 0x9b, 0x3b, 0xcb, 0x28, 0xf2, 0xb4, 0xb5, 0x44, 0xf1,
+  0xb5, 0xcb, 0x26, 0x0e, 0x4f, 0xd9, 0x5b, 0xbe, 0xc3, 0x87, 0x08, 0x92, 0xef, 0x57, 0x21, 0x28,
+  0xe0, 0xa6, 0x82, 0x4b, 0x78, 0xb5, 0x74, 0xba, 0xb8, 0x2b, 0x52, 0x31, 0x59, 0xbc, 0xd8, 0x79,
+  0xa2, 0x6d, 0x65, 0x7e, 0x51, 0xe2, 0x24, 0x5c, 0xb4, 0x99, 0xf9, 0x90, 0x66, 0xee, 0x6b, 0xc1,
+  0x88, 0x80, 0x40, 0xe2, 0x20, 0x5f, 0xd3, 0x37, 0x51, 0xa4, 0xac, 0x55, 0x9b, 0x9f, 0x7f, 0xf7,
+  0x5b, 0x72, 0xf2, 0xe6, 0x00, 0xf2, 0xb3, 0xe3, 0xe6, 0x4e, 0x69, 0x30, 0x0f, 0x4b, 0x0e, 0x8f,
+  0x93, 0x38, 0x58, 0xde, 0x12, 0xcc, 0x07, 0xde, 0x11, 0x0a, 0x9e, 0xb5, 0x7c, 0x91, 0xe3, 0xb3,
+  0xcb, 0x55, 0x57, 0x10, 0x97, 0x17, 0x8b, 0x15, 0x74, 0x6d, 0x80, 0x48, 0x8b, 0x75, 0x01, 0x03,
+  0x0a, 0x4d, 0xf0, 0xd1, 0x25, 0x25, 0xc3, 0x53, 0xf2, 0x82, 0x34, 0xf3, 0xed, 0xd1, 0x24, 0x00,
+  0x0b, 0xfa, 0xd5, 0x8f, 0xa6, 0x39, 0xdf, 0xe4, 0x2f, 0x9f, 0xaf, 0x34, 0x81, 0xb3, 0x0b, 0x9e,
+  0x35, 0x5e, 0x21, 0x75, 0x38, 0x64, 0xd1, 0x22, 0x66, 0x65, 0xda, 0x57, 0x30, 0x2c, 0xa7, 0x9d,
+  0x42, 0xcc, 0x5b, 0x36, 0x0f, 0xf3, 0xce, 0xd2, 0x44, 0x99, 0x84, 0x2f, 0x5d, 0x53, 0x0c, 0xb3,
+  0x5d, 0x06, 0x04, 0xd3, 0xdd, 0x45, 0xf0, 0xef, 0xa8, 0xd3, 0x5a, 0x20, 0xca, 0xd2, 0x22, 0x4c,
+  0xe4, 0xef, 0x85, 0x7a, 0xe2, 0xc4, 0xf5, 0x02, 0x76, 0x8b, 0x06, 0xec, 0x3b, 0x9b, 0xcd, 0x9a,
+  0x51, 0xe2, 0x66, 0x39, 0x0e, 0x82, 0x9a, 0xad, 0xeb, 0x86, 0x21, 0xec, 0x3a, 0xdf, 0x1c, 0x8c,
+  0xb2, 0x2f, 0x5e, 0x53, 0x30, 0x2f, 0x29, 0xca, 0x74, 0x09, 0x49, 0x72, 0xa9, 0xea, 0x1d, 0xb3,
+  0x2c, 0x8e, 0x06, 0x8a, 0x8b, 0xe4, 0x19, 0x2c, 0x97, 0x46, 0xde, 0x94, 0x5f, 0x2c, 0x49, 0xc5,
+  0x72, 0x75, 0xa2, 0x60, 0xf2, 0x57, 0xbd, 0x01, 0xf0, 0x78, 0xf2, 0x0a, 0x1c, 0x9a, 0x7b, 0x22,
+  0xfe, 0xb0, 0x63, 0xbd, 0x3c, 0xc2, 0x9c, 0x14, 0x69, 0xe4, 0xd7, 0x40, 0x9b, 0xa6, 0x95, 0xe5,
+  0x31, 0x3f, 0x06, 0x76, 0x13, 0x1c, 0x72, 0xc2, 0xcd, 0xd7, 0x07, 0x6f, 0xde, 0x1d, 0xbc, 0x32,
+  0xb6, 0xaa, 0x4d, 0x58, 0x50, 0xb1, 0xb5, 0x2d, 0x57, 0xc0, 0xfb, 0x07, 0x18, 0xcb, 0x9a, 0x27,
+  0x6f, 0x5f, 0x36, 0xed, 0x45, 0x4c, 0x3a, 0x34, 0x1d, 0x2f, 0x23, 0x72, 0x79, 0xf6, 0x7a, 0x09,
+  0x91, 0x2c, 0x98, 0x6a, 0xda, 0x32, 0xf5, 0xb1, 0x0c, 0x3a, 0x7d, 0x6d, 0x17, 0x89, 0xf1, 0x16,
+  0x60, 0x28, 0xc5, 0x58, 0x83, 0x78, 0xee, 0xcf, 0x4f, 0xb8, 0x72, 0x5d, 0xe7, 0x37, 0x70, 0x31,
+  0x53, 0xca, 0xb9, 0xcc, 0x31, 0xa1, 0x9e, 0x09, 0xe3, 0xe2, 0x05, 0x84, 0x05, 0xdb, 0x1f, 0x0c,
+  0xa3, 0x21, 0xf6, 0x08, 0x57, 0x47, 0xe4, 0x31, 0x3c, 0xa5, 0x76, 0x85, 0xe2, 0x82, 0x62, 0x45,
+  0xd0, 0x31, 0xcd, 0x05, 0xe4, 0x21, 0x78, 0xc0, 0xf8, 0xb9, 0xcb, 0x58, 0x26, 0x03, 0x22, 0xae,
+  0x84, 0x17, 0x1b, 0x97, 0xaf, 0x94, 0x5f, 0x37, 0x5c, 0xb8, 0x10, 0x9a, 0x94, 0x2f, 0x94, 0x0f,
+  0xb7, 0xe3, 0xfa, 0x53, 0xb5, 0xe6, 0xd3, 0x66, 0x75, 0xea, 0x27, 0xd1, 0x3a, 0xcf, 0x4b, 0xac,
+  0x0c, 0x78, 0x9e, 0xbd, 0x4b, 0xd1, 0xf2, 0xcd, 0x79, 0xb6, 0xdd, 0xeb, 0xa1, 0x41, 0xe6, 0x60,
+  0x9f, 0x78, 0xce, 0xfb, 0x41, 0x48, 0xc0, 0x51, 0xed, 0x23, 0x5c, 0x6e, 0x7b, 0x6b, 0xd0, 0xcb,
+  0x65, 0x13, 0xc9, 0x14, 0x9d, 0x17, 0x39, 0x4f, 0x8b, 0x53, 0x6b, 0xe7, 0x96, 0x9c, 0x67, 0x4e,
+  0x1c, 0xc5, 0x09, 0x45, 0x70, 0x57, 0x0c, 0xb5, 0x74, 0x17, 0xd5, 0xd3, 0xc3, 0xe6, 0xcf, 0xdf,
+  0x5f, 0xfe, 0x92, 0x14, 0xd1, 0x46, 0xcb, 0x09, 0xcd, 0x1c, 0xcd, 0x44, 0x3a, 0xdc, 0x05, 0x7a,
+  0x9a, 0xd6, 0x36, 0xf3, 0x4f, 0x6c, 0x94, 0xaa, 0x57, 0xe6, 0x38, 0x3d, 0x15, 0xad, 0xcd, 0xf3,
+  0xf4, 0x9d, 0x72, 0x67, 0xca, 0x05, 0xc9, 0x5d, 0x86, 0xcd, 0x41, 0x4d, 0x34, 0x7a, 0xc3, 0xf4,
+  0xe5, 0x99, 0xf6, 0x85, 0x0e, 0xfc, 0x75, 0x3e, 0xfc, 0x15, 0xc8, 0xe0, 0x80, 0xaf, 0x07, 0x63,
+  0x28, 0xf9, 0x54, 0xfa, 0xd8, 0x21, 0x7f, 0x75, 0x79, 0xfe, 0xc6, 0x49, 0xf0, 0x5b, 0xa8, 0x48,
+  0xc2, 0xc1, 0xc6, 0x4c, 0xdb, 0xe0, 0xcf, 0x4a, 0x0e, 0xd5, 0x4c, 0x3d, 0x6d, 0x26, 0xbc, 0x44,
+  0x24, 0x2d, 0xda, 0xae, 0x4c, 0xc0, 0x65, 0xb5, 0xc8, 0x75, 0x7c, 0x81, 0x2b, 0x11, 0xfe, 0x44,
+  0x14, 0x8c, 0x4b, 0x65, 0xf5, 0xc2, 0x38, 0xa3, 0xab, 0x1b, 0x51, 0x4f, 0x12, 0x3a, 0x88, 0xe7,
+  0x21, 0x2f, 0xf9, 0x65, 0x39, 0x8e, 0xca, 0xe6, 0xfb, 0xb7, 0xce, 0xc0, 0x56, 0x00, 0xb0, 0x92,
+  0x76, 0x65, 0xf4, 0x1f, 0xd5, 0x5b, 0xdd, 0x32, 0x67, 0x46, 0x59, 0xee, 0x02, 0x45, 0xd1, 0xd1,
+  0xe1, 0x57, 0xf6, 0x2a, 0x64, 0x27, 0x38, 0xe1, 0x2a, 0x98, 0xd2, 0x78, 0xc6, 0x5a, 0xf6, 0xf6,
+  0xe9, 0x90, 0x75, 0x7d, 0x96, 0xa5, 0x27, 0xae, 0x53, 0xc3, 0x23, 0xd2, 0xb4, 0x4a, 0x55, 0xba,
+  0x35, 0x4e, 0x72, 0x3b, 0xc0, 0x58, 0x5d, 0x6a, 0x87, 0x6b, 0xbd, 0xa5, 0xaf, 0x55, 0xb5, 0xc1,
+  0xb1, 0x07, 0x76, 0xce, 0xdc, 0xb3, 0x68, 0x14, 0x57, 0x54, 0x77, 0x98, 0xc6, 0x04, 0xf0, 0xea,
+  0xa1, 0x3d, 0x09, 0x5d, 0xad, 0xb5, 0x60, 0x56, 0xf4, 0x51, 0x2b, 0xd0, 0x4c, 0xbe, 0xd9, 0x59,
+  0x85, 0x90, 0xd1, 0xec, 0xaa, 0xa0, 0x95, 0xce, 0x22, 0x84, 0xfe, 0x62, 0xcc, 0xca, 0x54, 0x79,
+  0xf7, 0xab, 0x82, 0x62, 0xfe, 0x4e, 0xa7, 0x24, 0x22, 0xeb, 0x4c, 0xb4, 0x17, 0xbf, 0xfe, 0x9a,
+  0xa8, 0xcf, 0x0e, 0x5e, 0x35, 0x0a, 0x6e, 0xa8, 0x7f, 0x3d, 0xbc, 0xc5, 0x9b, 0x85, 0xfb, 0xa4,
+  0x6f, 0x3a, 0x9e, 0xc0, 0xd4, 0x19, 0xa7, 0x2c, 0xa6, 0xec, 0x18, 0x6f, 0x17, 0xb2, 0x88, 0xed,
+  0xb3, 0x12, 0x87, 0xcd, 0x57, 0xf0, 0x94, 0x08, 0x5a, 0xdb, 0x18, 0x30, 0x0d, 0x7a, 0x84, 0xb4,
+  0x66, 0x36, 0x53, 0x3d, 0xf0, 0xeb, 0xb5, 0x8d, 0x76, 0x1e, 0x28, 0xfa, 0x22, 0x50, 0x7c, 0x73,
+  0x88, 0xe0, 0x0e, 0xc3, 0xc7, 0xdf, 0x06, 0x09, 0xc6, 0x46, 0xc2, 0x3f, 0x74, 0xf7, 0x89, 0x7c,
+  0x1e, 0x4c, 0x01, 0xcd, 0x96, 0xd3, 0x00, 0x26, 0x20, 0xcb, 0xb0, 0xd9, 0x68, 0xe2, 0xc1, 0x80,
+  0x24, 0x34, 0x15, 0xf3, 0x61, 0x97, 0xd8, 0xc1, 0x2a, 0x23, 0x2d, 0x1c, 0x33, 0x73, 0x3e, 0x0c,
+  0x93, 0xcc, 0x7e, 0xf9, 0xcd, 0x61, 0x2f, 0x6b, 0x57, 0x0a, 0x18, 0x44, 0xd7, 0x49, 0x1a, 0x8f,
+  0xf9, 0x29, 0x04, 0x30, 0x8e, 0xdf, 0xb5, 0x27, 0xea, 0x01, 0x32, 0x34, 0x73, 0xe2, 0x0f, 0xf8,
+  0x82, 0x33, 0xd7, 0x51, 0xad, 0x30, 0x22, 0x96, 0xe2, 0x5b, 0xcd, 0x00, 0xd3, 0xbb, 0x27, 0xa6,
+  0xb9, 0x54, 0x93, 0x71, 0x49, 0x11, 0xa2, 0xb7, 0x28, 0x9b, 0xed, 0xb2, 0xbb, 0x78, 0x6e, 0x74,
+  0xad, 0xc6, 0xd8, 0x5e, 0xa1, 0x2d, 0xb1, 0x2c, 0x1f, 0xaf, 0xcc, 0xc9, 0x97, 0xd2, 0x30, 0xd2,
+  0x1b, 0x53, 0xc8, 0xbb, 0x95, 0xda, 0x88, 0x78, 0x34, 0x81, 0x38, 0xb1, 0x4a, 0x23, 0xb1, 0xdc,
+  0x95, 0xcd, 0x59, 0xe5, 0xc0, 0xec, 0xe1, 0xfd, 0xc2, 0x74, 0xda, 0x6a, 0x62, 0x13, 0x36, 0x87,
+  0x7d, 0x3c, 0x36, 0x4a, 0x54, 0x27, 0x56, 0x1d, 0x68, 0xa8, 0x53, 0x99, 0x17, 0xbf, 0xf8, 0x45,
+  0x04, 0xff, 0x5d, 0x15, 0x47, 0x4b, 0x73, 0xbc, 0xb5, 0x2b, 0xcf, 0x53, 0x9d, 0x66, 0xbb, 0x0d,
+  0x9f, 0xd9, 0x2c, 0x8d, 0x76, 0x2a, 0xf0, 0x4d, 0xf1, 0xf3, 0x08, 0xfd, 0x2b, 0x37, 0xa4, 0x29,
+  0xb3, 0x3a, 0x57, 0x35, 0x0a, 0x15, 0x43, 0x9b, 0x79, 0xe3, 0x59, 0x77, 0x43, 0x5b, 0x95, 0xb5,
+  0x4d, 0xad, 0xb3, 0xd3, 0x33, 0xbc, 0x74, 0x78, 0xf2, 0xb3, 0xb3, 0xa3, 0x13, 0x72, 0xfa, 0xee,
+  0xcd, 0xd1, 0xd5, 0xd9, 0xf9, 0x9b, 0xcb, 0xfa, 0xa6, 0x96, 0x11, 0x05, 0xf0, 0x94, 0x58, 0xdc,
+  0x3e, 0xa9, 0x08, 0x04, 0xda, 0xdd, 0x93, 0x1f, 0x22, 0x16, 0x80, 0x04, 0xf2, 0xf6, 0x5a, 0x20,
+  0xef, 0x2d, 0xae, 0x82, 0xc4, 0xf9, 0x0d, 0xc3, 0x0a, 0x24, 0xce, 0xdf, 0x91, 0xef, 0xbe, 0xc3,
+  0x8c, 0xb6, 0xb9, 0x12, 0xb6, 0xab, 0xec, 0xb4, 0x82, 0x60, 0x9e, 0xb8, 0xde, 0x87, 0x9e, 0xbc,
+  0x02, 0x58, 0x41, 0x4e, 0xbe, 0x79, 0x10, 0x77, 0xfc, 0xe8, 0x75, 0x19, 0x8b, 0xd6, 0xc1, 0x6c,
+  0xb3, 0x0c, 0x31, 0xda, 0x3d, 0x3f, 0x1b, 0x61, 0x96, 0xa9, 0x5c, 0xea, 0x48, 0x7c, 0x8d, 0x41,
+  0x53, 0x37, 0x3e, 0xaf, 0x03, 0x47, 0x6c, 0x67, 0xe2, 0x79, 0xb3, 0xf0, 0x9a, 0x55, 0xe4, 0xd5,
+  0x9c, 0xac, 0x42, 0x5a, 0x2f, 0x0c, 0xe0, 0xe3, 0x35, 0x2f, 0x6f, 0x4a, 0x8d, 0xa5, 0x83, 0x0b,
+  0x82, 0x5f, 0xe6, 0x5c, 0x4d, 0xaf, 0xf2, 0x22, 0x54, 0xc5, 0x1a, 0x41, 0xb2, 0x3a, 0x01, 0xbc,
+  0x09, 0xb5, 0x94, 0x4d, 0x08, 0xfa, 0x30, 0x8c, 0x47, 0x28, 0xff, 0x70, 0xca, 0x59, 0x7d, 0xd3,
+  0x3b, 0xa8, 0x30, 0x8e, 0xa7, 0x6e, 0x55, 0xcb, 0x94, 0x01, 0x9d, 0x65, 0x65, 0x2b, 0xe5, 0x37,
+  0x9d, 0x0c, 0x1b, 0xe1, 0x83, 0x2f, 0x01, 0x75, 0xcd, 0x7a, 0xab, 0xe0, 0xba, 0x7d, 0xeb, 0xd0,
+  0x28, 0x14, 0x23, 0x51, 0xc2, 0xdf, 0xc7, 0xcf, 0x1c, 0x96, 0x06, 0xd3, 0x96, 0xd1, 0x3c, 0xc3,
+  0xd7, 0x8e, 0xb8, 0x6f, 0x0a, 0xd9, 0x13, 0xa4, 0x18, 0x9a, 0x82, 0xf0, 0x82, 0x81, 0x58, 0xfe,
+  0x75, 0x06, 0x95, 0x04, 0xef, 0x19, 0xb0, 0x38, 0x06, 0x68, 0x83, 0xe2, 0x41, 0xbf, 0xdd, 0xe9,
+  0x82, 0xd3, 0xa4, 0x90, 0x2b, 0x74, 0x44, 0xa5, 0xa0, 0x41, 0xb3, 0x19, 0x23, 0xee, 0xec, 0xb3,
+  0xb9, 0x82, 0xc5, 0x6b, 0x94, 0xf5, 0x05, 0x3f, 0xd3, 0xe6, 0xf8, 0x1c, 0x79, 0x60, 0xed, 0x77,
+  0x6f, 0xcf, 0x8e, 0xe2, 0x69, 0x02, 0xa1, 0x34, 0x62, 0x9c, 0xd3, 0xf6, 0x0f, 0x1f, 0x50, 0x2c,
+  0x21, 0xb1, 0xa7, 0xcc, 0xbb, 0x20, 0x19, 0xd4, 0x23, 0x58, 0xd8, 0x1a, 0x89, 0x85, 0x0d, 0xea,
+  0x4b, 0x63, 0x90, 0x45, 0x9d, 0xdf, 0x17, 0x35, 0xe2, 0x90, 0x52, 0x59, 0x8d, 0x07, 0x94, 0xae,
+  0x87, 0xd6, 0x05, 0x76, 0x9a, 0xe1, 0x01, 0x88, 0x08, 0x00, 0x91, 0x30, 0x54, 0xf9, 0x76, 0xed,
+  0x8b, 0xfa, 0xb0, 0xad, 0x9b, 0x82, 0x2f, 0xda, 0x7c, 0x6c, 0x55, 0x57, 0x6b, 0xf8, 0x9e, 0xb0,
+  0xd9, 0x6c, 0xfe, 0x90, 0xe6, 0xe1, 0xb7, 0xb8, 0xee, 0x65, 0x9f, 0x0a, 0x91, 0xe4, 0x85, 0x36,
+  0x73, 0xb3, 0xd2, 0x70, 0x85, 0xad, 0x0a, 0xd3, 0x8b, 0x3c, 0x96, 0x96, 0xda, 0x79, 0xd9, 0x58,
+  0x7b, 0xb7, 0x24, 0x69, 0xcd, 0x47, 0x68, 0xff, 0xde, 0xc9, 0x9e, 0x62, 0x8d, 0x1f, 0x02, 0xf8,
+  0x1b, 0xd4, 0xf7, 0x5d, 0x71, 0x08, 0x30, 0xda, 0xf2, 0x9f, 0xc3, 0xe7, 0xd2, 0x64, 0x75, 0x74,
+  0xa0, 0xcf, 0x1b, 0x6c, 0x6e, 0x3e, 0x5f, 0xdb, 0x10, 0xf3, 0x9e, 0xaf, 0x0d, 0x3c, 0xf8, 0xac,
+  0xe6, 0x69, 0x55, 0x3a, 0x38, 0x2a, 0x1a, 0xbf, 0x92, 0x53, 0x91, 0x1a, 0x93, 0xbb, 0x0e, 0xd9,
+  0x2c, 0x2a, 0xf7, 0x2a, 0xe8, 0x13, 0x97, 0xec, 0x0c, 0x3d, 0xf2, 0x80, 0xbf, 0x77, 0x0f, 0xd8,
+  0xb6, 0x20, 0x8f, 0x9f, 0x21, 0x8a, 0x0e, 0xec, 0x62, 0x1a, 0x38, 0xc8, 0x3e, 0x60, 0xe6, 0x5b,
+  0xce, 0x8e, 0x22, 0xe8, 0x01, 0xc8, 0x28, 0x77, 0xa0, 0x0b, 0x71, 0x8d, 0x8d, 0x8a, 0x6f, 0x29,
+  0x1a, 0x97, 0x61, 0x57, 0x06, 0x47, 0x73, 0x63, 0x73, 0xc4, 0x10, 0x61, 0x43, 0x7e, 0xe3, 0x45,
+  0x66, 0xe6, 0xfc, 0x3b, 0x13, 0xdc, 0x47, 0xb9, 0x4e, 0x20, 0x1c, 0x8a, 0xe7, 0x0b, 0x6e, 0xb2,
+  0x21, 0x26, 0xc8, 0xf6, 0x49, 0x45, 0x02, 0x6f, 0x08, 0x72, 0xc9, 0xe7, 0x3b, 0x8e, 0xd3, 0xb4,
+  0xf6, 0xa8, 0x99, 0xbd, 0x22, 0x66, 0xe3, 0xf2, 0x75, 0x98, 0x2d, 0x94, 0x05, 0xbc, 0x7d, 0x8d,
+  0xfa, 0xac, 0x1b, 0x85, 0xef, 0xca, 0xc8, 0x0e, 0x3b, 0x49, 0x5c, 0x9c, 0x26, 0x07, 0xc3, 0x38,
+  0x65, 0xe2, 0x16, 0xb5, 0xc3, 0xa4, 0x83, 0x6d, 0xa1, 0xeb, 0xfc, 0x20, 0x88, 0x94, 0xcb, 0xbc,
+  0x08, 0xfa, 0x6b, 0xf0, 0xc3, 0x4a, 0xc0, 0xb9, 0xb1, 0xc2, 0xe0, 0x03, 0x0d, 0x6f, 0xc5, 0x9e,
+  0xa1, 0x3e, 0x80, 0x2f, 0xbd, 0xa1, 0x11, 0x5a, 0x55, 0xde, 0x53, 0xc4, 0x5b, 0x8e, 0x19, 0x40,
+  0x55, 0xc6, 0xf0, 0xba, 0x22, 0x85, 0xa2, 0x6a, 0x96, 0x81, 0xc5, 0xc0, 0x36, 0xb2, 0xb8, 0xaa,
+  0xe3, 0x4f, 0x7d, 0xe5, 0x29, 0x5f, 0x01, 0x56, 0xf3, 0x89, 0x6a, 0x88, 0xe1, 0xa6, 0xe1, 0x67,
+  0x39, 0xe9, 0x2c, 0x81, 0x14, 0xae, 0xed, 0x90, 0x23, 0xdb, 0xf6, 0xbc, 0x69, 0x59, 0xb2, 0xe8,
+  0xc2, 0x4b, 0x0a, 0xfa, 0xe5, 0xd9, 0xfa, 0xd0, 0x23, 0x16, 0x28, 0x4a, 0xc5, 0x28, 0x9e, 0x2f,
+  0x08, 0x35, 0x22, 0xd5, 0x13, 0xb3, 0x1e, 0x29, 0xca, 0xe4, 0x3a, 0x93, 0xcc, 0x09, 0x5f, 0x06,
+  0x5d, 0x68, 0x77, 0x38, 0x91, 0x5f, 0x6c, 0x96, 0xcb, 0x4d, 0x5a, 0xa9, 0x97, 0xda, 0xa0, 0x61,
+  0x2f, 0x70, 0xff, 0xa0, 0x6e, 0x81, 0x9b, 0xa9, 0x53, 0x11, 0x88, 0xaa, 0xb6, 0xbd, 0x5d, 0x90,
+  0xe3, 0xb7, 0x68, 0x20, 0x53, 0xe7, 0xb9, 0x31, 0x90, 0x8e, 0xf0, 0x20, 0x6c, 0x79, 0x91, 0xce,
+  0x4d, 0xf0, 0x98, 0x61, 0x5e, 0xe9, 0xe7, 0x9e, 0x41, 0xbe, 0x2a, 0xeb, 0x6e, 0xde, 0xa3, 0x02,
+  0xd1, 0x51, 0xdb, 0x9a, 0xba, 0x8a, 0x31, 0x1f, 0x16, 0xff, 0x0d, 0x59, 0x1f, 0x10, 0xfd, 0xd5,
+  0x85, 0xf0, 0xbf, 0xf4, 0xd8, 0x8f, 0x00, 0xca, 0xf7, 0xd2, 0x3c, 0x80, 0x62, 0x44, 0x6b, 0xf0,
+  0xe3, 0x79, 0x85, 0x75, 0x56, 0xf1, 0x44, 0x36, 0xef, 0xad, 0x93, 0x34, 0x41, 0xcf, 0xb8, 0xc7,
+  0x84, 0x64, 0xcf, 0xc4, 0x3f, 0x05, 0x2a, 0xdc, 0xff, 0x89, 0xca, 0x14, 0xf3, 0x1e, 0xfd, 0xce,
+  0x93, 0xba, 0xe4, 0x71, 0xb7, 0xa7, 0x2e, 0x1c, 0xee, 0xf6, 0xc4, 0x3f, 0x9b, 0xb4, 0xdb, 0x13,
+  0xff, 0x64, 0xe9, 0xff, 0x03, 0xf7, 0x4d, 0xf4, 0x5e, 0xca, 0x54, 0x00, 0x00,
+};
+static const WebAsset WEB_INDEX_HTML = {WEB_INDEX_HTML_GZ, sizeof(WEB_INDEX_HTML_GZ), "text/html", "\"35c8d17a6b91d245\""};
+
+// tables.html: 23875 bytes -> 5599 gzip
+static const uint8_t WEB_TABLES_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x3c, 0xcb, 0x8e, 0x1b, 0x49,
+  0x72, 0x77, 0x7d, 0x45, 0x0e, 0x05, 0x0f, 0x8b, 0x16, 0x5f, 0xdd, 0x52, 0x4b, 0x5a, 0xb2, 0xd9,
+  0x82, 0xd4, 0x92, 0x66, 0xdb, 0x96, 0x46, 0x0d, 0x49, 0x63, 0x61, 0x31, 0x58, 0x08, 0xc9, 0xaa,
+  0x24, 0x99, 0xea, 0x62, 0x15, 0xb7, 0xaa, 0xa8, 0x16, 0x57, 0xab, 0xa3, 0x07, 0x5e, 0x5f, 0xd6,
+  0x18, 0x03, 0x9e, 0x8b, 0x01, 0x9f, 0x7d, 0xdc, 0x35, 0xe0, 0xb5, 0x2f, 0x3e, 0x68, 0x3e, 0x60,
+  0xff, 0x61, 0x7e, 0xc0, 0xfe, 0x04, 0x47, 0x44, 0x66, 0x55, 0x65, 0xd6, 0xa3, 0xf9, 0xe8, 0x6e,
+  0x1b, 0x36, 0x06, 0x03, 0x15, 0xf3, 0x11, 0x11, 0x19, 0xef, 0xc8, 0x47, 0x1f, 0x7e, 0xf1, 0xf8,
+  0xc5, 0xf1, 0xeb, 0x5f, 0x9c, 0x3e, 0x61, 0xb3, 0x64, 0xee, 0x1f, 0xdd, 0x38, 0x4c, 0xff, 0x11,
+  0xdc, 0x3b, 0xba, 0xc1, 0xd8, 0xe1, 0x5c, 0x24, 0x9c, 0xb9, 0x33, 0x1e, 0xc5, 0x22, 0x19, 0x35,
+  0xbe, 0x79, 0xfd, 0xb4, 0x73, 0xbf, 0x91, 0x77, 0x04, 0x7c, 0x2e, 0x46, 0x8d, 0xf7, 0x52, 0x9c,
+  0x2f, 0xc2, 0x28, 0x69, 0x30, 0x37, 0x0c, 0x12, 0x11, 0xc0, 0xc0, 0x73, 0xe9, 0x25, 0xb3, 0x91,
+  0x27, 0xde, 0x4b, 0x57, 0x74, 0xe8, 0x47, 0x9b, 0xc9, 0x40, 0x26, 0x92, 0xfb, 0x9d, 0xd8, 0xe5,
+  0xbe, 0x18, 0xed, 0x75, 0xfb, 0x0a, 0x50, 0x22, 0x13, 0x5f, 0x1c, 0x1d, 0x73, 0x5f, 0x8e, 0x23,
+  0x9e, 0xc8, 0x30, 0x60, 0xaf, 0xf9, 0xd8, 0x17, 0xf1, 0x61, 0x4f, 0xf5, 0xe0, 0x98, 0x38, 0x59,
+  0xa9, 0x2f, 0xc6, 0xc6, 0xa1, 0xb7, 0x62, 0x1f, 0xd9, 0x04, 0x30, 0x75, 0x26, 0x7c, 0x2e, 0xfd,
+  0xd5, 0x80, 0x3d, 0x8c, 0x00, 0x6e, 0x9b, 0xc5, 0x3c, 0x88, 0x3b, 0xb1, 0x88, 0xe4, 0x64, 0xc8,
+  0xe6, 0xfc, 0x83, 0xc2, 0x3b, 0x60, 0x7b, 0xfb, 0xfd, 0xfe, 0xe2, 0x03, 0x36, 0x45, 0x53, 0x19,
+  0x0c, 0xd8, 0x3e, 0xfc, 0x62, 0x7c, 0x99, 0x84, 0x43, 0xb6, 0xe0, 0x9e, 0x27, 0x83, 0xa9, 0x6a,
+  0x1b, 0xb2, 0x31, 0x77, 0xcf, 0xa6, 0x51, 0xb8, 0x0c, 0xbc, 0x01, 0xbb, 0x39, 0xe9, 0xe3, 0x7f,
+  0x43, 0xf6, 0x89, 0xd0, 0x76, 0x71, 0x69, 0x5c, 0x06, 0x22, 0x02, 0xe4, 0xe6, 0xb8, 0xf3, 0x99,
+  0x4c, 0x44, 0x19, 0x52, 0x18, 0x79, 0x22, 0xea, 0x44, 0xdc, 0x93, 0xcb, 0x78, 0xc0, 0xee, 0xab,
+  0xb6, 0x0f, 0x9d, 0x78, 0xc6, 0xbd, 0xf0, 0x7c, 0xc0, 0xfa, 0x6c, 0x1f, 0x88, 0xb8, 0x03, 0xff,
+  0x47, 0xd3, 0x31, 0x77, 0xfa, 0x6d, 0xfa, 0xaf, 0xbb, 0xd7, 0x4a, 0xc9, 0xec, 0x8c, 0xc3, 0x24,
+  0x09, 0xe7, 0x29, 0x3c, 0x45, 0xc4, 0x6c, 0x0f, 0x90, 0xbb, 0xa1, 0x1f, 0x46, 0x40, 0xdf, 0xed,
+  0xdb, 0xb7, 0xb3, 0xc1, 0x49, 0xb8, 0x00, 0x98, 0xd9, 0xb0, 0x7d, 0x63, 0xd8, 0xdd, 0xbb, 0x77,
+  0x33, 0x72, 0x32, 0x98, 0x80, 0x37, 0x0e, 0x7d, 0xe9, 0xb1, 0x9b, 0xfd, 0xfe, 0xbd, 0xf1, 0x64,
+  0x92, 0xd1, 0x9f, 0x0d, 0x39, 0xc8, 0xb1, 0x26, 0x28, 0x0e, 0x5c, 0xb5, 0x02, 0x02, 0x80, 0x7d,
+  0xbe, 0x88, 0xc5, 0x80, 0xa5, 0x5f, 0x39, 0x6b, 0xf7, 0x90, 0xb5, 0x40, 0x07, 0x49, 0x27, 0x96,
+  0xbf, 0x86, 0x41, 0x7b, 0x77, 0x0c, 0x48, 0xa0, 0x05, 0x89, 0x97, 0x81, 0x82, 0xce, 0x9c, 0x10,
+  0xcf, 0xf3, 0x0c, 0x2e, 0x22, 0x67, 0x88, 0x69, 0x89, 0xf8, 0x90, 0x74, 0x40, 0x37, 0xa6, 0x00,
+  0xdd, 0x05, 0xd5, 0x12, 0x51, 0x0e, 0xac, 0x20, 0x89, 0x6c, 0x2d, 0x7a, 0xe9, 0x5a, 0x32, 0x5a,
+  0x7e, 0x51, 0x78, 0xde, 0x41, 0xad, 0x2e, 0x09, 0xf0, 0xa6, 0xb8, 0x37, 0xb9, 0x8d, 0xd3, 0x88,
+  0xe8, 0x73, 0x21, 0xa7, 0xb3, 0x64, 0x00, 0x14, 0xfa, 0x5e, 0x3a, 0x57, 0x06, 0x8b, 0x65, 0xf2,
+  0x6d, 0xb2, 0x5a, 0x80, 0xae, 0x07, 0xcb, 0xf9, 0x58, 0x44, 0x8d, 0x5f, 0x02, 0x10, 0xad, 0x5e,
+  0x77, 0x49, 0x40, 0xb9, 0xfc, 0xeb, 0xa8, 0xae, 0x58, 0xb3, 0xeb, 0xba, 0x25, 0x55, 0xb9, 0x9d,
+  0xb3, 0xab, 0x0a, 0xef, 0x60, 0x12, 0xba, 0xcb, 0x18, 0xb0, 0x87, 0xcb, 0xc4, 0x07, 0x75, 0xac,
+  0x14, 0xa6, 0x9a, 0x3e, 0x5e, 0x82, 0x28, 0x03, 0x18, 0x9a, 0xd1, 0x46, 0xe2, 0x51, 0x0a, 0x55,
+  0x92, 0x50, 0x4a, 0x5e, 0x10, 0x06, 0xa2, 0x44, 0x14, 0x8d, 0x70, 0x97, 0x51, 0x8c, 0x7c, 0x5d,
+  0x84, 0x52, 0xad, 0x28, 0x95, 0xba, 0xa1, 0x2b, 0xdd, 0x71, 0x12, 0x74, 0x16, 0x91, 0x84, 0xae,
+  0xd5, 0x56, 0xe2, 0x31, 0xe6, 0x0d, 0x66, 0xe1, 0xfb, 0xb2, 0x94, 0xfa, 0xfd, 0x83, 0xbb, 0xe3,
+  0xdb, 0xd6, 0xf8, 0x73, 0x1e, 0x05, 0xb0, 0xae, 0xe2, 0xc8, 0xc9, 0xc4, 0xdd, 0xeb, 0xdf, 0xcb,
+  0xf0, 0x8c, 0x7d, 0xe8, 0xac, 0x9a, 0x57, 0x8d, 0x47, 0xf4, 0xf9, 0xfd, 0x7e, 0xdf, 0x1a, 0x1f,
+  0x0b, 0x30, 0x7e, 0xaf, 0x62, 0x45, 0x77, 0xdd, 0x7b, 0x07, 0xf7, 0xbc, 0x0b, 0x56, 0x94, 0xcd,
+  0xac, 0xc6, 0x75, 0x70, 0xe7, 0x60, 0x7c, 0x77, 0x3f, 0x9b, 0x11, 0x27, 0x3c, 0x21, 0xd9, 0x16,
+  0xcd, 0xc9, 0x12, 0x60, 0xb5, 0x70, 0x3c, 0x19, 0x2f, 0x7c, 0xbe, 0x4a, 0xe5, 0x67, 0x41, 0xec,
+  0xc6, 0x4b, 0xd7, 0x15, 0x71, 0x5c, 0x44, 0xef, 0xdd, 0x11, 0x9e, 0xc7, 0x33, 0xf2, 0x6f, 0xee,
+  0x1d, 0x1c, 0xdc, 0xdb, 0xbf, 0x63, 0xc0, 0x1a, 0xfb, 0xa1, 0xc1, 0x3a, 0x0d, 0x4c, 0x44, 0x51,
+  0x58, 0x5a, 0xc9, 0xe4, 0xbe, 0x77, 0xcf, 0x04, 0x75, 0x6f, 0x7f, 0xcf, 0xbd, 0x00, 0x14, 0xff,
+  0x20, 0xe3, 0x8e, 0xcf, 0xc7, 0xc2, 0x2f, 0x03, 0x9a, 0xfc, 0x6c, 0xc2, 0x2b, 0x8d, 0xd1, 0x54,
+  0xd9, 0x7d, 0x43, 0xe5, 0xc8, 0x3f, 0x75, 0xce, 0x23, 0xbe, 0x58, 0x10, 0x8b, 0x91, 0xd3, 0x13,
+  0x1f, 0xcc, 0xfd, 0xc3, 0x40, 0xbb, 0x79, 0x35, 0x90, 0x1b, 0x5e, 0x31, 0xd5, 0x45, 0x32, 0x54,
+  0x0f, 0xa4, 0xa4, 0x42, 0x8f, 0xcd, 0x3e, 0x9e, 0x49, 0xad, 0x34, 0x0c, 0x88, 0x15, 0x11, 0xda,
+  0x9f, 0x1a, 0x7b, 0xd8, 0xd3, 0x11, 0xea, 0xb0, 0xa7, 0x22, 0xe7, 0x21, 0x86, 0x29, 0x0a, 0x5d,
+  0x9e, 0x7c, 0xcf, 0x5c, 0x9f, 0xc7, 0xf1, 0xa8, 0x91, 0x85, 0x90, 0x86, 0x0a, 0x65, 0x87, 0xb3,
+  0xbd, 0xa3, 0xff, 0xfa, 0xa7, 0xbf, 0xff, 0x5b, 0x56, 0x15, 0xfc, 0xa0, 0x4f, 0x0d, 0x5a, 0x1c,
+  0x1d, 0x72, 0x36, 0x8b, 0xc4, 0x64, 0xd4, 0xe8, 0x35, 0x8e, 0x7e, 0xfa, 0xee, 0xef, 0xd8, 0x23,
+  0x60, 0x18, 0x4b, 0x42, 0xf6, 0x1c, 0x80, 0xb1, 0x53, 0x3e, 0x15, 0x87, 0x3d, 0x7e, 0x74, 0xd8,
+  0x5b, 0x10, 0xbe, 0x1e, 0x20, 0x3c, 0xba, 0xb1, 0x16, 0xf3, 0xfe, 0xd1, 0x69, 0x78, 0x0e, 0x6b,
+  0x23, 0x74, 0xcc, 0x79, 0xb5, 0x10, 0xc2, 0x63, 0x3f, 0xfe, 0xc0, 0x4e, 0xc3, 0x58, 0x12, 0x1d,
+  0x3f, 0x7d, 0xf7, 0x3d, 0x7b, 0xc3, 0x93, 0x24, 0x6e, 0x01, 0x2d, 0xfb, 0x29, 0x2d, 0x8c, 0xd6,
+  0x89, 0x00, 0x8d, 0xe8, 0x62, 0x0a, 0x06, 0xdd, 0x57, 0xe3, 0xe8, 0x9b, 0x18, 0xa0, 0x4d, 0x40,
+  0x4d, 0x44, 0x9c, 0x80, 0x4d, 0x27, 0x68, 0xa5, 0x0b, 0xc2, 0x07, 0x6e, 0x0b, 0x9c, 0x1a, 0xc8,
+  0x1c, 0x47, 0x00, 0x9a, 0x08, 0x62, 0x08, 0x34, 0xc7, 0x84, 0x9f, 0x07, 0x1e, 0x8b, 0x44, 0x2c,
+  0x41, 0xd3, 0x02, 0x57, 0xc0, 0x0c, 0x45, 0x4b, 0x57, 0xaf, 0xcd, 0x5e, 0x93, 0x25, 0x76, 0xbd,
+  0x2e, 0x4c, 0x27, 0x68, 0x41, 0xd2, 0x1b, 0x35, 0x08, 0x21, 0xad, 0xaf, 0x01, 0xdc, 0xa1, 0x76,
+  0x0d, 0x45, 0xf1, 0x28, 0x05, 0x98, 0x4d, 0xd5, 0x0e, 0x53, 0xc3, 0x37, 0x3c, 0x52, 0x03, 0x28,
+  0x75, 0x7d, 0xe9, 0x9e, 0x8d, 0x1a, 0x31, 0x7f, 0x2f, 0x4e, 0x33, 0xc0, 0x4e, 0xab, 0x01, 0x12,
+  0xfc, 0xfe, 0x3f, 0xd8, 0x2b, 0x68, 0x66, 0x06, 0x47, 0x0f, 0x7b, 0x0a, 0xd8, 0x05, 0xb0, 0xb5,
+  0x17, 0x32, 0x60, 0xc3, 0xd2, 0x45, 0x62, 0x03, 0xff, 0xe9, 0xbb, 0x7f, 0xfe, 0xcf, 0x7f, 0xfb,
+  0x1d, 0x7b, 0x89, 0x3d, 0x28, 0xf2, 0xc7, 0x62, 0xc2, 0x97, 0x7e, 0x12, 0xdb, 0xf0, 0x0b, 0x0b,
+  0xca, 0x57, 0xff, 0x8a, 0x4c, 0xb6, 0x91, 0xa2, 0x55, 0x16, 0x8c, 0xdc, 0xd0, 0xe3, 0x77, 0xd3,
+  0x96, 0x57, 0xe7, 0x42, 0x2c, 0x98, 0xf3, 0xe8, 0xd9, 0x13, 0xbd, 0xe4, 0xe7, 0x02, 0xe2, 0xc1,
+  0x2e, 0x7a, 0xf2, 0x54, 0xfa, 0x7e, 0x0c, 0x91, 0x3c, 0xe5, 0x9d, 0x16, 0x5e, 0x00, 0x3c, 0x11,
+  0x2c, 0x92, 0x9e, 0x60, 0xcb, 0x18, 0x75, 0x87, 0xb3, 0x47, 0xfe, 0x52, 0x24, 0x61, 0x08, 0x41,
+  0xff, 0x78, 0x05, 0xec, 0x82, 0x36, 0x35, 0x63, 0x8e, 0xa8, 0x51, 0x91, 0x10, 0xc8, 0x58, 0x9e,
+  0x09, 0xc6, 0x15, 0x40, 0x30, 0x18, 0x11, 0x09, 0x54, 0x23, 0xe7, 0x9c, 0x43, 0xb3, 0x04, 0xa5,
+  0x5b, 0xb1, 0x85, 0xf0, 0x38, 0xcd, 0x1e, 0x0b, 0x50, 0x4f, 0x50, 0x31, 0xe0, 0x39, 0x61, 0x00,
+  0x4e, 0x45, 0x49, 0xab, 0xcb, 0x5e, 0x22, 0x52, 0x9e, 0x10, 0x08, 0xa5, 0x94, 0x63, 0xd4, 0xca,
+  0x78, 0x16, 0x9e, 0x07, 0x43, 0x0d, 0x38, 0x53, 0xd0, 0x38, 0x11, 0x0b, 0xc4, 0x06, 0xce, 0x6b,
+  0x3a, 0xa3, 0xce, 0x54, 0x65, 0xd1, 0xd1, 0x2c, 0xe7, 0x41, 0x8c, 0x38, 0x65, 0x12, 0x0b, 0x7f,
+  0xd2, 0x65, 0x4f, 0xb8, 0x3b, 0x83, 0x6c, 0xc0, 0xf7, 0x99, 0x8c, 0xd9, 0x44, 0x26, 0x09, 0xda,
+  0x48, 0x14, 0xce, 0x11, 0x80, 0x20, 0x60, 0x1c, 0x52, 0xdb, 0xdb, 0x2c, 0x86, 0xcc, 0x22, 0x80,
+  0x2c, 0x31, 0x66, 0x8e, 0xa2, 0xe0, 0x5c, 0x26, 0x33, 0xe0, 0xc9, 0xe7, 0xdf, 0xef, 0xb1, 0xf9,
+  0x02, 0x52, 0xa8, 0x20, 0x64, 0xf1, 0x12, 0x23, 0xc4, 0xb4, 0xd5, 0x66, 0x7c, 0x0c, 0x26, 0xc5,
+  0xf6, 0x0e, 0x60, 0x1a, 0xba, 0x3f, 0x84, 0xdf, 0x65, 0x0f, 0x15, 0x9e, 0x64, 0x06, 0x2b, 0x09,
+  0x04, 0xfa, 0x30, 0xd0, 0x1f, 0x48, 0xa6, 0xe3, 0x14, 0xd6, 0x3e, 0x9b, 0xcb, 0x60, 0x99, 0x40,
+  0x03, 0xd0, 0x12, 0x9f, 0x49, 0xb0, 0x21, 0xaf, 0xcb, 0xbe, 0x0e, 0xb1, 0x73, 0x8a, 0xf9, 0x7e,
+  0x30, 0x85, 0xbe, 0x65, 0x90, 0x48, 0x9f, 0xad, 0xc2, 0xa5, 0xe2, 0x13, 0x03, 0xb3, 0xd6, 0xc2,
+  0x07, 0x85, 0x44, 0x35, 0x6c, 0x93, 0xc9, 0xe2, 0xc2, 0xfb, 0xf4, 0x75, 0xd0, 0x47, 0x0a, 0xc1,
+  0xa8, 0x81, 0x78, 0x0e, 0xec, 0xf5, 0xc5, 0x24, 0xd1, 0x02, 0x59, 0x61, 0x83, 0x61, 0xc9, 0x99,
+  0x8a, 0x94, 0xb5, 0x82, 0xd4, 0x89, 0x41, 0xcc, 0x23, 0xa4, 0x4e, 0xb8, 0x40, 0x8e, 0x72, 0xbf,
+  0x35, 0x60, 0x87, 0x94, 0x12, 0x31, 0x95, 0x12, 0xa1, 0x53, 0x6e, 0x90, 0xae, 0xc7, 0x48, 0xd3,
+  0x5b, 0x52, 0x85, 0x06, 0x83, 0x78, 0xe3, 0x8a, 0x19, 0x44, 0x0c, 0x11, 0x01, 0x70, 0x19, 0xc5,
+  0x09, 0x69, 0xd3, 0x04, 0x03, 0x4c, 0x23, 0x45, 0x9a, 0x96, 0x06, 0x07, 0xe5, 0xe4, 0xad, 0x71,
+  0xb4, 0xb5, 0xbb, 0x49, 0x7f, 0xe1, 0xef, 0x28, 0xff, 0x81, 0x3f, 0x67, 0x47, 0xc4, 0x30, 0xf0,
+  0x3f, 0xb3, 0x52, 0x47, 0xa6, 0x5e, 0x55, 0xbd, 0xa9, 0x23, 0xae, 0xea, 0x7b, 0xa3, 0xf4, 0xa3,
+  0xaa, 0xeb, 0x18, 0xe4, 0x5e, 0xd9, 0x41, 0x4c, 0xb5, 0x3b, 0xe0, 0x57, 0x74, 0x01, 0xe9, 0x9e,
+  0xc1, 0x5b, 0xf4, 0x1c, 0xe0, 0x46, 0xa5, 0x87, 0xae, 0x2d, 0xf1, 0xea, 0x07, 0xe2, 0x72, 0x1a,
+  0x47, 0x9d, 0x8b, 0x07, 0x81, 0x95, 0xac, 0x1d, 0xa3, 0x6d, 0x60, 0xed, 0x38, 0x54, 0xf4, 0xf5,
+  0xa3, 0x48, 0x37, 0xd2, 0x55, 0x14, 0xc6, 0x9a, 0x6c, 0xb0, 0xe2, 0x84, 0x15, 0x4d, 0x08, 0xce,
+  0xe5, 0xa2, 0x49, 0x96, 0x0d, 0x9a, 0xf1, 0x04, 0xfd, 0x0e, 0xa9, 0x08, 0xb9, 0xfb, 0x7f, 0xf8,
+  0x57, 0x74, 0xf7, 0xe4, 0x8c, 0x98, 0x56, 0x9c, 0xb5, 0x81, 0xa4, 0x0a, 0xac, 0x8b, 0xfe, 0xc9,
+  0xcf, 0xe1, 0xfe, 0xee, 0xdf, 0x11, 0xee, 0x31, 0xb5, 0x6e, 0x00, 0xb2, 0x1c, 0xf7, 0x40, 0xed,
+  0xfd, 0x55, 0x0e, 0xef, 0x1f, 0xff, 0xba, 0xec, 0x0c, 0xd6, 0xc7, 0x24, 0xe2, 0xe1, 0xd5, 0xc5,
+  0xa4, 0x27, 0x2f, 0xbf, 0x2a, 0xe5, 0x2f, 0xaf, 0x21, 0x75, 0x86, 0x50, 0xa9, 0x82, 0x03, 0xe6,
+  0x30, 0xa9, 0x1d, 0xed, 0x9c, 0xc6, 0x80, 0xb7, 0x44, 0x44, 0xf3, 0x10, 0x02, 0x03, 0x44, 0x60,
+  0x0f, 0x35, 0x09, 0x9c, 0xa7, 0xa8, 0xca, 0x54, 0xb4, 0x3f, 0x57, 0x34, 0xa8, 0x84, 0x07, 0xdd,
+  0x22, 0x54, 0x4e, 0x10, 0x8a, 0x12, 0x15, 0x50, 0xba, 0xec, 0xaf, 0x38, 0x04, 0xb3, 0x18, 0x57,
+  0x36, 0x07, 0xb7, 0x8b, 0x40, 0xfb, 0x9d, 0xbd, 0x7e, 0xbf, 0xbf, 0x99, 0x77, 0x3c, 0xa4, 0xbc,
+  0xf9, 0xc8, 0x72, 0x85, 0xee, 0x4c, 0xb8, 0x67, 0xe3, 0xf0, 0x83, 0x72, 0x87, 0x22, 0x9a, 0xbe,
+  0x45, 0x42, 0xde, 0x12, 0x05, 0x24, 0x44, 0x72, 0xe8, 0xc0, 0x6c, 0x91, 0x3c, 0x89, 0xa6, 0x4f,
+  0xa1, 0x8f, 0x18, 0x84, 0xa2, 0x84, 0x94, 0x22, 0x92, 0x90, 0xbc, 0xe8, 0x48, 0x64, 0x45, 0xe2,
+  0xc3, 0x9e, 0xc2, 0x95, 0x2a, 0x4a, 0xbc, 0xe0, 0x41, 0x15, 0xeb, 0x1a, 0x47, 0x0e, 0xb2, 0x68,
+  0x19, 0x0b, 0x15, 0x7b, 0x65, 0x00, 0x21, 0x07, 0xd4, 0x23, 0x9c, 0x14, 0x21, 0xb6, 0xa1, 0x54,
+  0xa5, 0x36, 0x1c, 0xaf, 0x8c, 0xcb, 0x0b, 0x61, 0x56, 0x10, 0x62, 0xa0, 0x02, 0x66, 0xb8, 0x69,
+  0x2a, 0x1c, 0x4c, 0x55, 0xb8, 0x7d, 0xaf, 0x98, 0x45, 0x01, 0x98, 0x62, 0x0a, 0x36, 0x7a, 0x44,
+  0xb3, 0x97, 0xf1, 0x1d, 0x93, 0x54, 0x24, 0xee, 0x68, 0xb7, 0x4c, 0x11, 0x18, 0x76, 0x1d, 0x79,
+  0xe2, 0x13, 0x0d, 0xd6, 0xce, 0x12, 0x33, 0xad, 0xdd, 0x3d, 0x47, 0x34, 0x01, 0xef, 0x9e, 0x21,
+  0xc2, 0xaa, 0xaf, 0xce, 0x16, 0x5f, 0x9d, 0x3c, 0x2f, 0xd9, 0xe2, 0x57, 0x50, 0xa1, 0x8a, 0x2b,
+  0x33, 0x42, 0xc4, 0xb0, 0x85, 0x11, 0x4e, 0x09, 0x39, 0x08, 0x1c, 0xf7, 0x5f, 0xa0, 0x46, 0xda,
+  0xd1, 0x10, 0xb7, 0x51, 0xa3, 0x58, 0xce, 0xaf, 0x43, 0x8d, 0x5e, 0x69, 0xb0, 0xb6, 0x1a, 0x65,
+  0x0c, 0xdf, 0x5d, 0x8d, 0x4c, 0xc0, 0xbb, 0xab, 0x11, 0xac, 0xfa, 0x6a, 0x5d, 0xfa, 0xb1, 0x1f,
+  0xa2, 0xc8, 0x9f, 0x85, 0x21, 0x14, 0x19, 0xa7, 0x27, 0xec, 0x35, 0x70, 0x65, 0x17, 0xc5, 0xc9,
+  0x5d, 0x8c, 0x54, 0x6e, 0x69, 0x02, 0x42, 0xef, 0x40, 0xda, 0x0f, 0xec, 0xf0, 0x86, 0x0c, 0x20,
+  0x43, 0x3d, 0x1f, 0x09, 0x37, 0x89, 0xb1, 0x7e, 0x70, 0xb4, 0xd7, 0xfe, 0xe9, 0x6f, 0xbe, 0x87,
+  0xa2, 0x82, 0x43, 0x82, 0x4d, 0xfe, 0x05, 0x3c, 0x17, 0x54, 0x05, 0x5f, 0x01, 0x9d, 0x2a, 0xa3,
+  0x55, 0x29, 0x3f, 0x66, 0xda, 0xe7, 0x50, 0x1c, 0x63, 0xa5, 0x00, 0xa9, 0x37, 0xe6, 0xbc, 0x54,
+  0x25, 0xe0, 0xce, 0x36, 0xa5, 0xd8, 0xd0, 0xda, 0xd3, 0x4a, 0x76, 0xac, 0x90, 0xa0, 0x62, 0x4a,
+  0x4b, 0xd7, 0x3e, 0xff, 0xde, 0x97, 0x73, 0x28, 0x4b, 0x08, 0x64, 0x17, 0xd7, 0x7b, 0xc6, 0x71,
+  0xf7, 0x00, 0x92, 0xed, 0xf0, 0x1d, 0x91, 0xa5, 0xd2, 0x7f, 0x4d, 0x71, 0x5a, 0x0d, 0xdc, 0x62,
+  0xdc, 0x85, 0x28, 0x8e, 0x06, 0xe6, 0xa7, 0x53, 0x5a, 0xe8, 0x56, 0x0d, 0x53, 0x98, 0x87, 0xef,
+  0x75, 0xae, 0x8f, 0xd9, 0x3b, 0x54, 0x05, 0x60, 0x0b, 0xd8, 0xae, 0xe2, 0x00, 0x58, 0x13, 0x15,
+  0x1b, 0xe8, 0x9f, 0xf9, 0x04, 0x73, 0x6d, 0x99, 0x74, 0xd9, 0x49, 0x82, 0xf4, 0x71, 0x36, 0xe7,
+  0xc1, 0x92, 0xfb, 0x54, 0x30, 0x80, 0xce, 0xb4, 0xc9, 0x35, 0x67, 0x0c, 0xc9, 0xa2, 0xc4, 0x3c,
+  0x4c, 0x90, 0xf7, 0x6e, 0x38, 0x5f, 0x20, 0x5b, 0xb4, 0x97, 0x0e, 0x55, 0xe5, 0x06, 0x70, 0x09,
+  0x2d, 0x56, 0x70, 0x90, 0xc0, 0xcf, 0x42, 0xc8, 0xc1, 0x23, 0x81, 0x1b, 0x41, 0xb0, 0xee, 0xd0,
+  0x6f, 0xb3, 0x43, 0x17, 0x0c, 0xf9, 0xa8, 0xd3, 0xc9, 0x16, 0x70, 0xd8, 0xa3, 0x96, 0x56, 0x5a,
+  0x97, 0x11, 0xa1, 0x58, 0x8a, 0x00, 0x7f, 0x08, 0x67, 0x1f, 0xea, 0x80, 0xc9, 0xa4, 0xd5, 0xbd,
+  0xda, 0xdc, 0xfc, 0x49, 0x80, 0x43, 0x2a, 0xf3, 0xef, 0xbf, 0x04, 0xe5, 0x23, 0xc9, 0xf4, 0xde,
+  0xb4, 0x2a, 0xfb, 0x65, 0xd6, 0xff, 0xf9, 0x8f, 0x71, 0xe5, 0x90, 0x67, 0x24, 0x5e, 0x35, 0xaa,
+  0x7a, 0x40, 0x26, 0x72, 0x67, 0x5e, 0x1c, 0xb1, 0x2e, 0x39, 0x5f, 0x97, 0x00, 0x2c, 0xe4, 0x5b,
+  0x11, 0x90, 0x27, 0xf2, 0x2e, 0x9c, 0xa9, 0x37, 0x96, 0xcd, 0x79, 0x67, 0x8b, 0x06, 0x29, 0xe5,
+  0xa8, 0xd1, 0xef, 0xf6, 0x0f, 0x76, 0x84, 0x21, 0x2f, 0x0f, 0x83, 0xcc, 0x23, 0x05, 0xb3, 0xd7,
+  0xdf, 0x01, 0x88, 0xcf, 0xdf, 0xce, 0xe3, 0x14, 0xc2, 0xfe, 0x41, 0x03, 0xab, 0x5e, 0xa0, 0xa8,
+  0x81, 0xc7, 0x43, 0x08, 0xb2, 0x5f, 0x02, 0x5a, 0x5b, 0x0c, 0x5c, 0x41, 0x32, 0x70, 0x2a, 0xcb,
+  0x99, 0xc0, 0xe9, 0xc9, 0xa5, 0xd2, 0x00, 0x05, 0xf2, 0x52, 0x39, 0xc0, 0xa9, 0xbc, 0x3a, 0xf7,
+  0x7d, 0x02, 0x3f, 0x13, 0xc9, 0xc1, 0xe7, 0x81, 0x93, 0x0b, 0x62, 0xae, 0x0a, 0xd8, 0xad, 0x3d,
+  0xf7, 0x43, 0xcf, 0x8b, 0xd9, 0xc9, 0x8f, 0x3f, 0xfc, 0xe9, 0xb7, 0x3f, 0xfe, 0xe0, 0xfd, 0xe9,
+  0xb7, 0x3d, 0x8f, 0x56, 0x85, 0x6e, 0x47, 0xf9, 0x73, 0x95, 0x59, 0x83, 0xcb, 0x8b, 0x81, 0xd7,
+  0x01, 0x38, 0x4a, 0x8a, 0xed, 0x21, 0x8f, 0x69, 0xa3, 0x11, 0x53, 0x45, 0x72, 0x3d, 0x11, 0x13,
+  0x13, 0xf0, 0x26, 0x89, 0xe9, 0xef, 0xb2, 0xfd, 0x46, 0x19, 0x74, 0x96, 0x8b, 0x2e, 0x7b, 0xae,
+  0x3c, 0x1b, 0x3b, 0x51, 0xde, 0x92, 0x2b, 0x30, 0x1d, 0x28, 0x3d, 0x83, 0x81, 0xde, 0xf5, 0xa0,
+  0x6a, 0xac, 0x4d, 0x53, 0xd8, 0x72, 0xc1, 0x16, 0xd0, 0xcf, 0xf6, 0xee, 0xab, 0xad, 0x18, 0xa0,
+  0x09, 0x33, 0x62, 0x88, 0x54, 0xd9, 0xce, 0x92, 0xda, 0x34, 0x81, 0xb4, 0x19, 0xa8, 0xa0, 0x51,
+  0xff, 0x73, 0x3e, 0x2b, 0x65, 0xbf, 0x73, 0x36, 0xfd, 0xfc, 0xc7, 0xf9, 0xe7, 0x3f, 0x54, 0x3a,
+  0x9d, 0xe3, 0x6c, 0x81, 0xd5, 0xdb, 0x04, 0xda, 0xd3, 0xd7, 0xc0, 0xb8, 0x8c, 0x5b, 0x92, 0x8a,
+  0xbc, 0xed, 0xfd, 0x52, 0x3a, 0xd1, 0xf4, 0x29, 0xfd, 0xbd, 0x4a, 0x20, 0x34, 0x9e, 0x64, 0xb8,
+  0xc9, 0x9e, 0x85, 0x1a, 0x18, 0x51, 0xfd, 0xba, 0xf9, 0xbe, 0xc0, 0x65, 0x5d, 0x81, 0x16, 0x93,
+  0xed, 0x0c, 0x74, 0xe3, 0x8e, 0xf5, 0x3e, 0x6d, 0x23, 0x90, 0x64, 0x1f, 0x83, 0x60, 0x4b, 0x5b,
+  0x09, 0xa6, 0xcc, 0x77, 0x82, 0x4f, 0xe5, 0xbf, 0x0d, 0x5f, 0x6f, 0x01, 0xa4, 0x0a, 0xb3, 0xbb,
+  0x1b, 0x33, 0xd8, 0xb1, 0xbb, 0x23, 0xd3, 0x2a, 0x72, 0x85, 0xae, 0xec, 0xf1, 0xb3, 0x27, 0xec,
+  0x78, 0x19, 0x81, 0x68, 0x8e, 0x43, 0xf0, 0x23, 0xd2, 0x95, 0x50, 0x39, 0xc4, 0xbb, 0x6c, 0x72,
+  0x73, 0xdf, 0xc7, 0x33, 0x2e, 0xac, 0x3e, 0x00, 0xda, 0x39, 0xba, 0x8c, 0x20, 0x64, 0xc0, 0x52,
+  0x4a, 0x08, 0xc3, 0x20, 0x80, 0x64, 0x4f, 0x78, 0x78, 0xb0, 0x1a, 0xb3, 0x11, 0xb8, 0xa0, 0x5b,
+  0x6c, 0xfc, 0xe3, 0x0f, 0x69, 0xb2, 0xe7, 0xea, 0xcf, 0xcf, 0x7f, 0x80, 0x1f, 0x5e, 0xfa, 0xe3,
+  0x5f, 0xae, 0xd6, 0xa7, 0x80, 0xcb, 0x00, 0x3a, 0x30, 0x79, 0x4c, 0x2a, 0x7d, 0xc6, 0x98, 0x39,
+  0x78, 0xd8, 0xc5, 0xa3, 0xca, 0x5e, 0x97, 0x39, 0xbf, 0x5a, 0x72, 0x0f, 0xab, 0x76, 0xb7, 0x72,
+  0x00, 0x78, 0x13, 0x77, 0x39, 0x2e, 0x75, 0x6e, 0xe7, 0x4b, 0x2c, 0x87, 0x00, 0x36, 0xfd, 0x96,
+  0x1b, 0xde, 0x60, 0x6f, 0x5b, 0x8f, 0x82, 0x00, 0xc6, 0x97, 0x05, 0xe0, 0xae, 0xf7, 0x47, 0x6b,
+  0x20, 0x78, 0x26, 0x84, 0x32, 0x88, 0xeb, 0x73, 0x41, 0x80, 0x9c, 0x94, 0xbb, 0xe0, 0x84, 0x32,
+  0xa5, 0xbf, 0x84, 0x39, 0x9b, 0xa0, 0x2f, 0x61, 0xd0, 0x00, 0x66, 0x0b, 0x6b, 0x8e, 0xdd, 0x48,
+  0x2e, 0x12, 0x05, 0xa3, 0xd7, 0x63, 0x8f, 0x96, 0xd2, 0xf7, 0x74, 0xb6, 0xf0, 0xf3, 0xd7, 0xcf,
+  0x9f, 0xa9, 0xe8, 0x2e, 0x3c, 0x99, 0x9e, 0x30, 0x81, 0x4c, 0x62, 0x1a, 0x3c, 0x59, 0x06, 0xaa,
+  0x38, 0x1b, 0xe3, 0x14, 0x55, 0x0f, 0xd3, 0xa0, 0x13, 0xaf, 0xcd, 0x3c, 0x9e, 0xf0, 0x16, 0xfb,
+  0xa8, 0x79, 0xe0, 0xe3, 0x1a, 0xc6, 0x3e, 0xd8, 0xa8, 0x17, 0xba, 0xcb, 0x39, 0xb8, 0x83, 0x2e,
+  0x54, 0x8c, 0x4f, 0x7c, 0x81, 0x9f, 0x8f, 0x56, 0x27, 0x5e, 0x3a, 0xb1, 0x35, 0x34, 0x66, 0xe0,
+  0x8d, 0x2a, 0x98, 0xd2, 0x44, 0xfd, 0x46, 0x63, 0x20, 0x1b, 0x68, 0xa6, 0x23, 0x80, 0xd6, 0x63,
+  0x3a, 0x2a, 0x62, 0xea, 0x72, 0x0a, 0x94, 0x4b, 0xbf, 0x60, 0x78, 0x3c, 0xde, 0xd2, 0x03, 0xf0,
+  0x14, 0xd5, 0x41, 0x38, 0xef, 0x00, 0x48, 0x7f, 0x08, 0xff, 0x1c, 0x12, 0x59, 0xdd, 0xd5, 0x43,
+  0x18, 0xd5, 0xf5, 0x45, 0x30, 0x4d, 0x66, 0xd0, 0x7c, 0xeb, 0x56, 0x4e, 0x28, 0x53, 0x48, 0x6f,
+  0x11, 0x56, 0x40, 0x86, 0x9e, 0x23, 0x9b, 0xf2, 0x8c, 0x8e, 0xdd, 0x6f, 0x41, 0xd7, 0x38, 0x2a,
+  0x74, 0x7d, 0xfb, 0xee, 0x97, 0xd4, 0x61, 0x51, 0xf8, 0xe9, 0x46, 0x11, 0x24, 0x2a, 0xa5, 0xb9,
+  0x80, 0xc7, 0x00, 0x80, 0xce, 0x7c, 0x8a, 0x24, 0x4b, 0x45, 0xb2, 0x4c, 0x49, 0xfe, 0x60, 0x91,
+  0x2c, 0x6b, 0x49, 0x46, 0x46, 0x79, 0xa9, 0xd4, 0xf3, 0x8b, 0x3b, 0x8d, 0x9c, 0xdc, 0x0f, 0xf5,
+  0x2b, 0xa1, 0xae, 0x6f, 0x65, 0xba, 0x12, 0x2f, 0x27, 0x75, 0x57, 0x66, 0x2a, 0x39, 0x42, 0x89,
+  0x8b, 0x92, 0xc7, 0xd1, 0xaa, 0xda, 0x05, 0x1c, 0xc0, 0xb0, 0xa1, 0x31, 0xcc, 0x58, 0xc2, 0x05,
+  0x86, 0x8f, 0x94, 0x6a, 0x45, 0x41, 0x1a, 0xdf, 0xe2, 0x6f, 0x99, 0x7d, 0xbd, 0xc3, 0xaf, 0x86,
+  0x2a, 0xa8, 0xd5, 0x58, 0x44, 0x4c, 0x6d, 0xba, 0x10, 0xd2, 0x4e, 0xc2, 0x58, 0xd6, 0xa7, 0x0a,
+  0x26, 0x5a, 0x42, 0x4a, 0x07, 0x80, 0xf6, 0x76, 0x25, 0xc4, 0x9b, 0x88, 0x6c, 0x62, 0x44, 0xc3,
+  0xd5, 0x98, 0x4f, 0x37, 0x6e, 0xe4, 0xea, 0xe8, 0x43, 0x40, 0xd2, 0xc6, 0xa3, 0x0b, 0x7b, 0xc8,
+  0xb2, 0x43, 0xb6, 0xff, 0x98, 0xf1, 0x28, 0xe2, 0x2b, 0xdb, 0x6e, 0x5c, 0x35, 0xbe, 0x60, 0x39,
+  0xa8, 0x0e, 0x6d, 0xec, 0x8b, 0x6d, 0xfb, 0xd1, 0xf0, 0x46, 0xec, 0xdb, 0x8c, 0x73, 0x55, 0xea,
+  0x82, 0xd3, 0x4b, 0x1a, 0x82, 0x63, 0xa0, 0xc3, 0x9a, 0x5c, 0x2d, 0x53, 0xc4, 0x5b, 0x23, 0x46,
+  0xb1, 0x81, 0xfd, 0x56, 0x89, 0xa5, 0x65, 0x0a, 0x1a, 0xa8, 0xe8, 0x2e, 0x96, 0xf1, 0xcc, 0x59,
+  0xe0, 0xc5, 0xc8, 0xa7, 0x7e, 0xc8, 0x13, 0x47, 0xf8, 0x4a, 0x2f, 0x5a, 0xec, 0x37, 0xbf, 0x61,
+  0xfd, 0x56, 0x95, 0x74, 0xd4, 0xe2, 0xd5, 0x4c, 0x00, 0xd1, 0x2a, 0x8a, 0x27, 0x12, 0xc9, 0x32,
+  0x0a, 0xf4, 0x30, 0x4b, 0x2e, 0x19, 0xb7, 0xb1, 0xb8, 0x51, 0x6e, 0xd1, 0x91, 0xc0, 0xe6, 0x79,
+  0x3c, 0x85, 0xca, 0x44, 0x5d, 0xef, 0xb1, 0x19, 0x7d, 0xe1, 0x3a, 0x65, 0xee, 0xa2, 0x80, 0x6c,
+  0x3c, 0x48, 0x3d, 0x56, 0x37, 0x37, 0x61, 0x0e, 0x80, 0x34, 0xfa, 0xc8, 0x08, 0xbf, 0xe6, 0x73,
+  0x81, 0x2e, 0x4c, 0x5f, 0x50, 0x42, 0x7e, 0x38, 0xe9, 0x9d, 0xa2, 0x07, 0xd0, 0xac, 0x3e, 0x9b,
+  0x6c, 0xc0, 0x9a, 0x74, 0x3b, 0xa8, 0x99, 0x41, 0x07, 0xb7, 0xff, 0x5a, 0xce, 0x45, 0xb8, 0x4c,
+  0x1c, 0xa7, 0xc5, 0x46, 0x47, 0xec, 0x63, 0x0d, 0xd0, 0xe6, 0x90, 0x7d, 0x6a, 0xb3, 0xdb, 0x10,
+  0x04, 0x5b, 0x45, 0x85, 0x7c, 0x16, 0x42, 0xe9, 0xc6, 0xf1, 0x38, 0x9b, 0xae, 0xc6, 0xd8, 0xfc,
+  0x00, 0xd6, 0x2b, 0xa7, 0x1d, 0x3b, 0xf9, 0xfa, 0x27, 0x22, 0x71, 0x67, 0x4e, 0x53, 0x05, 0xcc,
+  0xb8, 0xfb, 0x2e, 0x0e, 0x83, 0x66, 0x2b, 0x93, 0x42, 0x17, 0x8b, 0x36, 0x27, 0x42, 0x6a, 0x22,
+  0xea, 0x73, 0x5a, 0xc5, 0x4e, 0x8f, 0x48, 0x35, 0x04, 0x6e, 0x04, 0x87, 0x66, 0x7e, 0xaf, 0xa4,
+  0xd9, 0xb6, 0x06, 0x31, 0x46, 0xbe, 0x67, 0xc0, 0xbc, 0x2e, 0x8d, 0xe9, 0x52, 0xae, 0x86, 0x4d,
+  0x6d, 0x6b, 0xd4, 0xca, 0x1e, 0x05, 0x69, 0x5f, 0x79, 0x4c, 0xee, 0xe0, 0x80, 0xa9, 0x6a, 0x47,
+  0xdd, 0x81, 0x5a, 0xb2, 0xd5, 0xac, 0x00, 0x95, 0x0e, 0x3b, 0x0d, 0xe3, 0x42, 0xb7, 0xd2, 0xa4,
+  0x1c, 0x95, 0xfa, 0x6d, 0x0c, 0xf9, 0x64, 0xa9, 0xb5, 0xb9, 0xca, 0xf4, 0x4c, 0xa4, 0x7e, 0x8d,
+  0x30, 0x62, 0xed, 0x0a, 0x71, 0x0c, 0xa1, 0xbe, 0xaa, 0x15, 0x62, 0xe1, 0xef, 0xbc, 0x69, 0xd5,
+  0xae, 0x13, 0x11, 0xae, 0x59, 0x65, 0x9d, 0x51, 0x34, 0xed, 0x73, 0xb3, 0x66, 0xab, 0x4b, 0xe5,
+  0x2b, 0xd0, 0x35, 0x52, 0x80, 0x8d, 0xce, 0x4a, 0x78, 0xbf, 0x5a, 0x8a, 0x68, 0xf5, 0x4a, 0xa0,
+  0x37, 0x0c, 0xa3, 0x87, 0xbe, 0xef, 0x34, 0x6f, 0xa6, 0x5c, 0x54, 0x19, 0x07, 0x80, 0x04, 0x6f,
+  0x85, 0xf7, 0x40, 0x1c, 0x34, 0xcf, 0x23, 0xb4, 0x85, 0x08, 0x42, 0xdb, 0x8b, 0xc0, 0x5f, 0x55,
+  0x20, 0xa9, 0x95, 0x4d, 0x7a, 0xd0, 0x50, 0x2f, 0x1b, 0x18, 0xb1, 0x56, 0x36, 0x38, 0x86, 0x4e,
+  0x49, 0xae, 0x46, 0x36, 0xea, 0xb4, 0xc7, 0xf9, 0xb3, 0x7a, 0xd9, 0x20, 0xc2, 0x35, 0xb2, 0x49,
+  0xcd, 0x9d, 0x12, 0x51, 0x55, 0x2f, 0xb9, 0x46, 0xf5, 0x65, 0x8c, 0x94, 0x13, 0xe6, 0x78, 0x5d,
+  0xcc, 0x12, 0x5b, 0x05, 0x26, 0xd4, 0xca, 0x57, 0x55, 0x0d, 0x20, 0x04, 0x22, 0x82, 0x18, 0x8e,
+  0x4d, 0x5d, 0x3e, 0xdc, 0x62, 0xfe, 0xb8, 0x3c, 0x7f, 0xbc, 0xcd, 0x7c, 0xb7, 0x3c, 0xdf, 0xdd,
+  0x66, 0xbe, 0x57, 0x9e, 0xef, 0x99, 0xf3, 0xf3, 0x68, 0xf3, 0xc9, 0xf0, 0x6a, 0x2e, 0x47, 0x8f,
+  0x28, 0x50, 0xe7, 0xb0, 0xd0, 0x0b, 0x61, 0x16, 0x79, 0x6a, 0xa7, 0xf9, 0x94, 0x4b, 0x5f, 0x9d,
+  0x47, 0xa0, 0x2b, 0xd5, 0x3e, 0x76, 0x00, 0x9a, 0x25, 0x5a, 0x79, 0x1a, 0x0b, 0x3d, 0x7a, 0xb3,
+  0xd1, 0x6c, 0xca, 0x0a, 0x77, 0xb3, 0x51, 0xdf, 0x11, 0xa8, 0x8e, 0x5e, 0x06, 0xa0, 0x92, 0xb3,
+  0x56, 0x9b, 0xbe, 0x57, 0xe1, 0xac, 0x2f, 0x34, 0x70, 0xda, 0x17, 0x2f, 0xda, 0xb6, 0xda, 0x52,
+  0x1b, 0x6e, 0x01, 0xe3, 0x6c, 0x61, 0xc9, 0xe1, 0x6c, 0xb1, 0xd5, 0x64, 0x69, 0x4f, 0x96, 0xdb,
+  0x4c, 0xa6, 0x5d, 0x71, 0x6b, 0x3e, 0xb5, 0x6c, 0x0c, 0x82, 0xf6, 0xc4, 0xed, 0xf9, 0xe9, 0x31,
+  0x04, 0x74, 0x0c, 0x2f, 0xa7, 0x3e, 0x6a, 0x4b, 0xdb, 0x52, 0x1f, 0xad, 0x03, 0x98, 0x93, 0xd0,
+  0x76, 0x1b, 0xe6, 0x03, 0x20, 0x4f, 0x16, 0x2c, 0x7d, 0xc8, 0x3d, 0xcb, 0xfa, 0x91, 0x69, 0x55,
+  0x49, 0x43, 0xf4, 0x1e, 0xcf, 0xb5, 0xaa, 0x48, 0xbe, 0x47, 0x79, 0x09, 0x1d, 0xc9, 0xf6, 0x2b,
+  0x6d, 0x5b, 0x55, 0xad, 0x26, 0x04, 0xcc, 0xe6, 0x68, 0x57, 0x0d, 0x5c, 0x19, 0x31, 0xa7, 0x75,
+  0x49, 0xfe, 0x6b, 0x1c, 0x55, 0x02, 0xb0, 0x52, 0x48, 0x85, 0xd4, 0xcd, 0x79, 0x5c, 0xbb, 0x16,
+  0x63, 0x2f, 0x15, 0x56, 0x63, 0xa7, 0x8a, 0x2e, 0xdd, 0x09, 0x17, 0x98, 0x0e, 0xa6, 0x9f, 0xa3,
+  0x11, 0xa4, 0x74, 0xd1, 0x32, 0xc0, 0x9d, 0x81, 0x26, 0x26, 0x87, 0xcc, 0xc1, 0x74, 0x11, 0xba,
+  0xf9, 0x7c, 0x81, 0x17, 0x10, 0x21, 0xa1, 0x6e, 0x51, 0xa6, 0x98, 0x27, 0x89, 0x6b, 0x70, 0xab,
+  0xed, 0xd9, 0x5a, 0xe4, 0x84, 0xd1, 0x0b, 0x03, 0x81, 0xe8, 0xdc, 0xae, 0x1a, 0xdd, 0x4d, 0xc2,
+  0xa7, 0xf2, 0x83, 0xf0, 0x9c, 0x3b, 0x2d, 0xc4, 0xd5, 0x69, 0x9a, 0x15, 0x39, 0x07, 0x3e, 0xbc,
+  0x47, 0x99, 0xd8, 0x54, 0xf3, 0x68, 0x2e, 0xbc, 0x26, 0x66, 0xef, 0x95, 0x8b, 0xc9, 0xc8, 0xc5,
+  0xc8, 0xa3, 0x41, 0x7c, 0xf9, 0x25, 0xfb, 0x22, 0x57, 0x6a, 0x33, 0x10, 0x59, 0xaa, 0x4e, 0x9b,
+  0x9c, 0x89, 0x88, 0x40, 0x17, 0x74, 0x1a, 0x5c, 0xad, 0xd2, 0x55, 0x9a, 0x6c, 0x28, 0x70, 0x59,
+  0x5b, 0x5a, 0x6d, 0xb6, 0x97, 0xa7, 0xcc, 0x20, 0x6a, 0xc8, 0x28, 0x62, 0x41, 0x14, 0x7e, 0x91,
+  0x93, 0x58, 0x43, 0xa1, 0x2f, 0x78, 0x94, 0x91, 0x65, 0x8c, 0x19, 0x56, 0x2f, 0x42, 0xd9, 0xab,
+  0x19, 0x64, 0xf2, 0x14, 0xfd, 0x34, 0x0a, 0xa7, 0x74, 0x56, 0x12, 0x27, 0x90, 0xcf, 0xcc, 0x63,
+  0xba, 0x83, 0xaf, 0x0e, 0x6c, 0x04, 0x0a, 0x34, 0x89, 0x56, 0xec, 0x8d, 0x18, 0xbf, 0x0a, 0xc1,
+  0x9c, 0x12, 0x7c, 0x27, 0x01, 0x19, 0x11, 0x67, 0x74, 0x1d, 0x8c, 0x01, 0x7f, 0xb5, 0xd7, 0x01,
+  0x40, 0x3d, 0x6a, 0xa3, 0xb5, 0xe3, 0xe6, 0x68, 0x24, 0x3a, 0x98, 0x1f, 0xa9, 0x3d, 0x53, 0x04,
+  0x47, 0xd7, 0x5a, 0xd3, 0xeb, 0xa9, 0x0e, 0x5e, 0x36, 0x6c, 0x67, 0xf7, 0x3e, 0xda, 0x78, 0xa9,
+  0x56, 0xef, 0x9b, 0xa0, 0x98, 0x09, 0xd4, 0x9b, 0xd8, 0x22, 0x3d, 0x6b, 0x7f, 0xa6, 0x34, 0xe0,
+  0xe3, 0xa7, 0xa2, 0x0b, 0xa2, 0xde, 0x97, 0x4a, 0xe6, 0x0e, 0xa9, 0x41, 0xce, 0x34, 0x5d, 0x9f,
+  0x19, 0xca, 0x71, 0xce, 0x65, 0xa2, 0x2e, 0x17, 0x92, 0xe2, 0x18, 0x3d, 0xea, 0xc2, 0x6d, 0xb1,
+  0x55, 0x1f, 0xa4, 0x37, 0xeb, 0xc3, 0xa3, 0x8e, 0x9f, 0x25, 0xe7, 0x97, 0x33, 0x66, 0x3b, 0xd7,
+  0x47, 0x05, 0x23, 0xce, 0xdd, 0xc5, 0x9d, 0x10, 0xd2, 0xb5, 0xce, 0x44, 0x91, 0xec, 0xd9, 0xf5,
+  0xa7, 0x36, 0x1b, 0xd4, 0x7e, 0x93, 0xa3, 0x9e, 0x32, 0xad, 0xf5, 0xb6, 0x6f, 0xdc, 0x3b, 0x2d,
+  0x99, 0xbe, 0x97, 0xfb, 0x1d, 0x4f, 0xbf, 0x47, 0xc9, 0x3c, 0x4d, 0xda, 0xb0, 0x8d, 0x9f, 0xc9,
+  0xaf, 0xae, 0x96, 0x50, 0xa5, 0xcb, 0x00, 0x33, 0x4a, 0xb1, 0x7e, 0x51, 0x14, 0xfc, 0x03, 0xe8,
+  0xc2, 0xc9, 0x6f, 0xf1, 0x1e, 0x08, 0xe0, 0xc5, 0x43, 0xbf, 0xa6, 0xed, 0x76, 0xd6, 0xa0, 0x06,
+  0x15, 0xde, 0x19, 0x73, 0x76, 0xed, 0x69, 0x1b, 0x84, 0xfa, 0x76, 0x6d, 0x2d, 0x52, 0x04, 0x9c,
+  0xde, 0x42, 0xc7, 0x15, 0xf5, 0x98, 0xe2, 0xad, 0x6e, 0x7b, 0xbb, 0x10, 0x11, 0xdd, 0xbc, 0xdd,
+  0x0a, 0x29, 0x5d, 0xd5, 0xad, 0x10, 0xa6, 0xbe, 0x0b, 0x8f, 0x78, 0xd4, 0x67, 0x5b, 0x63, 0xd3,
+  0x17, 0xd3, 0xa9, 0x27, 0xfd, 0x0e, 0x27, 0xba, 0x93, 0xa0, 0x65, 0xfb, 0x0c, 0xa9, 0x1a, 0xd2,
+  0x35, 0x67, 0xd0, 0x0a, 0x62, 0x10, 0x04, 0x03, 0x7c, 0x97, 0x4a, 0xd7, 0x58, 0xd2, 0x26, 0xbc,
+  0xb6, 0x13, 0xe7, 0x3f, 0x0d, 0x45, 0x52, 0x0d, 0xf8, 0xa4, 0x95, 0xb4, 0x49, 0x61, 0x31, 0x1a,
+  0x49, 0x97, 0x5a, 0xda, 0x5f, 0x6c, 0xb2, 0xb7, 0x5b, 0xb9, 0xdb, 0x98, 0x96, 0xfb, 0xf6, 0x66,
+  0xa3, 0xb5, 0x5f, 0x0b, 0x75, 0x7c, 0xb6, 0xa3, 0x99, 0x0e, 0xaf, 0xdc, 0x9a, 0xad, 0xd9, 0xed,
+  0xab, 0xdc, 0x7f, 0xcd, 0xcb, 0xc1, 0xcb, 0x6c, 0xc0, 0x1a, 0xb5, 0x60, 0x4e, 0x62, 0x06, 0x79,
+  0x9b, 0x5d, 0xd7, 0x6a, 0x3e, 0x14, 0x77, 0xeb, 0x48, 0xc7, 0x46, 0xb0, 0x82, 0x3f, 0x2f, 0xcd,
+  0xc0, 0x4d, 0xb9, 0x61, 0x61, 0x38, 0x1d, 0xc8, 0x61, 0x60, 0x37, 0x8c, 0x47, 0x81, 0x18, 0x8d,
+  0xb4, 0xca, 0xb4, 0x48, 0xb8, 0xfa, 0xe4, 0xae, 0xf0, 0x6e, 0x70, 0x72, 0xdb, 0xf5, 0x86, 0x0d,
+  0xe5, 0x35, 0xea, 0xf6, 0x75, 0x71, 0xc9, 0x0a, 0x0d, 0xac, 0x94, 0x18, 0x00, 0xaa, 0x63, 0x6e,
+  0x08, 0xb3, 0x23, 0xd6, 0x27, 0xfb, 0xb1, 0x1a, 0xc9, 0x4e, 0x5a, 0x55, 0xdc, 0xd9, 0x78, 0xf3,
+  0xf6, 0x62, 0xeb, 0x52, 0x1b, 0x02, 0xad, 0x8a, 0xed, 0x5d, 0x23, 0x6d, 0x31, 0xd8, 0xf2, 0x85,
+  0x0e, 0x8f, 0x26, 0xcf, 0x8b, 0x91, 0xd1, 0x6a, 0x57, 0x91, 0x54, 0x9c, 0xe7, 0x81, 0xdc, 0x69,
+  0x9e, 0xc7, 0x83, 0x5e, 0x0f, 0x79, 0xa0, 0xfc, 0x02, 0x54, 0x12, 0x2e, 0xdd, 0xf9, 0xe8, 0xe2,
+  0x95, 0x2f, 0x32, 0x1a, 0x58, 0xf0, 0xe0, 0xfe, 0x5e, 0xaf, 0xd9, 0x2a, 0x41, 0xeb, 0x86, 0xc1,
+  0x1c, 0x52, 0x06, 0xbc, 0x9a, 0x39, 0x62, 0xe2, 0x7d, 0x52, 0x4c, 0xd1, 0x51, 0x9e, 0x13, 0xe8,
+  0xfa, 0x8b, 0x57, 0x2f, 0xbe, 0xee, 0xd2, 0x3e, 0xab, 0x03, 0xa3, 0xba, 0x74, 0x24, 0x53, 0x94,
+  0x7b, 0x24, 0x28, 0x5c, 0x81, 0xe0, 0x0d, 0x57, 0xd3, 0xc4, 0x5b, 0xa3, 0x13, 0xda, 0x8e, 0xb5,
+  0xc3, 0x89, 0x6a, 0x37, 0x61, 0xbc, 0x18, 0xe3, 0x85, 0xbb, 0x2e, 0xa8, 0xbb, 0x9c, 0x42, 0xc8,
+  0x4c, 0xd9, 0xd0, 0x2e, 0x0c, 0x43, 0x16, 0x16, 0x1c, 0xa8, 0xc6, 0xb1, 0xe1, 0x0e, 0xc4, 0xc5,
+  0xce, 0x77, 0xd2, 0xb5, 0xfa, 0x2f, 0x74, 0xbc, 0xd5, 0x25, 0x7f, 0xc9, 0x11, 0x66, 0x4b, 0x51,
+  0x8e, 0xac, 0xcd, 0x0a, 0x0d, 0x6a, 0xa3, 0xa9, 0x6d, 0x46, 0xc9, 0x4c, 0x57, 0x88, 0xa7, 0xad,
+  0x72, 0x51, 0x4f, 0x28, 0xab, 0xc4, 0xe9, 0xe2, 0xc5, 0x4d, 0x14, 0x82, 0xde, 0xe9, 0x2d, 0x24,
+  0x60, 0xf9, 0x24, 0x33, 0x4d, 0x35, 0x54, 0xb2, 0x4e, 0x23, 0x01, 0x38, 0x81, 0x76, 0x5a, 0x95,
+  0x2a, 0x59, 0x97, 0x97, 0x96, 0x73, 0x14, 0xc5, 0x13, 0x23, 0x28, 0xe8, 0x60, 0x40, 0xb7, 0xdc,
+  0xb7, 0xd8, 0x3e, 0x6f, 0x96, 0x1e, 0x95, 0xd8, 0xd5, 0x81, 0x86, 0x27, 0x7c, 0xd2, 0x56, 0xc8,
+  0x04, 0xbb, 0xea, 0xad, 0xeb, 0x48, 0x61, 0xaa, 0xdd, 0x7a, 0xcf, 0x49, 0x03, 0x07, 0x42, 0xb4,
+  0x91, 0x0e, 0xbc, 0x61, 0x3a, 0x91, 0x41, 0x67, 0x53, 0x02, 0x0a, 0xea, 0x6d, 0x48, 0x0f, 0xba,
+  0xc9, 0x3b, 0x75, 0xe9, 0x52, 0x02, 0x46, 0x74, 0x03, 0x64, 0xf3, 0xe6, 0xfe, 0x7d, 0x7e, 0xef,
+  0xce, 0x01, 0x81, 0xd3, 0xaf, 0x97, 0x6b, 0x52, 0x51, 0xf3, 0x5d, 0x8a, 0xc5, 0x18, 0xf5, 0xe0,
+  0x6e, 0x33, 0xde, 0xa4, 0xe5, 0x6f, 0x37, 0x89, 0xe4, 0x3c, 0x97, 0x9e, 0x95, 0xd2, 0xf6, 0x08,
+  0x13, 0xf9, 0x51, 0x05, 0x1a, 0xc8, 0x7c, 0x40, 0x5f, 0x23, 0x6c, 0x14, 0x01, 0x5e, 0x0c, 0xfd,
+  0xe6, 0xe5, 0x09, 0x5e, 0x29, 0x83, 0x22, 0x2f, 0x48, 0xd4, 0xb0, 0x96, 0xe2, 0x48, 0x9b, 0x7d,
+  0x84, 0x9f, 0xb3, 0xd0, 0xc3, 0xcd, 0xe1, 0x17, 0xaf, 0x5e, 0x37, 0x3f, 0xd5, 0x24, 0xc7, 0xc8,
+  0x68, 0x47, 0x17, 0x53, 0xf3, 0x78, 0x9a, 0x96, 0x53, 0xfa, 0x28, 0xa5, 0x69, 0xbc, 0x4c, 0x69,
+  0xea, 0x53, 0x95, 0xa8, 0x1b, 0x9e, 0xb5, 0x4a, 0xe9, 0x74, 0x66, 0x0d, 0xd5, 0xe9, 0x74, 0x3d,
+  0xcc, 0xa6, 0xba, 0x89, 0x33, 0xa1, 0x04, 0x7b, 0x40, 0x56, 0x8d, 0xfe, 0x85, 0x83, 0x21, 0xd4,
+  0xe5, 0xd6, 0xd6, 0x23, 0x9e, 0xea, 0x82, 0xa0, 0xa7, 0xc6, 0x34, 0xb7, 0xe4, 0x43, 0xb1, 0x53,
+  0x73, 0xe4, 0xe3, 0x3a, 0x9e, 0x24, 0xd1, 0x12, 0x52, 0x77, 0xcb, 0x25, 0xd4, 0xed, 0x53, 0x5c,
+  0xc0, 0x09, 0xf5, 0x0c, 0x69, 0x2b, 0x56, 0x98, 0xcf, 0x8f, 0x32, 0x4e, 0x90, 0xff, 0x80, 0x02,
+  0x66, 0x22, 0xa3, 0xb9, 0xd3, 0x7c, 0x13, 0xc9, 0x44, 0xbd, 0x0e, 0xd1, 0xf9, 0x24, 0x25, 0x88,
+  0xea, 0xe4, 0xb2, 0xf0, 0x0a, 0xe5, 0x01, 0xe4, 0x71, 0xba, 0x98, 0xab, 0xd6, 0x49, 0x42, 0xd7,
+  0xfc, 0x5f, 0x51, 0x2e, 0x75, 0x98, 0xb5, 0x35, 0x4f, 0x1f, 0x22, 0xc5, 0x9b, 0xb0, 0x14, 0x8a,
+  0x6c, 0xba, 0xea, 0x91, 0xb2, 0xb6, 0x70, 0x9e, 0x56, 0x7c, 0xdf, 0x5c, 0x7d, 0x78, 0x6b, 0x9d,
+  0xf9, 0xda, 0x07, 0x62, 0xf7, 0xda, 0xec, 0xa0, 0x64, 0xe9, 0x6a, 0x57, 0xb9, 0xa7, 0xce, 0x55,
+  0xcc, 0x43, 0x0b, 0x9b, 0xbf, 0xf9, 0xc1, 0x81, 0xbe, 0x0c, 0x31, 0x60, 0x1f, 0x9b, 0xda, 0x3d,
+  0x76, 0x5e, 0xaf, 0x16, 0xa2, 0x09, 0x23, 0x51, 0x36, 0x52, 0xa5, 0x19, 0x3d, 0x2a, 0x87, 0x3f,
+  0xe5, 0xd3, 0xf0, 0xd5, 0xfd, 0x40, 0x65, 0x0c, 0x31, 0xf8, 0x9c, 0x60, 0x2a, 0x27, 0x2b, 0xe7,
+  0x63, 0x7a, 0x02, 0xa1, 0xfe, 0xcd, 0x84, 0x98, 0x7d, 0x5c, 0x60, 0x20, 0xb6, 0x79, 0xdc, 0xb0,
+  0xa2, 0xac, 0x16, 0x84, 0xf1, 0xd0, 0xda, 0x36, 0x93, 0x1b, 0xd6, 0x51, 0xc5, 0xb6, 0x87, 0x4e,
+  0x2d, 0xeb, 0x68, 0x73, 0xa8, 0x04, 0x37, 0xc3, 0xb4, 0x00, 0x95, 0x19, 0xf3, 0x30, 0xfd, 0xca,
+  0xaa, 0xb4, 0x9a, 0x1a, 0x85, 0xb1, 0xe9, 0x6c, 0x2a, 0x25, 0xd8, 0xc2, 0x04, 0x4b, 0xaf, 0xd3,
+  0x6b, 0xec, 0x50, 0xdd, 0xf5, 0x31, 0xdf, 0x73, 0xd3, 0x83, 0x1d, 0x75, 0xef, 0xe7, 0x02, 0xcb,
+  0x33, 0x75, 0xa4, 0x47, 0xc8, 0xae, 0xc5, 0xab, 0xd5, 0x8a, 0xab, 0xc0, 0xef, 0x0d, 0xdc, 0x5a,
+  0x81, 0xa3, 0x6a, 0xe1, 0xdb, 0xb0, 0xd4, 0x7e, 0x24, 0xb6, 0x89, 0xa9, 0x19, 0xa7, 0xb2, 0x60,
+  0x68, 0x3f, 0xab, 0x33, 0x34, 0x18, 0xf6, 0x7f, 0xd7, 0xcc, 0x4c, 0x16, 0x67, 0x6f, 0xd4, 0x2c,
+  0x59, 0xad, 0x53, 0x75, 0x73, 0xd6, 0xf6, 0x8a, 0x5e, 0x7a, 0x24, 0x69, 0x27, 0x86, 0xc1, 0x45,
+  0xc9, 0x4f, 0xed, 0x11, 0xf2, 0x03, 0xb6, 0xc7, 0xf0, 0x4f, 0x34, 0xd5, 0xca, 0xab, 0xa7, 0xde,
+  0x34, 0x3e, 0x10, 0x81, 0xce, 0x7b, 0xae, 0x43, 0xf9, 0xab, 0xd9, 0xb9, 0x83, 0xea, 0x5f, 0x8e,
+  0xc3, 0x85, 0x47, 0x8c, 0x17, 0x3a, 0x92, 0xfc, 0x15, 0xd7, 0x56, 0x6e, 0x04, 0x39, 0x7a, 0x7d,
+  0x4e, 0xe4, 0x7a, 0xf8, 0xb8, 0x9b, 0x03, 0xc9, 0x5f, 0xf1, 0x6d, 0xe2, 0x40, 0x8c, 0xab, 0x03,
+  0xf7, 0xc1, 0x87, 0xd4, 0x39, 0x10, 0x18, 0xf6, 0xff, 0xc3, 0x81, 0x64, 0xaf, 0x13, 0xb7, 0x72,
+  0x20, 0xe6, 0xac, 0x1d, 0xd5, 0xbb, 0x42, 0x2c, 0x55, 0xea, 0x8d, 0xcf, 0x38, 0x77, 0x50, 0x6f,
+  0x20, 0xf0, 0x1a, 0xd5, 0xbb, 0x9a, 0x69, 0x3b, 0xa8, 0xb7, 0xc5, 0xc7, 0xdd, 0xd4, 0xdb, 0xb8,
+  0x4e, 0x6c, 0xe9, 0x37, 0xbf, 0xc8, 0x0d, 0xdb, 0x37, 0x3d, 0xcc, 0xb3, 0xbf, 0xf1, 0xda, 0x69,
+  0xe3, 0xaa, 0x69, 0xee, 0xda, 0x69, 0x6e, 0xd5, 0x34, 0x6f, 0xed, 0x34, 0xaf, 0x38, 0x2d, 0x15,
+  0xb4, 0x9b, 0xff, 0x4d, 0xa8, 0x07, 0x9c, 0x42, 0x02, 0x3e, 0x0c, 0x68, 0x7e, 0x39, 0xa6, 0xef,
+  0x31, 0x7d, 0xbb, 0xf4, 0xed, 0xd2, 0xb7, 0x47, 0xdf, 0xde, 0xd5, 0xa8, 0x83, 0x29, 0xc3, 0xfc,
+  0x22, 0x76, 0xa5, 0x09, 0xd5, 0x0b, 0xdf, 0x9a, 0xb8, 0xa3, 0x15, 0x55, 0x49, 0xbf, 0xca, 0x8c,
+  0x8c, 0xfb, 0x42, 0x9b, 0xd9, 0x91, 0xc1, 0xde, 0x6b, 0x34, 0xa4, 0x1a, 0xde, 0xed, 0x60, 0x49,
+  0x36, 0x33, 0x77, 0x4e, 0x35, 0xad, 0x9b, 0x37, 0x9b, 0xa5, 0x33, 0xc5, 0x0b, 0x33, 0x85, 0x4c,
+  0x06, 0x81, 0x9c, 0x2d, 0x36, 0x00, 0x92, 0xdf, 0x98, 0xb1, 0xa6, 0xca, 0x4d, 0xa6, 0xca, 0xaa,
+  0xa9, 0xea, 0xf5, 0xf4, 0x68, 0xbb, 0x0b, 0x33, 0x16, 0x00, 0xbe, 0x6e, 0xb6, 0x75, 0x57, 0x66,
+  0x58, 0x79, 0x61, 0x29, 0x4f, 0xd8, 0xc8, 0x0c, 0xcf, 0x16, 0xf4, 0x0b, 0x38, 0x42, 0xbf, 0xa4,
+  0xfa, 0x45, 0xf7, 0x88, 0xbf, 0x24, 0x42, 0xa8, 0x41, 0x91, 0x4e, 0x6d, 0xca, 0xb6, 0x7d, 0x7e,
+  0xf5, 0x86, 0x6b, 0xbc, 0xed, 0xdc, 0xd2, 0x72, 0xed, 0x99, 0xbb, 0xe7, 0x77, 0x96, 0xb6, 0xd5,
+  0x25, 0x77, 0xa7, 0x27, 0x6c, 0x4a, 0xcf, 0xeb, 0x37, 0x33, 0x5c, 0xc5, 0xf5, 0xeb, 0xcd, 0xed,
+  0x2a, 0xd9, 0x36, 0xb4, 0xae, 0xc1, 0x6d, 0x98, 0xdc, 0x99, 0x6c, 0xdc, 0x31, 0xfe, 0x95, 0xae,
+  0x43, 0xad, 0x37, 0xdb, 0xca, 0x4b, 0x4c, 0x15, 0x76, 0x2b, 0x37, 0x01, 0x22, 0xeb, 0xf4, 0x5f,
+  0x0f, 0x28, 0x18, 0x80, 0xd2, 0x78, 0x79, 0x0d, 0x71, 0xc8, 0x7c, 0xe1, 0xb7, 0x6d, 0x28, 0x2a,
+  0xcc, 0xdd, 0xa1, 0x28, 0x2c, 0x3c, 0xb0, 0x2c, 0x6d, 0xc7, 0xd2, 0x5d, 0x19, 0x7c, 0x61, 0xa9,
+  0x37, 0xb4, 0xaf, 0x25, 0x9c, 0xd4, 0xb2, 0x60, 0x58, 0xb8, 0x90, 0xb9, 0x51, 0x48, 0x29, 0x31,
+  0x65, 0xeb, 0x1d, 0xea, 0xe2, 0xb3, 0x50, 0xfb, 0xa9, 0x14, 0x2c, 0xec, 0x22, 0x05, 0xab, 0xbf,
+  0xdd, 0x65, 0x9e, 0xa5, 0x28, 0x28, 0x78, 0xf1, 0x01, 0xcf, 0x4f, 0xab, 0xb7, 0xe0, 0x4a, 0x2b,
+  0xf9, 0x3a, 0x34, 0xde, 0x71, 0x33, 0x85, 0x82, 0xad, 0xc8, 0x61, 0xa8, 0xf5, 0xe4, 0x9b, 0x73,
+  0xb6, 0x97, 0x59, 0x7b, 0xd6, 0x5a, 0x75, 0xb5, 0x0f, 0x49, 0x1c, 0xde, 0xd8, 0xed, 0x62, 0x21,
+  0x4a, 0x2f, 0xbb, 0xc4, 0x60, 0x9a, 0xfb, 0x45, 0x49, 0x51, 0xc9, 0x25, 0x54, 0xf9, 0x56, 0x8d,
+  0x90, 0xfe, 0x44, 0x47, 0xfa, 0x16, 0x7f, 0x43, 0x1f, 0xab, 0xa7, 0x5e, 0x67, 0x62, 0x74, 0xbd,
+  0x9a, 0xbc, 0xb1, 0xab, 0x4d, 0xef, 0x9b, 0x03, 0x6b, 0x16, 0x78, 0x12, 0x8d, 0xb8, 0x6f, 0xa4,
+  0x57, 0x99, 0xb3, 0x04, 0x4d, 0xfd, 0x85, 0x57, 0xfd, 0xc2, 0xf0, 0xb0, 0xa7, 0xfe, 0xb6, 0xeb,
+  0x61, 0x4f, 0xfd, 0xad, 0xf4, 0xff, 0x06, 0x69, 0x4f, 0x69, 0x42, 0x43, 0x5d, 0x00, 0x00,
+};
+static const WebAsset WEB_TABLES_HTML = {WEB_TABLES_HTML_GZ, sizeof(WEB_TABLES_HTML_GZ), "text/html", "\"dbe19aa462fe3cb5\""};
+
+#endif // WEB_ASSETS_H
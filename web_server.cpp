@@ -7,6 +7,20 @@
 #include "ble_trainer.h"
 #include "sensors.h"
 #include "calibration.h"
+#include "erg_control.h"
+#include "log.h"
+#include "telemetry.h"
+#include "web_assets.h"
+#include "json_stream.h"
+#include "perf.h"
+#include "trainer_state.h"
+#include "recorder.h"
+#include "replay.h"
+#include "sweep.h"
+#include "power_meter.h"
+#include "ota_stream.h"
+#include "fleet.h"
+#include "power.h"
 #include <WiFi.h>
 #include <WebServer.h>
 #include <WebSocketsServer.h>
@@ -24,19 +38,52 @@ static uint32_t otaUnlockedUntilMs = 0;
 static uint32_t gOtaLastProgressMs = 0;
 static size_t gOtaBytes = 0;
 static uint32_t gOtaExpectedSize = 0;
-static uint32_t gOtaWritten = 0;
 static uint8_t gOtaLastPct = 255;
 
 // ==================== WEB SERVER ====================
 static WebServer server(80);
 
+// Every request counts as activity for the idle power mode
+static void route(const char* uri, HTTPMethod method, void (*handler)()) {
+  server.on(uri, method, [handler]() {
+    powerActivity(POWER_WAKE_WEB);
+    handler();
+  });
+}
+
+static void route(const char* uri, HTTPMethod method, void (*handler)(), void (*upload)()) {
+  server.on(uri, method, [handler]() {
+    powerActivity(POWER_WAKE_WEB);
+    handler();
+  }, [upload]() {
+    powerActivity(POWER_WAKE_WEB);
+    upload();
+  });
+}
+
 // ==================== WEBSOCKET SERVER ====================
 static WebSocketsServer webSocket(81);
-static uint32_t lastWsBroadcastMs = 0;
-static const uint32_t WS_BROADCAST_INTERVAL_MS = 200;  // 5 Hz updates
+static const uint32_t WS_BROADCAST_INTERVAL_MS = 200;  // Default 5 Hz updates
+static const uint32_t WS_MIN_INTERVAL_MS = 20;         // Fastest client-selectable rate (50 Hz)
+static const uint32_t WS_KEYFRAME_INTERVAL_MS = 5000;  // Periodic full frame
+static const uint8_t WS_MAX_CLIENTS = 8;
+
+// Per-client telemetry stream (delta state is per client so late joiners get a full frame)
+struct WsTelemetryClient {
+  bool active;
+  bool binary;
+  uint8_t seq;
+  uint32_t intervalMs;
+  uint32_t lastSendMs;
+  uint32_t lastKeyframeMs;
+  TelemetryFrame last;
+};
+static WsTelemetryClient gWsClients[WS_MAX_CLIENTS];
+static char gTelemetryJson[TELEMETRY_JSON_MAX];
+static uint8_t gTelemetryBin[TELEMETRY_BIN_MAX];
 
 // ==================== WIFI MODE TRACKING ====================
-static bool gWifiClientMode = false;  // true = connected to home WiFi, false = AP mode
+bool gWifiClientMode = false;  // true = connected to home WiFi, false = AP mode
 
 // ==================== HELPER FUNCTIONS ====================
 
@@ -48,44 +95,78 @@ static inline int32_t clampLogical(int32_t v) {
 
 // ==================== WEBSOCKET FUNCTIONS ====================
 
-static String buildDiagJson() {
-  String modeStr;
-  switch (gMode) {
-    case MODE_ERG: modeStr = "ERG"; break;
-    case MODE_SIM: modeStr = "SIM"; break;
-    default: modeStr = "IDLE"; break;
-  }
-
-  String json = "{";
-  json += "\"ble\":" + String(deviceConnected ? "true" : "false") + ",";
-  json += "\"pos\":" + String(logStepPos) + ",";
-  json += "\"target\":" + String(logStepTarget) + ",";
-  json += "\"mode\":\"" + modeStr + "\",";
-  json += "\"manual_hold\":" + String(gManualHoldActive ? "true" : "false") + ",";
-  json += "\"enabled\":" + String(gStepEn ? "true" : "false") + ",";
-  json += "\"speed\":" + String(currentSpeedMph, 2) + ",";
-  json += "\"power\":" + String(currentPowerWatts, 1) + ",";
-  json += "\"erg_watts\":" + String(ergTargetWatts) + ",";
-  json += "\"sim_grade\":" + String(simGradePercent, 2) + ",";
-  json += "\"wifi_client\":" + String(gWifiClientMode ? "true" : "false");
-  json += "}";
-  return json;
+// Send one frame to a client if due; full frame when keyframe is due or forced
+static void wsSendTelemetry(uint8_t num, const TelemetryFrame& cur, bool force) {
+  WsTelemetryClient& c = gWsClients[num];
+  const uint32_t now = millis();
+  const bool full = force || (now - c.lastKeyframeMs >= WS_KEYFRAME_INTERVAL_MS);
+  const TelemetryFrame* prev = full ? NULL : &c.last;
+
+  if (c.binary) {
+    size_t n = telemetryEncodeBinary(cur, prev, c.seq, gTelemetryBin, sizeof(gTelemetryBin));
+    if (n > 0) {
+      webSocket.sendBIN(num, gTelemetryBin, n);
+      c.seq++;
+    }
+  } else {
+    size_t n = telemetryEncodeJson(cur, prev, gTelemetryJson, sizeof(gTelemetryJson));
+    if (n > 0) webSocket.sendTXT(num, gTelemetryJson, n);
+  }
+
+  c.last = cur;
+  c.lastSendMs = now;
+  if (full) c.lastKeyframeMs = now;
+}
+
+// Client commands: "rate=<hz>" (1-50), "bin=1" / "bin=0", "full"
+static void wsHandleCommand(uint8_t num, const char* cmd, size_t len) {
+  WsTelemetryClient& c = gWsClients[num];
+  char buf[24];
+  len = min(len, sizeof(buf) - 1);
+  memcpy(buf, cmd, len);
+  buf[len] = '\0';
+
+  if (strncmp(buf, "rate=", 5) == 0) {
+    int hz = constrain(atoi(buf + 5), 1, (int)(1000 / WS_MIN_INTERVAL_MS));
+    c.intervalMs = 1000 / hz;
+    LOG_I("WS", "Client #%u rate %d Hz", num, hz);
+  } else if (strncmp(buf, "bin=", 4) == 0) {
+    c.binary = (buf[4] == '1');
+    LOG_I("WS", "Client #%u format %s", num, c.binary ? "binary" : "json");
+  } else if (strcmp(buf, "full") != 0) {
+    return;
+  }
+
+  TelemetryFrame cur;
+  telemetryCapture(&cur);
+  wsSendTelemetry(num, cur, true);
 }
 
 static void webSocketEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length) {
   switch (type) {
     case WStype_DISCONNECTED:
-      Serial.printf("[WS] Client #%u disconnected\n", num);
+      LOG_I("WS", "Client #%u disconnected", num);
+      if (num < WS_MAX_CLIENTS) gWsClients[num].active = false;
       break;
     case WStype_CONNECTED: {
-      Serial.printf("[WS] Client #%u connected\n", num);
+      LOG_I("WS", "Client #%u connected", num);
+      powerActivity(POWER_WAKE_WEB);
+      if (num >= WS_MAX_CLIENTS) break;
+      WsTelemetryClient& c = gWsClients[num];
+      c.active = true;
+      c.binary = false;
+      c.seq = 0;
+      c.intervalMs = WS_BROADCAST_INTERVAL_MS;
       // Send initial state immediately
-      String diagJson = buildDiagJson();
-      webSocket.sendTXT(num, diagJson);
+      TelemetryFrame cur;
+      telemetryCapture(&cur);
+      wsSendTelemetry(num, cur, true);
       break;
     }
     case WStype_TEXT:
-      // Could handle commands here if needed
+      if (num < WS_MAX_CLIENTS && gWsClients[num].active) {
+        wsHandleCommand(num, (const char*)payload, length);
+      }
       break;
     default:
       break;
@@ -94,609 +175,96 @@ static void webSocketEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t
 
 // ==================== WEB HANDLERS ====================
 
-static void handleRoot() {
-  Serial.println("[HTTP] Root handler called - serving HTML");
-  
-  String html = R"HTML(
-<!DOCTYPE html>
-<html>
-<head>
-  <meta charset="UTF-8">
-  <meta name="viewport" content="width=device-width, initial-scale=1.0">
-  <title>InsideRide Trainer Control</title>
-  <style>
-    body {
-      font-family: Arial, sans-serif;
-      max-width: 800px;
-      margin: 20px auto;
-      padding: 20px;
-      background: #f0f0f0;
-    }
-    .container {
-      background: white;
-      padding: 20px;
-      border-radius: 8px;
-      box-shadow: 0 2px 4px rgba(0,0,0,0.1);
-      margin-bottom: 20px;
-    }
-    h1 {
-      color: #333;
-      margin-top: 0;
-    }
-    h2 {
-      color: #666;
-      border-bottom: 2px solid #007bff;
-      padding-bottom: 5px;
-    }
-    .status-grid {
-      display: grid;
-      grid-template-columns: 1fr 1fr;
-      gap: 10px;
-      margin: 15px 0;
-    }
-    .status-item {
-      padding: 10px;
-      background: #f8f9fa;
-      border-radius: 4px;
-      border-left: 3px solid #007bff;
-    }
-    .status-label {
-      font-size: 12px;
-      color: #666;
-      text-transform: uppercase;
-    }
-    .status-value {
-      font-size: 24px;
-      font-weight: bold;
-      color: #333;
-      margin-top: 5px;
-    }
-    .control-group {
-      margin: 15px 0;
-      padding: 15px;
-      background: #f8f9fa;
-      border-radius: 4px;
-    }
-    .input-group {
-      display: flex;
-      gap: 10px;
-      align-items: center;
-      margin: 10px 0;
-    }
-    input[type="number"] {
-      flex: 1;
-      padding: 10px;
-      font-size: 16px;
-      border: 2px solid #ddd;
-      border-radius: 4px;
-    }
-    button {
-      padding: 10px 20px;
-      font-size: 16px;
-      border: none;
-      border-radius: 4px;
-      cursor: pointer;
-      transition: background 0.3s;
-    }
-    .btn-primary {
-      background: #007bff;
-      color: white;
-    }
-    .btn-primary:hover {
-      background: #0056b3;
-    }
-    .btn-success {
-      background: #28a745;
-      color: white;
-    }
-    .btn-success:hover {
-      background: #218838;
-    }
-    .btn-warning {
-      background: #ffc107;
-      color: black;
-    }
-    .btn-warning:hover {
-      background: #e0a800;
-    }
-    .btn-danger {
-      background: #dc3545;
-      color: white;
-    }
-    .btn-danger:hover {
-      background: #c82333;
-    }
-    .btn-secondary {
-      background: #6c757d;
-      color: white;
-    }
-    .btn-secondary:hover {
-      background: #545b62;
-    }
-    .btn-block {
-      width: 100%;
-      margin: 5px 0;
-    }
-    .mode-indicator {
-      display: inline-block;
-      padding: 5px 15px;
-      border-radius: 20px;
-      font-weight: bold;
-      margin-left: 10px;
-    }
-    .mode-idle { background: #6c757d; color: white; }
-    .mode-erg { background: #28a745; color: white; }
-    .mode-sim { background: #007bff; color: white; }
-    .mode-manual { background: #ffc107; color: black; }
-    .warning {
-      background: #fff3cd;
-      border: 1px solid #ffc107;
-      padding: 10px;
-      border-radius: 4px;
-      margin: 10px 0;
-    }
-  </style>
-</head>
-<body>
-  <div class="container">
-    <h1>🚴 InsideRide Trainer</h1>
-    <div>
-      <strong>Mode:</strong> 
-      <span id="mode" class="mode-indicator mode-idle">IDLE</span>
-    </div>
-  </div>
-
-  <div class="container">
-    <h2>📊 Live Diagnostics</h2>
-    <div class="status-grid">
-      <div class="status-item">
-        <div class="status-label">Roller Speed</div>
-        <div class="status-value" id="speed">0.0 mph</div>
-      </div>
-      <div class="status-item">
-        <div class="status-label">Estimated Power</div>
-        <div class="status-value" id="power">0 W</div>
-      </div>
-      <div class="status-item">
-        <div class="status-label">Current Position</div>
-        <div class="status-value" id="position">0</div>
-      </div>
-      <div class="status-item">
-        <div class="status-label">Target Position</div>
-        <div class="status-value" id="target">0</div>
-      </div>
-      <div class="status-item">
-        <div class="status-label">ERG Target</div>
-        <div class="status-value" id="erg_target">-- W</div>
-      </div>
-      <div class="status-item">
-        <div class="status-label">SIM Grade</div>
-        <div class="status-value" id="sim_grade">-- %</div>
-      </div>
-      <div class="status-item">
-        <div class="status-label">Motor</div>
-        <div class="status-value" id="motor">OFF</div>
-      </div>
-      <div class="status-item">
-        <div class="status-label">BLE</div>
-        <div class="status-value" id="ble">Disconnected</div>
-      </div>
-    </div>
-    <div style="margin-top: 10px; padding: 10px; background: #e7f3ff; border-left: 3px solid #007bff; border-radius: 4px;">
-      <small style="color: #666;">
-        ℹ️ <strong>Motor Auto-Enable:</strong> Motor enables at 2.3 mph, disables at 2.0 mph
-      </small>
-    </div>
-  </div>
-
-  <div class="container">
-    <h2>🎮 Manual Control</h2>
-    
-    <div class="control-group">
-      <label for="goto_input"><strong>Go To Position (0-1000):</strong></label>
-      <div class="input-group">
-        <input type="number" id="goto_input" min="0" max="1000" value="500" />
-        <button class="btn-primary" onclick="gotoPosition()">Go To</button>
-      </div>
-      <small style="color: #666;">Enter any value from 0 (min resistance) to 1000 (max resistance)</small>
-    </div>
-
-    <div class="control-group">
-      <label for="grade_input"><strong>Go To Grade (-4% to 10%):</strong></label>
-      <div class="input-group">
-        <input type="number" id="grade_input" min="-4" max="10" step="0.5" value="0" />
-        <button class="btn-primary" onclick="gotoGrade()">Set Grade</button>
-      </div>
-      <small style="color: #666;">Simulates hill grade using the SIM mode resistance curve</small>
-    </div>
-
-    <div id="manual_warning" class="warning" style="display:none;">
-      ⚠️ Manual override active - App control disabled
-    </div>
-
-    <button class="btn-success btn-block" onclick="resumeApp()">
-      ▶️ Resume App Control
-    </button>
-
-  </div>
-
-  <div class="container">
-    <h2>⚙️ Calibration</h2>
-    <div class="control-group">
-      <p style="margin: 0 0 15px 0;">
-        <a href="/tables" style="display: inline-block; padding: 12px 20px; background: #007bff; color: white; text-decoration: none; border-radius: 4px; font-weight: bold;">
-          📊 Edit Calibration Tables (Power, ERG, SIM, IDLE)
-        </a>
-      </p>
-      <p style="color: #888; font-size: 13px; margin: 0;">
-        Configure the lookup tables used for power estimation, ERG mode, SIM mode, and IDLE curve.
-      </p>
-    </div>
-  </div>
-
-  <div class="container">
-    <h2>📶 WiFi & Device Settings</h2>
-    <div class="control-group">
-      <h3 style="margin-top: 0; color: #444;">Device Identity</h3>
-      <p style="font-size: 13px; color: #666; margin: 5px 0 10px 0;">
-        <strong>Device ID:</strong> <span id="device_id" style="font-family: monospace; background: #e9ecef; padding: 2px 6px; border-radius: 3px;">--</span> |
-        <strong>Hostname:</strong> <span id="hostname" style="font-family: monospace;">--</span> |
-        <strong>AP SSID:</strong> <span id="ap_ssid">--</span>
-      </p>
-      <div style="margin-bottom: 10px;">
-        <label for="device_name"><strong>Device Name (optional):</strong></label>
-        <input type="text" id="device_name" placeholder="e.g., Trainer1, Upstairs, Garage" maxlength="24" style="width: 100%; padding: 10px; font-size: 16px; border: 2px solid #ddd; border-radius: 4px; box-sizing: border-box;">
-        <small style="color: #666;">Custom name for this device (max 24 chars). Leave blank to use MAC-based default.</small>
-      </div>
-      <div style="display: flex; gap: 10px; flex-wrap: wrap; margin-bottom: 15px;">
-        <button class="btn-primary" onclick="saveDeviceName()">💾 Save Name</button>
-        <button class="btn-secondary" onclick="clearDeviceName()">↩️ Use Default</button>
-      </div>
-      <div id="device_msg" style="margin-bottom: 10px; display: none; padding: 8px; border-radius: 4px;"></div>
-
-      <h3 style="color: #444; border-top: 1px solid #ddd; padding-top: 15px;">WiFi Network</h3>
-      <p style="font-size: 13px; color: #666; margin: 5px 0 10px 0;">
-        <strong>Status:</strong> <span id="wifi_status">--</span> |
-        <strong>IP:</strong> <span id="wifi_ip">--</span> |
-        <strong>Signal:</strong> <span id="wifi_rssi">--</span>
-      </p>
-      <div style="margin-bottom: 10px;">
-        <label for="wifi_ssid"><strong>Network (SSID):</strong></label>
-        <input type="text" id="wifi_ssid" placeholder="Type your network name" style="width: 100%; padding: 10px; font-size: 16px; border: 2px solid #ddd; border-radius: 4px; box-sizing: border-box;">
-      </div>
-      <div style="margin-bottom: 10px;">
-        <label for="wifi_pass"><strong>Password:</strong></label>
-        <input type="password" id="wifi_pass" placeholder="Enter WiFi password" style="width: 100%; padding: 10px; font-size: 16px; border: 2px solid #ddd; border-radius: 4px; box-sizing: border-box;">
-      </div>
-      <div style="display: flex; gap: 10px; flex-wrap: wrap;">
-        <button class="btn-success" onclick="saveWifi()">💾 Save</button>
-        <button class="btn-warning" onclick="restartDevice()">🔄 Restart</button>
-        <button class="btn-danger" onclick="clearWifi()">🗑️ Clear</button>
-      </div>
-      <div id="wifi_msg" style="margin-top: 10px; display: none; padding: 8px; border-radius: 4px;"></div>
-      <div style="margin-top: 15px; padding: 12px; background: #fff3cd; border: 1px solid #ffc107; border-radius: 4px;">
-        <strong>⚠️ Important:</strong> After clicking Save, please wait up to 60 seconds.
-        The page may become unresponsive - this is normal. Do NOT power cycle the device.
-        After saving, click Restart, then reconnect to your home WiFi and browse to
-        <strong>http://<span id="hostname_note">insideride-XXXX</span>.local</strong> or the IP address shown in the device logs.
-      </div>
-    </div>
-  </div>
-
-  <div class="container">
-    <h2>🔄 OTA Firmware Update</h2>
-    <p style="color: #888; font-size: 14px; margin: 5px 0;">Current version: )HTML";
-  html += FW_VERSION;
-  html += R"HTML(</p>
-    <div id="ota_blocked" class="warning" style="display:none;">
-      ⚠️ <strong>OTA Blocked:</strong> Disconnect App/BLE before updating firmware
-    </div>
-    <form method="POST" action="/update" enctype="multipart/form-data" id="ota_form">
-      <input type="file" name="update" accept=".bin" style="margin: 10px 0;" id="ota_file">
-      <button type="submit" class="btn-primary btn-block" id="ota_btn">📤 Upload Firmware</button>
-    </form>
-    <div style="margin-top: 15px; padding-top: 15px; border-top: 1px solid #ddd;">
-      <p style="font-size: 13px; color: #666; margin: 5px 0;">
-        <strong>Partition:</strong> <span id="ota_partition">--</span> |
-        <strong>State:</strong> <span id="ota_state">--</span>
-      </p>
-      <button class="btn-warning btn-block" id="rollback_btn" onclick="rollbackFirmware()" style="display:none;">
-        ↩️ Rollback to Previous Firmware
-      </button>
-    </div>
-  </div>
-
-  <script>
-    function updateDiag() {
-      fetch('/diag.json')
-        .then(r => r.json())
-        .then(d => applyDiagData(d))
-        .catch(e => console.error('Update failed:', e));
-    }
-
-    function gotoPosition() {
-      let pos = document.getElementById('goto_input').value;
-      fetch('/goto_hold?pos=' + pos)
-        .then(r => r.text())
-        .then(msg => {
-          console.log(msg);
-          updateDiag();
-        });
-    }
-
-    function gotoGrade() {
-      let grade = document.getElementById('grade_input').value;
-      fetch('/grade_hold?grade=' + grade)
-        .then(r => r.text())
-        .then(msg => {
-          console.log(msg);
-          updateDiag();
-        });
-    }
-
-    function resumeApp() {
-      fetch('/resume_app', {method: 'POST'})
-        .then(r => r.text())
-        .then(msg => {
-          console.log(msg);
-          updateDiag();
-        });
-    }
-
-
-    // ==================== WEBSOCKET WITH FALLBACK ====================
-    let ws = null;
-    let wsConnected = false;
-    let pollInterval = null;
-
-    function applyDiagData(d) {
-      document.getElementById('speed').textContent = d.speed.toFixed(1) + ' mph';
-      document.getElementById('power').textContent = Math.round(d.power) + ' W';
-      document.getElementById('position').textContent = d.pos;
-      document.getElementById('target').textContent = d.target;
-
-      let motorEl = document.getElementById('motor');
-      if (d.enabled) {
-        motorEl.textContent = '✓ ENABLED';
-        motorEl.style.color = '#28a745';
-      } else {
-        motorEl.textContent = 'DISABLED';
-        motorEl.style.color = '#6c757d';
-      }
-
-      let bleEl = document.getElementById('ble');
-      bleEl.textContent = d.ble ? 'Connected' : 'Disconnected';
-      bleEl.style.color = d.ble ? '#28a745' : '#6c757d';
-
-      let otaBtn = document.getElementById('ota_btn');
-      let otaFile = document.getElementById('ota_file');
-      let otaBlocked = document.getElementById('ota_blocked');
-      if (d.ble) {
-        otaBtn.disabled = true;
-        otaBtn.style.opacity = '0.5';
-        otaBtn.style.cursor = 'not-allowed';
-        otaFile.disabled = true;
-        otaBlocked.style.display = 'block';
-      } else {
-        otaBtn.disabled = false;
-        otaBtn.style.opacity = '1';
-        otaBtn.style.cursor = 'pointer';
-        otaFile.disabled = false;
-        otaBlocked.style.display = 'none';
-      }
-
-      let modeText = d.mode;
-      let modeClass = 'mode-idle';
-      if (d.manual_hold) {
-        modeText = 'MANUAL';
-        modeClass = 'mode-manual';
-      } else if (d.mode === 'ERG') {
-        modeClass = 'mode-erg';
-      } else if (d.mode === 'SIM') {
-        modeClass = 'mode-sim';
-      }
-      let modeEl = document.getElementById('mode');
-      modeEl.textContent = modeText;
-      modeEl.className = 'mode-indicator ' + modeClass;
-
-      document.getElementById('manual_warning').style.display = d.manual_hold ? 'block' : 'none';
-      document.getElementById('erg_target').textContent = d.mode === 'ERG' ? d.erg_watts + ' W' : '-- W';
-      document.getElementById('sim_grade').textContent = d.mode === 'SIM' ? d.sim_grade.toFixed(1) + ' %' : '-- %';
-    }
-
-    function connectWebSocket() {
-      let wsUrl = 'ws://' + window.location.hostname + ':81/';
-      ws = new WebSocket(wsUrl);
-
-      ws.onopen = function() {
-        console.log('[WS] Connected');
-        wsConnected = true;
-        if (pollInterval) {
-          clearInterval(pollInterval);
-          pollInterval = null;
-        }
-      };
-
-      ws.onmessage = function(evt) {
-        try {
-          let d = JSON.parse(evt.data);
-          applyDiagData(d);
-        } catch (e) {
-          console.error('[WS] Parse error:', e);
-        }
-      };
-
-      ws.onclose = function() {
-        console.log('[WS] Disconnected, falling back to polling');
-        wsConnected = false;
-        ws = null;
-        if (!pollInterval) {
-          pollInterval = setInterval(updateDiag, 1000);
-        }
-        setTimeout(connectWebSocket, 3000);
-      };
-
-      ws.onerror = function(err) {
-        console.error('[WS] Error:', err);
-        ws.close();
-      };
-    }
-
-    function loadOtaInfo() {
-      fetch('/ota_info.json')
-        .then(r => r.json())
-        .then(d => {
-          document.getElementById('ota_partition').textContent = d.running_partition;
-          document.getElementById('ota_state').textContent = d.ota_state;
-          let rollbackBtn = document.getElementById('rollback_btn');
-          if (d.can_rollback) {
-            rollbackBtn.style.display = 'block';
-          } else {
-            rollbackBtn.style.display = 'none';
-          }
-        })
-        .catch(e => console.error('OTA info failed:', e));
-    }
-
-    function rollbackFirmware() {
-      if (!confirm('Roll back to the previous firmware version?\\n\\nThe device will restart.')) return;
-      fetch('/ota_rollback', {method: 'POST'})
-        .then(r => r.text())
-        .then(msg => {
-          alert(msg);
-        })
-        .catch(e => alert('Rollback failed: ' + e));
-    }
-
-    // ==================== WIFI & DEVICE FUNCTIONS ====================
-    function loadWifiStatus() {
-      fetch('/wifi_status.json')
-        .then(r => r.json())
-        .then(d => {
-          // Device identity
-          document.getElementById('device_id').textContent = d.device_id || '--';
-          document.getElementById('hostname').textContent = d.hostname || '--';
-          document.getElementById('ap_ssid').textContent = d.ap_ssid || '--';
-          document.getElementById('hostname_note').textContent = d.hostname || 'insideride-XXXX';
-          if (d.device_name) {
-            document.getElementById('device_name').value = d.device_name;
-          }
-          // WiFi status
-          document.getElementById('wifi_status').textContent = d.client_mode ? 'Connected' : 'AP Mode';
-          document.getElementById('wifi_ip').textContent = d.ip;
-          document.getElementById('wifi_rssi').textContent = d.client_mode ? d.rssi + ' dBm' : 'N/A';
-          if (d.configured && d.ssid) {
-            document.getElementById('wifi_ssid').value = d.ssid;
-          }
-        })
-        .catch(e => console.error('WiFi status failed:', e));
-    }
-
-    function saveDeviceName() {
-      let name = document.getElementById('device_name').value.trim();
-      if (name.length > 24) {
-        showDeviceMsg('Name too long (max 24 characters)', false);
-        return;
-      }
-      fetch('/device_name_save?name=' + encodeURIComponent(name), {method: 'POST'})
-        .then(r => r.text())
-        .then(msg => {
-          showDeviceMsg('✓ ' + msg, true);
-          loadWifiStatus();
-        })
-        .catch(e => showDeviceMsg('Save failed: ' + e, false));
-    }
-
-    function clearDeviceName() {
-      if (!confirm('Reset device name to MAC-based default?')) return;
-      fetch('/device_name_clear', {method: 'POST'})
-        .then(r => r.text())
-        .then(msg => {
-          showDeviceMsg(msg, true);
-          document.getElementById('device_name').value = '';
-          loadWifiStatus();
-        })
-        .catch(e => showDeviceMsg('Clear failed: ' + e, false));
-    }
-
-    function showDeviceMsg(msg, success) {
-      let el = document.getElementById('device_msg');
-      el.textContent = msg;
-      el.style.display = 'block';
-      el.style.background = success ? '#d4edda' : '#f8d7da';
-      el.style.color = success ? '#155724' : '#721c24';
-      setTimeout(() => { el.style.display = 'none'; }, 5000);
-    }
-
-    function saveWifi() {
-      let ssid = document.getElementById('wifi_ssid').value.trim();
-      let pass = document.getElementById('wifi_pass').value;
-      if (!ssid) {
-        showWifiMsg('Please enter a network name', false);
-        return;
-      }
-      if (!confirm('Save WiFi settings?\\n\\nSSID: ' + ssid + '\\n\\nAfter saving, click Restart to connect.')) return;
-      showWifiMsg('Saving...', true);
-      fetch('/wifi_save?ssid=' + encodeURIComponent(ssid) + '&pass=' + encodeURIComponent(pass), {method: 'POST', signal: AbortSignal.timeout(8000)})
-        .then(r => r.text())
-        .then(msg => {
-          showWifiMsg('✓ ' + msg, true);
-        })
-        .catch(e => {
-          // Save likely succeeded even if response was lost - tell user to restart
-          showWifiMsg('Settings likely saved (connection interrupted). Click Restart to apply.', true);
-        });
-    }
-
-    function restartDevice() {
-      if (!confirm('Restart the device now?')) return;
-      fetch('/wifi_restart', {method: 'POST'})
-        .then(r => r.text())
-        .then(msg => {
-          showWifiMsg('Restarting... Reconnect to the new network.', true);
-        })
-        .catch(e => showWifiMsg('Restart failed: ' + e, false));
-    }
-
-    function clearWifi() {
-      if (!confirm('Clear WiFi settings?\\n\\nThe device will use AP mode on next restart.')) return;
-      fetch('/wifi_clear', {method: 'POST'})
-        .then(r => r.text())
-        .then(msg => {
-          showWifiMsg(msg, true);
-          document.getElementById('wifi_ssid').value = '';
-          document.getElementById('wifi_pass').value = '';
-        })
-        .catch(e => showWifiMsg('Clear failed: ' + e, false));
-    }
-
-    function showWifiMsg(msg, success) {
-      let el = document.getElementById('wifi_msg');
-      el.textContent = msg;
-      el.style.display = 'block';
-      el.style.background = success ? '#d4edda' : '#f8d7da';
-      el.style.color = success ? '#155724' : '#721c24';
-      setTimeout(() => { el.style.display = 'none'; }, 5000);
-    }
+// Serve a pre-gzipped page straight from flash; revalidation costs a 304.
+// Dynamic data comes from /diag.json, /tables.json and the WebSocket.
+static void sendStaticAsset(const WebAsset& asset) {
+  server.sendHeader("ETag", asset.etag);
+  server.sendHeader("Cache-Control", "no-cache");
+  if (server.hasHeader("If-None-Match") && server.header("If-None-Match") == asset.etag) {
+    server.send(304);
+    return;
+  }
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, asset.contentType, (PGM_P)asset.data, asset.length);
+}
 
-    // Start with WebSocket, fallback to polling
-    connectWebSocket();
-    updateDiag(); // Initial fetch
-    loadOtaInfo();
-    loadWifiStatus();
-  </script>
-</body>
-</html>
-  )HTML";
-  
-  Serial.println("[HTTP] Sending HTML response");
-  server.send(200, "text/html", html);
-  Serial.println("[HTTP] Response sent");
+static void handleRoot() {
+  LOG_D("HTTP", "Root handler called - serving HTML");
+  sendStaticAsset(WEB_INDEX_HTML);
 }
 
 static void handleDiagJson() {
-  // Use shared function for consistency
-  server.send(200, "application/json", buildDiagJson());
+  // Telemetry fields plus the negotiated BLE link ("ble_link"), advertising
+  // state, how the last boot went ("boot") and idle power management
+  TelemetryFrame cur;
+  telemetryCapture(&cur);
+  BleLinkInfo link;
+  bleGetLinkInfo(&link);
+  BleAdvInfo adv;
+  bleGetAdvInfo(&adv);
+  StepperBootInfo boot;
+  stepperGetBootInfo(&boot);
+  PowerStats pwr;
+  powerGetStats(&pwr);
+
+  char peer[18];
+  snprintf(peer, sizeof(peer), "%02x:%02x:%02x:%02x:%02x:%02x",
+           link.peer[0], link.peer[1], link.peer[2], link.peer[3], link.peer[4], link.peer[5]);
+
+  JsonStreamWriter json(server);
+  json.begin();
+  json.beginObject();
+  telemetryWriteJson(cur, json);
+
+  json.beginObject("ble_link");
+  json.field("connected", link.connected);
+  json.field("connects", (unsigned long)link.connects);
+  json.field("peer", peer);
+  json.field("connected_for_ms", (unsigned long)(link.connected ? millis() - link.connectMs : 0));
+  json.field("interval_ms", link.intervalUnits * 1.25f, 2);
+  json.field("latency", (unsigned long)link.latency);
+  json.field("timeout_ms", (unsigned long)link.timeoutUnits * 10);
+  json.field("mtu", (unsigned long)link.mtu);
+  json.field("tx_len", (unsigned long)link.txLen);
+  json.field("rx_len", (unsigned long)link.rxLen);
+  json.field("tx_phy", (unsigned long)link.txPhy);
+  json.field("rx_phy", (unsigned long)link.rxPhy);
+  json.endObject();
+
+  json.beginObject("ble_adv");
+  json.field("state", bleAdvStateName(adv.state));
+  json.field("interval_min_ms", adv.minUnits * 0.625f, 2);
+  json.field("interval_max_ms", adv.maxUnits * 0.625f, 2);
+  json.field("in_state_ms", (unsigned long)(millis() - adv.sinceMs));
+  json.field("changes", (unsigned long)adv.changes);
+  json.endObject();
+
+  json.beginObject("boot");
+  json.field("reset_reason", stepperResetReasonName(boot.resetReason));
+  json.field("homing", boot.homing == BOOT_HOME_TRUSTED ? "trusted" : "full");
+  json.field("restored_pos", (long)boot.restoredPos);
+  json.field("advertising_ms", (unsigned long)(adv.bootUs / 1000));
+  json.field("homed_ms", (unsigned long)boot.homedMs);
+  json.field("verify_pending", boot.verifyPending);
+  json.field("verified", boot.verified);
+  json.field("verify_error_steps", (long)boot.verifyErrorSteps);
+  json.endObject();
+
+  json.beginObject("power_mgmt");
+  json.field("state", powerStateName(pwr.state));
+  json.field("cpu_mhz", (unsigned long)pwr.cpuMhz);
+  json.field("in_state_ms", (unsigned long)pwr.stateMs);
+  json.field("idle_entries", (unsigned long)pwr.idleEntries);
+  json.field("idle_ms", (unsigned long)pwr.idleMs);
+  json.field("active_ms", (unsigned long)pwr.activeMs);
+  json.field("last_wake", powerWakeName(pwr.lastWake));
+  json.field("wake_us", (unsigned long)pwr.lastWakeUs);
+  json.field("est_ma", pwr.estMa, 1);
+  json.field("est_avg_ma", pwr.estAvgMa, 1);
+  json.endObject();
+
+  json.endObject();
+  json.end();
 }
 
 static void handleGoto() {
@@ -747,7 +315,9 @@ static void handleGradeHold() {
   grade = constrain(grade, -4.0f, 10.0f);
 
   // Use gradeToSteps to convert grade to position (uses current speed)
-  int32_t pos = (int32_t)lround(gradeToSteps(currentSpeedMph, grade));
+  TrainerSnapshot snap;
+  trainerStateRead(&snap);
+  int32_t pos = (int32_t)lroundf(gradeToSteps(snap.speedMph, grade));
   pos = clampLogical(pos);
 
   gManualHoldTarget = pos;
@@ -762,13 +332,15 @@ static void handleResumeApp() {
 }
 
 static void handleCalibrationJson() {
-  String json = "{";
-  json += "\"a\":" + String(gIdleCurveA, 4) + ",";
-  json += "\"b\":" + String(gIdleCurveB, 4) + ",";
-  json += "\"c\":" + String(gIdleCurveC, 5) + ",";
-  json += "\"d\":" + String(gIdleCurveD, 6);
-  json += "}";
-  server.send(200, "application/json", json);
+  JsonStreamWriter json(server);
+  json.begin();
+  json.beginObject();
+  json.field("a", gIdleCurveA, 4);
+  json.field("b", gIdleCurveB, 4);
+  json.field("c", gIdleCurveC, 5);
+  json.field("d", gIdleCurveD, 6);
+  json.endObject();
+  json.end();
 }
 
 static void handleCalibrationSet() {
@@ -792,370 +364,488 @@ static void handleCalibrationReset() {
   server.send(200, "text/plain", "Calibration reset to defaults");
 }
 
-// ==================== CALIBRATION TABLES PAGE ====================
+static void handleErgPiJson() {
+  JsonStreamWriter json(server);
+  json.begin();
+  json.beginObject();
+  json.field("enabled", gErgPiEnabled);
+  json.field("kp", gErgPiKp, 4);
+  json.field("ki", gErgPiKi, 4);
+  json.field("limit", gErgPiLimit, 0);
+  json.field("lookahead_ms", gErgLookaheadMs, 0);
+  json.field("projected_mph", gErgProjectedMph, 2);
+  json.field("ff", gErgFeedForward, 0);
+  json.field("corr", gErgCorrection, 1);
+  json.endObject();
+  json.end();
+}
 
-static void handleTablesPage() {
-  String html = R"HTML(
-<!DOCTYPE html>
-<html>
-<head>
-  <meta charset="UTF-8">
-  <meta name="viewport" content="width=device-width, initial-scale=1.0">
-  <title>Calibration Tables</title>
-  <style>
-    body { font-family: Arial, sans-serif; max-width: 1200px; margin: 20px auto; padding: 20px; background: #f0f0f0; }
-    .container { background: white; padding: 20px; border-radius: 8px; box-shadow: 0 2px 4px rgba(0,0,0,0.1); margin-bottom: 20px; }
-    h1 { color: #333; margin-top: 0; }
-    h2 { color: #666; border-bottom: 2px solid #007bff; padding-bottom: 5px; }
-    table { border-collapse: collapse; margin: 10px 0; font-size: 14px; }
-    th, td { border: 1px solid #ddd; padding: 4px 8px; text-align: center; }
-    th { background: #007bff; color: white; }
-    .row-header { background: #e7f3ff; font-weight: bold; }
-    input[type="number"] { width: 60px; padding: 2px; text-align: center; border: 1px solid #ccc; border-radius: 3px; }
-    input[type="number"]:focus { outline: 2px solid #007bff; }
-    button { padding: 10px 20px; font-size: 14px; border: none; border-radius: 4px; cursor: pointer; margin: 5px; }
-    .btn-primary { background: #007bff; color: white; }
-    .btn-primary:hover { background: #0056b3; }
-    .btn-warning { background: #ffc107; color: black; }
-    .btn-warning:hover { background: #e0a800; }
-    .btn-secondary { background: #6c757d; color: white; }
-    .btn-secondary:hover { background: #545b62; }
-    .status { margin: 10px 0; padding: 10px; border-radius: 4px; display: none; }
-    .status.success { background: #d4edda; color: #155724; display: block; }
-    .status.error { background: #f8d7da; color: #721c24; display: block; }
-    .axis-label { background: #f8f9fa; font-weight: bold; font-size: 12px; }
-    .table-wrapper { overflow-x: auto; }
-    a { color: #007bff; text-decoration: none; }
-    a:hover { text-decoration: underline; }
-  </style>
-</head>
-<body>
-  <div class="container">
-    <h1>📊 Calibration Tables</h1>
-    <p><a href="/">← Back to Main Page</a></p>
-  </div>
-
-  <div class="container">
-    <h2>Power Table (Speed × Position → Watts)</h2>
-    <p style="color: #666; font-size: 13px;">Used for estimating power output based on roller speed and resistance position.</p>
-    <div class="table-wrapper">
-      <table id="powerTable"></table>
-    </div>
-    <div>
-      <button class="btn-primary" onclick="savePowerTable()">💾 Save Power Table</button>
-      <button class="btn-warning" onclick="resetPowerTable()">↩️ Reset to Defaults</button>
-    </div>
-    <div id="powerStatus" class="status"></div>
-  </div>
-
-  <div class="container">
-    <h2>ERG Table (Speed × Target Power → Position)</h2>
-    <p style="color: #666; font-size: 13px;">Used in ERG mode to determine resistance position from target power and current speed. Values clamped to 0-1000.</p>
-    <div class="table-wrapper">
-      <table id="ergTable"></table>
-    </div>
-    <div>
-      <button class="btn-primary" onclick="saveErgTable()">💾 Save ERG Table</button>
-      <button class="btn-warning" onclick="resetErgTable()">↩️ Reset to Defaults</button>
-    </div>
-    <div id="ergStatus" class="status"></div>
-  </div>
-
-  <div class="container">
-    <h2>SIM Table (Speed × Grade → Position)</h2>
-    <p style="color: #666; font-size: 13px;">Used in SIM mode to determine resistance position from grade percentage and current speed. Values clamped to 0-1000.</p>
-    <div class="table-wrapper">
-      <table id="simTable"></table>
-    </div>
-    <div>
-      <button class="btn-primary" onclick="saveSimTable()">💾 Save SIM Table</button>
-      <button class="btn-warning" onclick="resetSimTable()">↩️ Reset to Defaults</button>
-    </div>
-    <div id="simStatus" class="status"></div>
-  </div>
-
-  <div class="container">
-    <h2>IDLE Curve Coefficients</h2>
-    <p style="color: #666; font-size: 13px;">Fallback curve when no app is connected: pos = a + b×speed + c×speed² + d×speed³</p>
-    <div class="table-wrapper">
-      <table>
-        <tr>
-          <th>a (constant)</th>
-          <th>b (linear)</th>
-          <th>c (quadratic)</th>
-          <th>d (cubic)</th>
-        </tr>
-        <tr>
-          <td><input type="number" id="idle_a" step="0.01"></td>
-          <td><input type="number" id="idle_b" step="0.01"></td>
-          <td><input type="number" id="idle_c" step="0.001"></td>
-          <td><input type="number" id="idle_d" step="0.0001"></td>
-        </tr>
-      </table>
-    </div>
-    <div>
-      <button class="btn-primary" onclick="saveIdleCurve()">💾 Save IDLE Curve</button>
-      <button class="btn-warning" onclick="resetIdleCurve()">↩️ Reset to Defaults</button>
-    </div>
-    <div id="idleStatus" class="status"></div>
-  </div>
-
-  <script>
-    // Build table HTML with editable inputs
-    function buildTable(tableId, data) {
-      let tbl = document.getElementById(tableId);
-      let html = '<tr><th></th>';
-      // Column headers (Y axis)
-      for (let j = 0; j < data.yAxis.length; j++) {
-        html += '<th>' + data.yAxisLabel + '<br>' + data.yAxis[j] + '</th>';
-      }
-      html += '</tr>';
-      // Data rows
-      for (let i = 0; i < data.xAxis.length; i++) {
-        html += '<tr><td class="row-header">' + data.xAxisLabel + '<br>' + data.xAxis[i] + '</td>';
-        for (let j = 0; j < data.yAxis.length; j++) {
-          let val = data.values[i][j];
-          html += '<td><input type="number" id="' + tableId + '_' + i + '_' + j + '" value="' + val + '" step="1"></td>';
-        }
-        html += '</tr>';
-      }
-      tbl.innerHTML = html;
-    }
+// Any subset of en/kp/ki/limit/la may be given; changes take effect immediately
+static void handleErgPiSet() {
+  if (!server.hasArg("en") && !server.hasArg("kp") && !server.hasArg("ki") && !server.hasArg("limit") &&
+      !server.hasArg("la")) {
+    server.send(400, "text/plain", "Missing parameters");
+    return;
+  }
 
-    // Collect table values into 2D array
-    function collectTable(tableId, rows, cols) {
-      let values = [];
-      for (let i = 0; i < rows; i++) {
-        let row = [];
-        for (let j = 0; j < cols; j++) {
-          let el = document.getElementById(tableId + '_' + i + '_' + j);
-          row.push(parseFloat(el.value) || 0);
-        }
-        values.push(row);
-      }
-      return values;
-    }
+  if (server.hasArg("en")) {
+    gErgPiEnabled = (server.arg("en").toInt() != 0);
+  }
+  if (server.hasArg("kp")) {
+    gErgPiKp = constrain(server.arg("kp").toFloat(), 0.0f, 20.0f);
+  }
+  if (server.hasArg("ki")) {
+    gErgPiKi = constrain(server.arg("ki").toFloat(), 0.0f, 20.0f);
+  }
+  if (server.hasArg("limit")) {
+    gErgPiLimit = constrain(server.arg("limit").toFloat(), 0.0f, (float)LOGICAL_MAX);
+  }
+  if (server.hasArg("la")) {
+    gErgLookaheadMs = constrain(server.arg("la").toFloat(), 0.0f, ERG_LOOKAHEAD_MAX_MS);
+  }
+  ergControlReset();
 
-    function showStatus(id, msg, success) {
-      let el = document.getElementById(id);
-      el.textContent = msg;
-      el.className = 'status ' + (success ? 'success' : 'error');
-      setTimeout(() => { el.className = 'status'; }, 3000);
-    }
+  ergPiSave();
 
-    // Load all tables
-    function loadTables() {
-      fetch('/tables.json')
-        .then(r => r.json())
-        .then(d => {
-          buildTable('powerTable', {
-            xAxis: d.power.speedAxis,
-            yAxis: d.power.posAxis,
-            xAxisLabel: 'Speed (mph)',
-            yAxisLabel: 'Pos',
-            values: d.power.values
-          });
-          buildTable('ergTable', {
-            xAxis: d.erg.speedAxis,
-            yAxis: d.erg.powerAxis,
-            xAxisLabel: 'Speed (mph)',
-            yAxisLabel: 'Power (W)',
-            values: d.erg.values
-          });
-          buildTable('simTable', {
-            xAxis: d.sim.speedAxis,
-            yAxis: d.sim.gradeAxis,
-            xAxisLabel: 'Speed (mph)',
-            yAxisLabel: 'Grade (%)',
-            values: d.sim.values
-          });
-          // Load IDLE curve coefficients
-          if (d.idle) {
-            document.getElementById('idle_a').value = d.idle.a;
-            document.getElementById('idle_b').value = d.idle.b;
-            document.getElementById('idle_c').value = d.idle.c;
-            document.getElementById('idle_d').value = d.idle.d;
-          }
-        })
-        .catch(e => console.error('Failed to load tables:', e));
-    }
+  server.send(200, "text/plain", "ERG PI gains saved");
+}
 
-    // Save functions
-    function savePowerTable() {
-      let values = collectTable('powerTable', 7, 5);
-      fetch('/tables/power', {
-        method: 'POST',
-        headers: {'Content-Type': 'application/json'},
-        body: JSON.stringify({values: values})
-      })
-      .then(r => r.text())
-      .then(msg => showStatus('powerStatus', msg, true))
-      .catch(e => showStatus('powerStatus', 'Save failed: ' + e, false));
-    }
+static void handleErgPiReset() {
+  ergPiReset();
+  ergControlReset();
+  server.send(200, "text/plain", "ERG PI gains reset to defaults");
+}
 
-    function resetPowerTable() {
-      if (!confirm('Reset Power table to defaults?')) return;
-      fetch('/tables/power/reset', {method: 'POST'})
-        .then(r => r.text())
-        .then(msg => { showStatus('powerStatus', msg, true); loadTables(); })
-        .catch(e => showStatus('powerStatus', 'Reset failed: ' + e, false));
-    }
+static void handleInertiaJson() {
+  JsonStreamWriter json(server);
+  json.begin();
+  json.beginObject();
+  json.field("enabled", gPowerInertiaEnabled);
+  json.field("inertia", gPowerInertia, 4);
+  json.field("watts", currentInertiaWatts, 1);
+  json.beginObject("coast");
+  json.field("state", coastDownStateName(coastDownState()));
+  json.field("samples", (unsigned long)coastDownSamples());
+  json.field("result", coastDownResult(), 4);
+  json.endObject();
+  json.endObject();
+  json.end();
+}
 
-    function saveErgTable() {
-      let values = collectTable('ergTable', 7, 9);
-      fetch('/tables/erg', {
-        method: 'POST',
-        headers: {'Content-Type': 'application/json'},
-        body: JSON.stringify({values: values})
-      })
-      .then(r => r.text())
-      .then(msg => showStatus('ergStatus', msg, true))
-      .catch(e => showStatus('ergStatus', 'Save failed: ' + e, false));
-    }
+// Any subset of en/i may be given; changes take effect immediately
+static void handleInertiaSet() {
+  if (!server.hasArg("en") && !server.hasArg("i")) {
+    server.send(400, "text/plain", "Missing parameters");
+    return;
+  }
 
-    function resetErgTable() {
-      if (!confirm('Reset ERG table to defaults?')) return;
-      fetch('/tables/erg/reset', {method: 'POST'})
-        .then(r => r.text())
-        .then(msg => { showStatus('ergStatus', msg, true); loadTables(); })
-        .catch(e => showStatus('ergStatus', 'Reset failed: ' + e, false));
-    }
+  if (server.hasArg("en")) {
+    gPowerInertiaEnabled = (server.arg("en").toInt() != 0);
+  }
+  if (server.hasArg("i")) {
+    gPowerInertia = constrain(server.arg("i").toFloat(), 0.0f, POWER_INERTIA_MAX);
+  }
 
-    function saveSimTable() {
-      let values = collectTable('simTable', 8, 7);
-      fetch('/tables/sim', {
-        method: 'POST',
-        headers: {'Content-Type': 'application/json'},
-        body: JSON.stringify({values: values})
-      })
-      .then(r => r.text())
-      .then(msg => showStatus('simStatus', msg, true))
-      .catch(e => showStatus('simStatus', 'Save failed: ' + e, false));
-    }
+  inertiaSave();
 
-    function resetSimTable() {
-      if (!confirm('Reset SIM table to defaults?')) return;
-      fetch('/tables/sim/reset', {method: 'POST'})
-        .then(r => r.text())
-        .then(msg => { showStatus('simStatus', msg, true); loadTables(); })
-        .catch(e => showStatus('simStatus', 'Reset failed: ' + e, false));
-    }
+  server.send(200, "text/plain", "Inertia saved");
+}
 
-    function saveIdleCurve() {
-      let a = document.getElementById('idle_a').value;
-      let b = document.getElementById('idle_b').value;
-      let c = document.getElementById('idle_c').value;
-      let d = document.getElementById('idle_d').value;
-      fetch('/calibration?a=' + a + '&b=' + b + '&c=' + c + '&d=' + d, {method: 'POST'})
-        .then(r => r.text())
-        .then(msg => showStatus('idleStatus', msg, true))
-        .catch(e => showStatus('idleStatus', 'Save failed: ' + e, false));
-    }
+static void handleInertiaReset() {
+  inertiaReset();
+  server.send(200, "text/plain", "Inertia reset to defaults");
+}
 
-    function resetIdleCurve() {
-      if (!confirm('Reset IDLE curve to defaults?')) return;
-      fetch('/calibration/reset', {method: 'POST'})
-        .then(r => r.text())
-        .then(msg => { showStatus('idleStatus', msg, true); loadTables(); })
-        .catch(e => showStatus('idleStatus', 'Reset failed: ' + e, false));
-    }
+static void handleCoastDownStart() {
+  coastDownStart();
+  server.send(200, "text/plain", "Coast-down armed: spin up past " + String(COAST_START_MPH, 0) + " mph, then stop pedaling");
+}
 
-    // Load on page load
-    loadTables();
-  </script>
-</body>
-</html>
-  )HTML";
+static void handleCoastDownCancel() {
+  coastDownCancel();
+  server.send(200, "text/plain", "Coast-down cancelled");
+}
 
-  server.send(200, "text/html", html);
+// Emit {"count":..,"min_us":..,"avg_us":..,"max_us":..,"max_1s_us":..,"hist":[..]}
+static void writePerfStats(JsonStreamWriter& json, const char* name, const PerfStats& st, uint32_t perUs) {
+  json.beginObject(name);
+  json.field("count", (unsigned long)st.count);
+  json.field("min_us", (unsigned long)(st.count ? st.min / perUs : 0));
+  json.field("avg_us", (float)(st.count ? (double)st.sum / st.count / perUs : 0.0), 1);
+  json.field("max_us", (unsigned long)(st.max / perUs));
+  json.field("max_1s_us", (unsigned long)(st.windowMax / perUs));
+  json.beginArray("hist");
+  for (int b = 0; b < PERF_HIST_BUCKETS; b++) json.value((unsigned long)st.hist[b]);
+  json.endArray();
+  json.endObject();
 }
 
-// JSON endpoint for all calibration tables
-static void handleTablesJson() {
-  String json = "{";
+// Loop profiler; /perf.json?reset=1 clears the counters after reporting
+static void handlePerfJson() {
+  JsonStreamWriter json(server);
+  json.begin();
+  json.beginObject();
+  json.field("uptime_ms", (unsigned long)millis());
 
-  // Power table
-  json += "\"power\":{";
-  json += "\"speedAxis\":[";
-  for (int i = 0; i < POWER_TABLE_ROWS; i++) {
-    if (i > 0) json += ",";
-    json += String(powerSpeedAxis(i), 0);
+  json.beginArray("hist_edges_us");
+  for (int b = 0; b < PERF_HIST_BUCKETS - 1; b++) json.value((unsigned long)PERF_HIST_EDGES_US[b]);
+  json.endArray();
+
+  writePerfStats(json, "loop_period", perfLoopPeriod(), 1);
+  writePerfStats(json, "control_period", perfControlPeriod(), 1);
+
+  json.beginObject("sections");
+  for (uint8_t i = 0; i < PERF_SECTION_COUNT; i++) {
+    writePerfStats(json, perfSectionName(i), perfSection(i), perfCyclesPerUs());
+  }
+  json.endObject();
+
+  json.beginObject("step");
+  json.field("gap_max_us", (unsigned long)gStepGapMaxUs);
+  json.field("late_max_us", (unsigned long)gStepLateMaxUs);
+  json.endObject();
+
+  uint32_t ibSent, ibSuppressed;
+  bleNotifyStats(&ibSent, &ibSuppressed);
+  json.beginObject("ble_notify");
+  json.field("sent", (unsigned long)ibSent);
+  json.field("suppressed", (unsigned long)ibSuppressed);
+  json.endObject();
+
+  json.beginObject("ble_stack");
+  json.field("backend", bleStackName());
+  json.field("heap_used", (unsigned long)bleHeapUsed());
+  json.field("sketch_bytes", (unsigned long)ESP.getSketchSize());
+  json.endObject();
+
+  CalibrationStats cal;
+  calibrationGetStats(&cal);
+  json.beginObject("settings_nvs");
+  json.field("pending", cal.pending);
+  json.field("commits", (unsigned long)cal.commits);
+  json.field("last_commit_us", (unsigned long)cal.lastCommitUs);
+  json.field("blob_bytes", (unsigned long)cal.blobBytes);
+  json.endObject();
+
+  json.beginObject("heap");
+  json.field("free", (unsigned long)perfHeapFree());
+  json.field("min_free", (unsigned long)perfHeapMinFree());
+  json.field("largest", (unsigned long)perfHeapLargest());
+  json.field("min_largest", (unsigned long)perfHeapMinLargest());
+  json.endObject();
+
+  json.endObject();
+  json.end();
+
+  if (server.hasArg("reset") && server.arg("reset") == "1") {
+    perfReset();
+    stepperResetPulseStats();
+  }
+}
+
+// Recent log history from the RAM ring buffer (newest at the bottom)
+static void handleLogText() {
+  static char buf[LOG_RING_SIZE + 1];
+  logCopyHistory(buf, sizeof(buf));
+  server.sendHeader("Cache-Control", "no-store");
+  server.send(200, "text/plain", buf);
+}
+
+// ==================== RIDE RECORDER ====================
+
+static void handleRecorderJson() {
+  RecorderStats st;
+  recorderGetStats(&st);
+
+  JsonStreamWriter json(server);
+  json.begin();
+  json.beginObject();
+  json.field("mounted", st.mounted);
+  json.field("enabled", st.enabled);
+  json.field("active", st.active);
+  json.field("records", (unsigned long)st.records);
+  json.field("dropped", (unsigned long)st.dropped);
+  json.field("bytes_stored", (unsigned long)st.bytesStored);
+  json.field("bytes_max", (unsigned long)st.bytesMax);
+  json.field("record_bytes", (unsigned long)sizeof(RecorderRecord));
+  json.field("writes", (unsigned long)st.writes);
+  json.field("write_max_us", (unsigned long)st.writeMaxUs);
+  json.field("write_deferred", (unsigned long)st.writesDeferred);
+  json.endObject();
+  json.end();
+}
+
+static void handleRecorderSet() {
+  if (!server.hasArg("en")) {
+    server.send(400, "text/plain", "Missing en parameter");
+    return;
   }
-  json += "],\"posAxis\":[";
-  for (int i = 0; i < POWER_TABLE_COLS; i++) {
-    if (i > 0) json += ",";
-    json += String(powerPosAxis(i), 0);
+  recorderSetEnabled(server.arg("en").toInt() != 0);
+  server.send(200, "text/plain", "Recorder updated");
+}
+
+static void handleRecorderClear() {
+  recorderClear();
+  server.send(200, "text/plain", "Recordings cleared");
+}
+
+static void sendCsvChunk(const char* text, size_t len, void* ctx) {
+  server.sendContent(text, len);
+}
+
+// Streams both recording files as CSV (chunked, never held in RAM)
+static void handleRecorderCsv() {
+  if (!recorderFlush()) {
+    server.send(409, "text/plain", "Newest records not on flash yet (motor moving), try again");
+    return;
+  }
+  server.sendHeader("Cache-Control", "no-store");
+  server.sendHeader("Content-Disposition", "attachment; filename=\"ride.csv\"");
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "text/csv", "");
+  recorderExportCsv(sendCsvChunk, NULL);
+  server.sendContent("");
+}
+
+// ==================== RIDE REPLAY ====================
+
+static void handleReplayJson() {
+  ReplayStats st;
+  replayGetStats(&st);
+
+  JsonStreamWriter json(server);
+  json.begin();
+  json.beginObject();
+  json.field("state", replayStateName(st.state));
+  json.field("error", st.error ? st.error : "");
+  json.field("model_stepper", st.modelStepper);
+  json.field("truncated", st.truncated);
+  json.field("records", (unsigned long)st.records);
+  json.field("edges", (unsigned long)st.edges);
+  json.field("commands", (unsigned long)st.commands);
+  json.field("ride_ms", (unsigned long)st.rideMs);
+  json.field("cpu_ms", (unsigned long)(st.cpuUs / 1000));
+  json.field("speed_rms_mph", st.speedRmsMph, 3);
+  json.field("speed_max_mph", st.speedMaxMph, 2);
+  json.field("power_rms_w", st.powerRmsW, 1);
+  json.field("power_max_w", st.powerMaxW, 0);
+  json.field("target_rms", st.targetRms, 1);
+  json.field("target_max", st.targetMax, 0);
+  json.field("erg_records", (unsigned long)st.ergRecords);
+  json.field("erg_rms_w", st.ergRmsW, 1);
+  json.field("erg_max_w", st.ergMaxW, 0);
+  json.endObject();
+  json.end();
+}
+
+static void handleReplayStart() {
+  if (!replayStart(NULL)) {
+    ReplayStats st;
+    replayGetStats(&st);
+    server.send(409, "text/plain", st.state == REPLAY_RUNNING ? "Replay already running" : st.error);
+    return;
   }
-  json += "],\"values\":[";
+  server.send(200, "text/plain", "Replay started");
+}
+
+// Replay output in the recorder's CSV columns (compare against /rec.csv)
+static void handleReplayCsv() {
+  server.sendHeader("Cache-Control", "no-store");
+  server.sendHeader("Content-Disposition", "attachment; filename=\"replay.csv\"");
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "text/csv", "");
+  replayExportCsv(sendCsvChunk, NULL);
+  server.sendContent("");
+}
+
+// ==================== CALIBRATION SWEEP ====================
+
+static void handleSweepJson() {
+  SweepStatus st;
+  sweepGetStatus(&st);
+  MeterInfo meter;
+  meterGetInfo(&meter);
+  char addr[18];
+  snprintf(addr, sizeof(addr), "%02X:%02X:%02X:%02X:%02X:%02X",
+           meter.peer[0], meter.peer[1], meter.peer[2], meter.peer[3], meter.peer[4], meter.peer[5]);
+
+  JsonStreamWriter json(server);
+  json.begin();
+  json.beginObject();
+  json.field("state", sweepStateName(st.state));
+  json.field("error", st.error ? st.error : "");
+  json.field("cell", (int)st.cell);
+  json.field("cells", (int)st.cells);
+  json.field("band_mph", st.bandMph, 0);
+  json.field("position", (long)st.position);
+  json.field("windows", (int)st.windows);
+  json.field("windows_per_cell", (int)SWEEP_WINDOWS_PER_CELL);
+  json.field("fitted", (int)st.fitted);
+  json.field("skipped", (int)st.skipped);
+  json.field("cell_ms", (unsigned long)st.cellMs);
+  json.beginObject("meter");
+  json.field("state", meterStateName(meter.state));
+  json.field("name", meter.name);
+  json.field("addr", (meter.state == METER_CONNECTED || meter.measurements) ? addr : "");
+  json.field("reporting", meterFresh());
+  json.field("watts", (int)meter.watts);
+  json.field("measurements", (unsigned long)meter.measurements);
+  json.endObject();
+
+  // Fitted cells of the swept rows (0 = no fit yet)
+  json.beginArray("speedAxis");
+  for (int i = 0; i < POWER_TABLE_ROWS; i++) {
+    if (sweepBand(i)) json.value((float)powerSpeedAxis(i), 0);
+  }
+  json.endArray();
+  json.beginArray("posAxis");
+  for (int j = 0; j < POWER_TABLE_COLS; j++) json.value((float)powerPosAxis(j), 0);
+  json.endArray();
+  json.beginArray("values");
   for (int i = 0; i < POWER_TABLE_ROWS; i++) {
-    if (i > 0) json += ",";
-    json += "[";
+    if (!sweepBand(i)) continue;
+    json.beginArray();
     for (int j = 0; j < POWER_TABLE_COLS; j++) {
-      if (j > 0) json += ",";
-      json += String(powerTableGet(i, j), 0);
+      float watts = 0.0f;
+      sweepResult(i, j, &watts);
+      json.value(watts, 0);
     }
-    json += "]";
+    json.endArray();
   }
-  json += "]},";
+  json.endArray();
+  json.endObject();
+  json.end();
+}
 
-  // ERG table
-  json += "\"erg\":{";
-  json += "\"speedAxis\":[";
-  for (int i = 0; i < ERG_TABLE_ROWS; i++) {
-    if (i > 0) json += ",";
-    json += String(ergSpeedAxis(i), 0);
+// meter=AA:BB:CC:DD:EE:FF picks a sensor; otherwise the connected or first one found
+static void handleSweepStart() {
+  uint8_t peer[6];
+  const bool hasPeer = server.hasArg("meter") && server.arg("meter").length() > 0;
+  if (hasPeer && !meterParseAddress(server.arg("meter").c_str(), peer)) {
+    server.send(400, "text/plain", "Invalid meter address");
+    return;
   }
-  json += "],\"powerAxis\":[";
-  for (int i = 0; i < ERG_TABLE_COLS; i++) {
-    if (i > 0) json += ",";
-    json += String(ergPowerAxis(i), 0);
+  if (!sweepStart(hasPeer ? peer : NULL)) {
+    SweepStatus st;
+    sweepGetStatus(&st);
+    server.send(409, "text/plain", st.error ? st.error : "Sweep not started");
+    return;
   }
-  json += "],\"values\":[";
-  for (int i = 0; i < ERG_TABLE_ROWS; i++) {
-    if (i > 0) json += ",";
-    json += "[";
-    for (int j = 0; j < ERG_TABLE_COLS; j++) {
-      if (j > 0) json += ",";
-      json += String(ergTableGet(i, j), 0);
-    }
-    json += "]";
+  server.send(200, "text/plain", "Sweep started: hold each speed band shown, the resistance steps by itself");
+}
+
+static void handleSweepCancel() {
+  sweepCancel();
+  server.send(200, "text/plain", "Sweep cancelled");
+}
+
+static void handleSweepApply() {
+  if (sweepActive()) {
+    server.send(409, "text/plain", "Sweep still running");
+    return;
   }
-  json += "]},";
+  const int applied = sweepApply();
+  if (applied == 0) {
+    server.send(409, "text/plain", "No fitted cells to apply");
+    return;
+  }
+  server.send(200, "text/plain", String(applied) + " power table cells updated");
+}
 
-  // SIM table
-  json += "\"sim\":{";
-  json += "\"speedAxis\":[";
-  for (int i = 0; i < SIM_TABLE_ROWS; i++) {
-    if (i > 0) json += ",";
-    json += String(simSpeedAxis(i), 0);
+static void handleMeterDisconnect() {
+  meterDisconnect();
+  server.send(200, "text/plain", "Power meter disconnected");
+}
+
+// ==================== FLEET TELEMETRY ====================
+
+static void handleFleetJson() {
+  FleetStats st;
+  fleetGetStats(&st);
+  char group[16];
+  snprintf(group, sizeof(group), "%u.%u.%u.%u", FLEET_GROUP[0], FLEET_GROUP[1], FLEET_GROUP[2], FLEET_GROUP[3]);
+
+  JsonStreamWriter json(server);
+  json.begin();
+  json.beginObject();
+  json.field("available", st.available);
+  json.field("rate_hz", (int)st.rateHz);
+  json.field("group", group);
+  json.field("port", (int)FLEET_PORT);
+  json.field("id", gDeviceId);
+  json.field("sent", (unsigned long)st.sent);
+  json.field("errors", (unsigned long)st.errors);
+  json.field("bytes", (unsigned long)st.bytes);
+  json.field("datagram_bytes", (int)st.lastLen);
+  json.endObject();
+  json.end();
+}
+
+static void handleFleetSet() {
+  if (!server.hasArg("hz")) {
+    server.send(400, "text/plain", "Missing hz parameter");
+    return;
   }
-  json += "],\"gradeAxis\":[";
-  for (int i = 0; i < SIM_TABLE_COLS; i++) {
-    if (i > 0) json += ",";
-    json += String(simGradeAxis(i), 0);
+  const long hz = server.arg("hz").toInt();
+  if (hz < 0 || hz > FLEET_RATE_MAX_HZ) {
+    server.send(400, "text/plain", "hz must be 0-" + String(FLEET_RATE_MAX_HZ));
+    return;
   }
-  json += "],\"values\":[";
-  for (int i = 0; i < SIM_TABLE_ROWS; i++) {
-    if (i > 0) json += ",";
-    json += "[";
-    for (int j = 0; j < SIM_TABLE_COLS; j++) {
-      if (j > 0) json += ",";
-      json += String(simTableGet(i, j), 0);
-    }
-    json += "]";
+  fleetSetRate((uint8_t)hz);
+  server.send(200, "text/plain", hz ? "Fleet telemetry at " + String(hz) + " Hz" : String("Fleet telemetry off"));
+}
+
+// ==================== CALIBRATION TABLES PAGE ====================
+
+static void handleTablesPage() {
+  sendStaticAsset(WEB_TABLES_HTML);
+}
+
+// JSON endpoint for all calibration tables
+// Emit one calibration table as {"speedAxis":[..],"<yName>":[..],"values":[[..],..]}
+static void writeTableJson(JsonStreamWriter& json, const char* name, const char* yName,
+                           int rows, int cols, double (*xAxis)(int), double (*yAxis)(int),
+                           double (*get)(int, int)) {
+  json.beginObject(name);
+  json.beginArray("speedAxis");
+  for (int i = 0; i < rows; i++) json.value((float)xAxis(i), 0);
+  json.endArray();
+  json.beginArray(yName);
+  for (int j = 0; j < cols; j++) json.value((float)yAxis(j), 0);
+  json.endArray();
+  json.beginArray("values");
+  for (int i = 0; i < rows; i++) {
+    json.beginArray();
+    for (int j = 0; j < cols; j++) json.value((float)get(i, j), 0);
+    json.endArray();
   }
-  json += "]},";
+  json.endArray();
+  json.endObject();
+}
 
-  // IDLE curve coefficients
-  json += "\"idle\":{";
-  json += "\"a\":" + String(gIdleCurveA, 4) + ",";
-  json += "\"b\":" + String(gIdleCurveB, 4) + ",";
-  json += "\"c\":" + String(gIdleCurveC, 5) + ",";
-  json += "\"d\":" + String(gIdleCurveD, 6);
-  json += "}";
+static void handleTablesJson() {
+  JsonStreamWriter json(server);
+  json.begin();
+  json.beginObject();
+
+  writeTableJson(json, "power", "posAxis", POWER_TABLE_ROWS, POWER_TABLE_COLS,
+                 powerSpeedAxis, powerPosAxis, powerTableGet);
+  writeTableJson(json, "erg", "powerAxis", ERG_TABLE_ROWS, ERG_TABLE_COLS,
+                 ergSpeedAxis, ergPowerAxis, ergEffectiveGet);
+  json.field("erg_from_power", gErgFromPower);
+  writeTableJson(json, "sim", "gradeAxis", SIM_TABLE_ROWS, SIM_TABLE_COLS,
+                 simSpeedAxis, simGradeAxis, simTableGet);
 
-  json += "}";
-  server.send(200, "application/json", json);
+  // IDLE curve coefficients
+  json.beginObject("idle");
+  json.field("a", gIdleCurveA, 4);
+  json.field("b", gIdleCurveB, 4);
+  json.field("c", gIdleCurveC, 5);
+  json.field("d", gIdleCurveD, 6);
+  json.endObject();
+
+  json.endObject();
+  json.end();
 }
 
 // Simple JSON parser for table values
@@ -1229,6 +919,11 @@ static void handleErgTableSave() {
     return;
   }
 
+  if (gErgFromPower) {
+    server.send(409, "text/plain", "ERG follows the Power table; turn off \"Derive from the Power table\" to edit it");
+    return;
+  }
+
   String body = server.arg("plain");
   double values[ERG_TABLE_ROWS * ERG_TABLE_COLS];
 
@@ -1257,6 +952,20 @@ static void handleErgTableReset() {
   server.send(200, "text/plain", "ERG table reset to defaults");
 }
 
+static void handleErgDerive() {
+  if (!server.hasArg("en")) {
+    server.send(400, "text/plain", "Missing parameters");
+    return;
+  }
+
+  gErgFromPower = (server.arg("en").toInt() != 0);
+  ergControlReset();
+  ergTableSave();
+
+  server.send(200, "text/plain", gErgFromPower ? "ERG now follows the inverted Power table"
+                                               : "ERG now uses the ERG table");
+}
+
 static void handleSimTableSave() {
   if (server.method() != HTTP_POST) {
     server.send(405, "text/plain", "Method not allowed");
@@ -1294,24 +1003,25 @@ static void handleSimTableReset() {
 // ==================== WIFI SETTINGS HANDLERS ====================
 
 static void handleWifiStatus() {
-  String json = "{";
-  json += "\"client_mode\":" + String(gWifiClientMode ? "true" : "false") + ",";
-  json += "\"configured\":" + String(gWifiConfigured ? "true" : "false") + ",";
-  json += "\"ssid\":\"" + String(gWifiConfigured ? gWifiSsid : "") + "\",";
-  if (gWifiClientMode) {
-    json += "\"ip\":\"" + WiFi.localIP().toString() + "\",";
-    json += "\"rssi\":" + String(WiFi.RSSI()) + ",";
-  } else {
-    json += "\"ip\":\"" + WiFi.softAPIP().toString() + "\",";
-    json += "\"rssi\":0,";
-  }
+  char ip[16];
+  IPAddress addr = gWifiClientMode ? WiFi.localIP() : WiFi.softAPIP();
+  snprintf(ip, sizeof(ip), "%u.%u.%u.%u", addr[0], addr[1], addr[2], addr[3]);
+
+  JsonStreamWriter json(server);
+  json.begin();
+  json.beginObject();
+  json.field("client_mode", gWifiClientMode);
+  json.field("configured", gWifiConfigured);
+  json.field("ssid", gWifiConfigured ? gWifiSsid : "");
+  json.field("ip", ip);
+  json.field("rssi", gWifiClientMode ? (int)WiFi.RSSI() : 0);
   // Device identity info
-  json += "\"device_id\":\"" + String(gDeviceId) + "\",";
-  json += "\"device_name\":\"" + String(gDeviceNameSet ? gDeviceName : "") + "\",";
-  json += "\"hostname\":\"" + String(getEffectiveHostname()) + "\",";
-  json += "\"ap_ssid\":\"" + String(getEffectiveApSsid()) + "\"";
-  json += "}";
-  server.send(200, "application/json", json);
+  json.field("device_id", gDeviceId);
+  json.field("device_name", gDeviceNameSet ? gDeviceName : "");
+  json.field("hostname", getEffectiveHostname());
+  json.field("ap_ssid", getEffectiveApSsid());
+  json.endObject();
+  json.end();
 }
 
 static void handleWifiSave() {
@@ -1359,6 +1069,7 @@ static void handleWifiClear() {
 
 static void handleWifiRestart() {
   server.send(200, "text/plain", "Restarting WiFi...");
+  calibrationFlush();
   delay(500);
   ESP.restart();
 }
@@ -1393,7 +1104,7 @@ static void handleOtaInfo() {
   esp_ota_img_states_t otaState;
   esp_ota_get_state_partition(running, &otaState);
 
-  String stateStr = "UNKNOWN";
+  const char* stateStr = "UNKNOWN";
   switch (otaState) {
     case ESP_OTA_IMG_NEW: stateStr = "NEW"; break;
     case ESP_OTA_IMG_PENDING_VERIFY: stateStr = "PENDING_VERIFY"; break;
@@ -1403,17 +1114,40 @@ static void handleOtaInfo() {
     default: break;
   }
 
-  String json = "{";
-  json += "\"version\":\"" + String(FW_VERSION) + "\",";
-  json += "\"running_partition\":\"" + String(running->label) + "\",";
-  json += "\"running_address\":\"0x" + String(running->address, HEX) + "\",";
-  json += "\"running_size\":" + String(running->size) + ",";
-  json += "\"next_update_partition\":\"" + String(nextUpdate->label) + "\",";
-  json += "\"ota_state\":\"" + stateStr + "\",";
-  json += "\"can_rollback\":" + String(esp_ota_check_rollback_is_possible() ? "true" : "false");
-  json += "}";
-
-  server.send(200, "application/json", json);
+  char addr[12];
+  snprintf(addr, sizeof(addr), "0x%lx", (unsigned long)running->address);
+
+  JsonStreamWriter json(server);
+  json.begin();
+  json.beginObject();
+  json.field("version", FW_VERSION);
+  json.field("running_partition", running->label);
+  json.field("running_address", addr);
+  json.field("running_size", (unsigned long)running->size);
+  json.field("next_update_partition", nextUpdate->label);
+  json.field("ota_state", stateStr);
+  json.field("can_rollback", (bool)esp_ota_check_rollback_is_possible());
+
+  // Current or last upload since boot
+  OtaStreamStats st;
+  otaStreamGetStats(&st);
+  const uint32_t ms = (st.active ? millis() : st.lastMs) - st.startMs;
+  json.beginObject("upload");
+  json.field("in_progress", (bool)gOtaInProgress);
+  json.field("gzip", st.gzip);
+  json.field("received_bytes", (unsigned long)st.inBytes);
+  json.field("image_bytes", (unsigned long)st.outBytes);
+  json.field("expected_bytes", (unsigned long)gOtaExpectedSize);
+  json.field("ms", (unsigned long)ms);
+  json.field("kbps", ms ? st.inBytes / 1.024f / ms : 0.0f, 1);
+  json.field("image_kbps", ms ? st.outBytes / 1.024f / ms : 0.0f, 1);
+  json.field("inflate_ms", (unsigned long)(st.inflateUs / 1000));
+  json.field("flash_ms", (unsigned long)(st.writeUs / 1000));
+  json.field("ok", (bool)gOtaOk);
+  json.field("error", gOtaErr.length() ? gOtaErr.c_str() : "");
+  json.endObject();
+  json.endObject();
+  json.end();
 }
 
 static void handleOtaRollback() {
@@ -1423,6 +1157,7 @@ static void handleOtaRollback() {
   }
 
   server.send(200, "text/plain", "Rolling back to previous firmware... Device will restart.");
+  calibrationFlush();
   delay(500);
 
   esp_err_t err = esp_ota_mark_app_invalid_rollback_and_reboot();
@@ -1439,7 +1174,7 @@ static void handleUpdateForm() {
 <body>
   <h2>Firmware Update</h2>
   <form method="POST" action="/update" enctype="multipart/form-data">
-    <input type="file" name="update">
+    <input type="file" name="update" accept=".bin,.gz">
     <button type="submit">Upload</button>
   </form>
   <p><a href="/">Back to main</a></p>
@@ -1448,6 +1183,20 @@ static void handleUpdateForm() {
   )HTML");
 }
 
+static bool otaWriteFlash(const uint8_t* data, size_t len, void* ctx) {
+  return Update.write((uint8_t*)data, len) == len;
+}
+
+static void otaFail(const String& why) {
+  Update.abort();
+  otaStreamAbort();
+  gOtaInProgress = false;
+  gOtaDone = true;
+  gOtaOk = false;
+  if (gOtaErr.length() == 0) gOtaErr = why;
+  Serial.printf("[OTA] FAILED: %s\n", gOtaErr.c_str());
+}
+
 static void handleUpdateUpload() {
   HTTPUpload& upload = server.upload();
 
@@ -1458,6 +1207,7 @@ static void handleUpdateUpload() {
     gOtaDone = false;
     gOtaOk = false;
     gOtaErr = "";
+    gOtaExpectedSize = server.clientContentLength();   // Upload body (multipart framing included)
 
     // Check if BLE connected - deny OTA to prevent disruption
     if (OTA_DENY_WHEN_BLE_CONNECTED && deviceConnected) {
@@ -1468,26 +1218,39 @@ static void handleUpdateUpload() {
       gOtaInProgress = false;
       return;
     }
+    if (replayActive() || sweepActive()) {
+      gOtaDone = true;
+      gOtaErr = replayActive() ? "Replay running - wait for it to finish" : "Calibration sweep running - cancel it first";
+      Serial.printf("[OTA] DENIED - %s\n", gOtaErr.c_str());
+      return;
+    }
 
+    // Park: the control task stops moving the motor, the recorder and
+    // WebSocket telemetry pause until we are done. Flag first: a control
+    // tick in between would otherwise set a new target after the freeze.
     gOtaInProgress = true;
+    stepperHold();
+    gOtaLastProgressMs = millis();
+    otaStreamBegin(otaWriteFlash, NULL);
 
-    if (!Update.begin()) {
+    if (!Update.begin(UPDATE_SIZE_UNKNOWN)) {
       Update.printError(Serial);
-      gOtaInProgress = false;
-      gOtaDone = true;
-      gOtaOk = false;
-      gOtaErr = "Update.begin() failed";
+      otaFail("Update.begin() failed");
     }
   }
   else if (upload.status == UPLOAD_FILE_WRITE) {
-    if (Update.write(upload.buf, upload.currentSize) != upload.currentSize) {
+    if (!gOtaInProgress) return;
+    if (!otaStreamFeed(upload.buf, upload.currentSize)) {
       Update.printError(Serial);
-    } else {
-      gOtaBytes += upload.currentSize;
-      gOtaLastProgressMs = millis();
-      
-      // Print progress
-      uint8_t pct = (gOtaBytes * 100) / upload.totalSize;
+      otaFail(otaStreamError() ? otaStreamError() : "write failed");
+      return;
+    }
+    gOtaBytes += upload.currentSize;
+    gOtaLastProgressMs = millis();
+
+    // Print progress
+    if (gOtaExpectedSize > 0) {
+      uint8_t pct = (uint8_t)min((gOtaBytes * 100) / gOtaExpectedSize, (size_t)100);
       if (pct != gOtaLastPct && (pct % 10) == 0) {
         gOtaLastPct = pct;
         Serial.printf("[OTA] Progress: %d%%\n", pct);
@@ -1495,16 +1258,25 @@ static void handleUpdateUpload() {
     }
   }
   else if (upload.status == UPLOAD_FILE_END) {
+    if (!gOtaInProgress) return;
+    if (!otaStreamEnd()) {
+      otaFail(otaStreamError() ? otaStreamError() : "image check failed");
+      return;
+    }
     if (Update.end(true)) {
-      Serial.printf("[OTA] Success: %u bytes\n", upload.totalSize);
+      Serial.printf("[OTA] Success: %u bytes\n", (unsigned)Update.progress());
       gOtaOk = true;
     } else {
       Update.printError(Serial);
+      gOtaErr = Update.errorString();
       gOtaOk = false;
     }
     gOtaDone = true;
     gOtaInProgress = false;
   }
+  else if (upload.status == UPLOAD_FILE_ABORTED) {
+    if (gOtaInProgress) otaFail("Upload aborted");
+  }
 }
 
 static void handleUpdatePostFinalizer() {
@@ -1523,6 +1295,7 @@ static void handleUpdatePostFinalizer() {
 </html>
     )HTML");
 
+    calibrationFlush();
     delay(1000);
     Serial.println("[OTA] Rebooting...");
     ESP.restart();
@@ -1688,6 +1461,7 @@ void webServerInit() {
     if (MDNS.begin(hostname)) {
       MDNS.addService("http", "tcp", 80);
       Serial.printf("✓ mDNS started: http://%s.local\n", hostname);
+      fleetInit();
     } else {
       Serial.println("✗ mDNS failed to start");
     }
@@ -1704,38 +1478,63 @@ void webServerInit() {
   }
   
   // Register handlers
-  server.on("/", HTTP_GET, handleRoot);
-  server.on("/test", HTTP_GET, []() {
+  route("/", HTTP_GET, handleRoot);
+  route("/test", HTTP_GET, []() {
     Serial.println("[HTTP] Test endpoint hit!");
     server.send(200, "text/plain", "Web server is working!");
   });
-  server.on("/diag.json", HTTP_GET, handleDiagJson);
-  server.on("/goto", HTTP_GET, handleGoto);
-  server.on("/enable", HTTP_GET, handleEnable);
-  server.on("/goto_hold", HTTP_GET, handleGotoHold);
-  server.on("/grade_hold", HTTP_GET, handleGradeHold);
-  server.on("/resume_app", HTTP_POST, handleResumeApp);
-  server.on("/calibration.json", HTTP_GET, handleCalibrationJson);
-  server.on("/calibration", HTTP_POST, handleCalibrationSet);
-  server.on("/calibration/reset", HTTP_POST, handleCalibrationReset);
-  server.on("/tables", HTTP_GET, handleTablesPage);
-  server.on("/tables.json", HTTP_GET, handleTablesJson);
-  server.on("/tables/power", HTTP_POST, handlePowerTableSave);
-  server.on("/tables/power/reset", HTTP_POST, handlePowerTableReset);
-  server.on("/tables/erg", HTTP_POST, handleErgTableSave);
-  server.on("/tables/erg/reset", HTTP_POST, handleErgTableReset);
-  server.on("/tables/sim", HTTP_POST, handleSimTableSave);
-  server.on("/tables/sim/reset", HTTP_POST, handleSimTableReset);
-  server.on("/wifi_status.json", HTTP_GET, handleWifiStatus);
-  server.on("/wifi_save", HTTP_POST, handleWifiSave);
-  server.on("/wifi_clear", HTTP_POST, handleWifiClear);
-  server.on("/wifi_restart", HTTP_POST, handleWifiRestart);
-  server.on("/device_name_save", HTTP_POST, handleDeviceNameSave);
-  server.on("/device_name_clear", HTTP_POST, handleDeviceNameClear);
-  server.on("/ota_info.json", HTTP_GET, handleOtaInfo);
-  server.on("/ota_rollback", HTTP_POST, handleOtaRollback);
-  server.on("/update", HTTP_GET, handleUpdateForm);
-  server.on("/update", HTTP_POST, handleUpdatePostFinalizer, handleUpdateUpload);
+  route("/diag.json", HTTP_GET, handleDiagJson);
+  route("/goto", HTTP_GET, handleGoto);
+  route("/enable", HTTP_GET, handleEnable);
+  route("/goto_hold", HTTP_GET, handleGotoHold);
+  route("/grade_hold", HTTP_GET, handleGradeHold);
+  route("/resume_app", HTTP_POST, handleResumeApp);
+  route("/calibration.json", HTTP_GET, handleCalibrationJson);
+  route("/calibration", HTTP_POST, handleCalibrationSet);
+  route("/calibration/reset", HTTP_POST, handleCalibrationReset);
+  route("/erg_pi.json", HTTP_GET, handleErgPiJson);
+  route("/erg_pi", HTTP_POST, handleErgPiSet);
+  route("/erg_pi/reset", HTTP_POST, handleErgPiReset);
+  route("/inertia.json", HTTP_GET, handleInertiaJson);
+  route("/inertia", HTTP_POST, handleInertiaSet);
+  route("/inertia/reset", HTTP_POST, handleInertiaReset);
+  route("/coastdown/start", HTTP_POST, handleCoastDownStart);
+  route("/coastdown/cancel", HTTP_POST, handleCoastDownCancel);
+  route("/log.txt", HTTP_GET, handleLogText);
+  route("/rec.json", HTTP_GET, handleRecorderJson);
+  route("/rec.csv", HTTP_GET, handleRecorderCsv);
+  route("/rec", HTTP_POST, handleRecorderSet);
+  route("/rec/clear", HTTP_POST, handleRecorderClear);
+  route("/replay.json", HTTP_GET, handleReplayJson);
+  route("/replay.csv", HTTP_GET, handleReplayCsv);
+  route("/replay", HTTP_POST, handleReplayStart);
+  route("/sweep.json", HTTP_GET, handleSweepJson);
+  route("/sweep/start", HTTP_POST, handleSweepStart);
+  route("/sweep/cancel", HTTP_POST, handleSweepCancel);
+  route("/sweep/apply", HTTP_POST, handleSweepApply);
+  route("/meter/disconnect", HTTP_POST, handleMeterDisconnect);
+  route("/fleet.json", HTTP_GET, handleFleetJson);
+  route("/fleet", HTTP_POST, handleFleetSet);
+  route("/perf.json", HTTP_GET, handlePerfJson);
+  route("/tables", HTTP_GET, handleTablesPage);
+  route("/tables.json", HTTP_GET, handleTablesJson);
+  route("/tables/power", HTTP_POST, handlePowerTableSave);
+  route("/tables/power/reset", HTTP_POST, handlePowerTableReset);
+  route("/tables/erg", HTTP_POST, handleErgTableSave);
+  route("/tables/erg/reset", HTTP_POST, handleErgTableReset);
+  route("/tables/erg/derive", HTTP_POST, handleErgDerive);
+  route("/tables/sim", HTTP_POST, handleSimTableSave);
+  route("/tables/sim/reset", HTTP_POST, handleSimTableReset);
+  route("/wifi_status.json", HTTP_GET, handleWifiStatus);
+  route("/wifi_save", HTTP_POST, handleWifiSave);
+  route("/wifi_clear", HTTP_POST, handleWifiClear);
+  route("/wifi_restart", HTTP_POST, handleWifiRestart);
+  route("/device_name_save", HTTP_POST, handleDeviceNameSave);
+  route("/device_name_clear", HTTP_POST, handleDeviceNameClear);
+  route("/ota_info.json", HTTP_GET, handleOtaInfo);
+  route("/ota_rollback", HTTP_POST, handleOtaRollback);
+  route("/update", HTTP_GET, handleUpdateForm);
+  route("/update", HTTP_POST, handleUpdatePostFinalizer, handleUpdateUpload);
   
   // Add a catch-all handler for debugging
   server.onNotFound([]() {
@@ -1743,6 +1542,9 @@ void webServerInit() {
     server.send(404, "text/plain", "Not found");
   });
   
+  // Needed for ETag revalidation of the static pages
+  static const char* collectedHeaders[] = {"If-None-Match"};
+  server.collectHeaders(collectedHeaders, 1);
   server.begin();
   Serial.println("✓ Web server started on port 80");
 
@@ -1764,13 +1566,31 @@ void webServerUpdate() {
   server.handleClient();
   webSocket.loop();
 
-  // Broadcast diagnostics over WebSocket at 5 Hz
-  if (millis() - lastWsBroadcastMs >= WS_BROADCAST_INTERVAL_MS) {
-    lastWsBroadcastMs = millis();
-    if (webSocket.connectedClients() > 0) {
-      String diagJson = buildDiagJson();
-      webSocket.broadcastTXT(diagJson);
+  // An open dashboard or an upload keeps the trainer out of idle
+  if (gOtaInProgress || webSocket.connectedClients() > 0) powerActivity(POWER_WAKE_WEB);
+
+  // An upload that stopped without an abort must not leave the trainer parked
+  if (gOtaInProgress && millis() - gOtaLastProgressMs > OTA_STALL_TIMEOUT_MS) {
+    otaFail("Upload stalled");
+  }
+
+  // Telemetry pauses while an upload has the CPU and flash
+  if (gOtaInProgress) return;
+
+  fleetService();
+
+  // Stream diagnostics to each WebSocket client at its own rate (changed fields only)
+  const uint32_t now = millis();
+  bool captured = false;
+  TelemetryFrame cur;
+  for (uint8_t i = 0; i < WS_MAX_CLIENTS; i++) {
+    WsTelemetryClient& c = gWsClients[i];
+    if (!c.active || now - c.lastSendMs < c.intervalMs) continue;
+    if (!captured) {
+      telemetryCapture(&cur);
+      captured = true;
     }
+    wsSendTelemetry(i, cur, false);
   }
 
   // Debug: Show client requests periodically
@@ -1782,7 +1602,7 @@ void webServerUpdate() {
   }
 
   if (millis() - lastDebug > 5000 && requestCount > 0) {
-    Serial.printf("[HTTP] Served %lu requests in last 5s\n", requestCount);
+    Serial.printf("[HTTP] Served %lu requests in last 5s\n", (unsigned long)requestCount);
     requestCount = 0;
     lastDebug = millis();
   }
@@ -16,7 +16,7 @@ extern volatile bool gOtaOk;
 extern String gOtaErr;
 
 // ==================== EXTERNAL VARIABLES FOR DIAGNOSTICS ====================
-// Variables from main .ino file
+// Control state (control.cpp, sensors.cpp, ble_trainer.cpp)
 extern volatile int16_t ergTargetWatts;
 extern volatile float simGradePercent;
 extern float currentSpeedMph;
@@ -28,6 +28,9 @@ extern volatile ControlMode gMode;
 extern volatile bool gManualHoldActive;
 extern volatile int32_t gManualHoldTarget;
 
+// WiFi state (web_server.cpp)
+extern bool gWifiClientMode;   // true = connected to home WiFi, false = AP mode
+
 // ==================== FUNCTIONS ====================
 void webServerInit();
 void webServerUpdate();